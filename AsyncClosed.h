@@ -0,0 +1,371 @@
+#pragma once
+
+#include "AsyncPolicy.h"
+
+#include <initializer_list>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a Task Manager for a closed set
+ *      of Task types known at compile time. Tasks are stored by value in a
+ *      variant and dispatched with a switch rather than through virtual
+ *      functions and std::function, so the process bodies can be inlined.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! List the Task types handled by a ClosedTaskManager
+    template<class... Kinds>
+    struct TaskTypes {};
+    #pragma endregion
+
+    #pragma region Closed Task Decleration
+    /*
+     *      Name: ClosedTask
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store one Task of a closed set of types in place, with the index
+     *      of its type. Operations are dispatched with a chain of comparisons
+     *      against the index that compilers reduce to a switch.
+     *
+     *      Requires:
+     *      Each kind must be move constructible and callable with no
+     *      arguments. There can be at most 255 kinds.
+    **/
+    template<class... Kinds>
+    class ClosedTask {
+        static_assert(sizeof...(Kinds) > 0 && sizeof...(Kinds) < 256, "A ClosedTask requires between 1 and 255 kinds");
+
+        //! Find the index of a kind in the list
+        template<class K, class... List> struct IndexOf;
+        template<class K, class... List> struct IndexOf<K, K, List...> : std::integral_constant<unsigned char, 0> {};
+        template<class K, class First, class... List> struct IndexOf<K, First, List...> : std::integral_constant<unsigned char, 1 + IndexOf<K, List...>::value> {};
+
+        //! Call a function with the stored kind, matching the index against each kind in turn
+        template<unsigned char I, class... List> struct Visit {
+            template<class F> static inline void apply(unsigned char, void*, F&) {}
+        };
+        template<unsigned char I, class K, class... List> struct Visit<I, K, List...> {
+            template<class F> static inline void apply(unsigned char pIndex, void* pData, F& pFunction) {
+                if (pIndex == I) pFunction(*static_cast<K*>(pData));
+                else Visit<I + 1, List...>::apply(pIndex, pData, pFunction);
+            }
+        };
+
+        /*----------Variables----------*/
+        //! Store the Task in place, sized for the largest kind
+        typename std::aligned_storage<std::max({ sizeof(Kinds)... }), std::max({ alignof(Kinds)... })>::type mData;
+
+        //! Store the index of the stored kind
+        unsigned char mIndex;
+
+        /*----------Functions----------*/
+        //! Call a function with the stored kind
+        template<class F> inline void visit(F&& pFunction) { Visit<0, Kinds...>::apply(mIndex, &mData, pFunction); }
+
+    public:
+        //! Store a Task of one of the kinds
+        template<class K, class Kind = typename std::decay<K>::type, class = typename std::enable_if<!std::is_same<Kind, ClosedTask>::value>::type>
+        ClosedTask(K&& pTask) : mIndex(IndexOf<Kind, Kinds...>::value) { new (&mData) Kind(std::forward<K>(pTask)); }
+
+        //! Move a Task, the source keeps the moved from object
+        ClosedTask(ClosedTask&& pOther) : mIndex(pOther.mIndex) {
+            void* data = &mData;
+            pOther.visit([data](auto& pTask) { new (data) typename std::decay<decltype(pTask)>::type(std::move(pTask)); });
+        }
+        ClosedTask& operator=(ClosedTask&& pOther) {
+            if (this != &pOther) {
+                this->~ClosedTask();
+                new (this) ClosedTask(std::move(pOther));
+            }
+            return *this;
+        }
+        ClosedTask(const ClosedTask&) = delete;
+        ClosedTask& operator=(const ClosedTask&) = delete;
+
+        //! Destroy the stored Task
+        ~ClosedTask() { visit([](auto& pTask) { typedef typename std::decay<decltype(pTask)>::type Kind; pTask.~Kind(); }); }
+
+        //! Run the stored Task
+        inline void run() { visit([](auto& pTask) { pTask(); }); }
+
+        //! Retrieve the index of the stored kind
+        inline unsigned char kind() const { return mIndex; }
+    };
+    #pragma endregion
+
+    #pragma region Closed Task Manager Decleration
+    //! Prototype the closed Task Manager, specialised for a list of TaskTypes
+    template<class Types, class Queue = Policies::PriorityQueue, class Idle = Policies::BlockingIdle>
+    class ClosedTaskManager;
+
+    /*
+     *      Name: ClosedTaskManager
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Manage Workers processing a closed set of Task types, listed with
+     *      TaskTypes. Each Task is a callable object stored by value in the
+     *      queue, so adding a Task doesn't allocate it and running it doesn't
+     *      need virtual functions or std::function. The queue and idle
+     *      policies are shared with the PolicyWorkerPool.
+     *
+     *      Tasks are fire and forget, results are returned by the Task object
+     *      itself (E.g. writing to a location it was given). Errors thrown are
+     *      counted in the metrics and discarded.
+     *
+     *      Requires:
+     *      Callbacks on update, retries and the TaskManager subsystems are
+     *      not supported.
+    **/
+    template<class... Kinds, class Queue, class Idle>
+    class ClosedTaskManager<TaskTypes<Kinds...>, Queue, Idle> {
+    public:
+        //! Define the Task stored by this Task Manager
+        typedef ClosedTask<Kinds...> Task;
+
+    private:
+        /*----------Singleton Values----------*/
+        static ClosedTaskManager* mInstance;
+        ClosedTaskManager(unsigned int pWorkers);
+        ~ClosedTaskManager() = default;
+
+        ClosedTaskManager() = delete;
+        ClosedTaskManager(const ClosedTaskManager&) = delete;
+        ClosedTaskManager& operator=(const ClosedTaskManager&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as a constant the number of workers in use
+        const unsigned int mWorkerCount;
+
+        //! Maintain the Worker threads
+        std::vector<std::thread> mWorkers;
+
+        //! Flag if the Task Manager is operating
+        std::atomic_bool mRunning;
+
+        //! Store the Tasks waiting for a Worker
+        typename Queue::template Container<Task> mQueue;
+
+        //! Create a lock to prevent thread clashes over the queue
+        std::mutex mQueueLock;
+
+        //! Signal the Workers that are blocked waiting for work
+        std::condition_variable mQueueCondition;
+
+        //! Count the Tasks added that haven't finished
+        std::atomic<unsigned long long> mUnfinished;
+
+        //! Signal the threads waiting for all Tasks to finish
+        std::condition_variable mFinishedCondition;
+
+        //! Count the Tasks for the metrics
+        Policies::Instrumented::Counters mCounters;
+
+        /*----------Functions----------*/
+        //! Function run on the Worker threads
+        void runWorker();
+
+    public:
+        //! Main operation functionality
+        static bool create(unsigned int pWorkers = 5u);
+        static void destroy();
+
+        //! Task options
+        template<class K> static bool addTask(K&& pTask, ETaskPriority pPriority = Low_Priority);
+
+        //! Block until every Task added has finished
+        static void wait();
+
+        /*----------Getters----------*/
+        static TaskMetrics metrics();
+    };
+    #pragma endregion
+
+    #pragma region Closed Task Manager Templated Definitions
+    //! Define static singleton instance
+    template<class... Kinds, class Q, class I>
+    ClosedTaskManager<TaskTypes<Kinds...>, Q, I>* ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::mInstance = nullptr;
+
+    /*
+        ClosedTaskManager : Custom Constructor - Set default pre-creation singleton values
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pWorkers - The number of workers that will be used by the Task Manager
+    */
+    template<class... Kinds, class Q, class I>
+    inline ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::ClosedTaskManager(unsigned int pWorkers) :
+        mWorkerCount(pWorkers),
+        mRunning(true),
+        mUnfinished(0)
+    {}
+
+    /*
+        ClosedTaskManager : runWorker - Take Tasks from the queue and run them until the Task
+                                        Manager is destroyed
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class... Kinds, class Q, class I>
+    inline void ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::runWorker() {
+        //Store the idle state of the Worker
+        typename I::Waiter waiter;
+
+        //Loop while the Task Manager is running
+        std::unique_lock<std::mutex> lock(mQueueLock);
+        while (mRunning.load(std::memory_order_relaxed)) {
+            //Wait for work
+            if (mQueue.empty()) {
+                waiter.wait(lock, mQueueCondition);
+                continue;
+            }
+
+            //Take the next Task
+            waiter.busy();
+            Task task = mQueue.pop();
+            lock.unlock();
+
+            //Run the Task
+            try {
+                task.run();
+                mCounters.completed();
+            } catch (...) {
+                mCounters.failed();
+            }
+
+            //Wake the waiting threads once everything has finished
+            lock.lock();
+            if (mUnfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) mFinishedCondition.notify_all();
+        }
+    }
+
+    /*
+        ClosedTaskManager : create - Initialise the Task Manager and start the Workers
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pWorkers - The number of workers that the Task Manager is to create and use
+                             (Default 5)
+
+        return bool - Returns true if the Task Manager was created successfully
+    */
+    template<class... Kinds, class Q, class I>
+    inline bool ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::create(unsigned int pWorkers) {
+        //Ensure that the singleton hasn't been created
+        assert(!mInstance);
+
+        //Create the singleton
+        mInstance = new ClosedTaskManager(pWorkers ? pWorkers : 1u);
+
+        //Check the instance was created
+        if (!mInstance) {
+            printf("Unable to create the ClosedTaskManager singleton instance.");
+            return false;
+        }
+
+        //Start the Workers
+        ClosedTaskManager* instance = mInstance;
+        for (unsigned int i = 0; i < instance->mWorkerCount; i++)
+            instance->mWorkers.emplace_back([instance]() { instance->runWorker(); });
+
+        //Return success
+        return true;
+    }
+
+    /*
+        ClosedTaskManager : destroy - Stop the Workers and delete the Task Manager
+
+        Note:
+        Tasks that are still waiting are destroyed without being run
+
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class... Kinds, class Q, class I>
+    inline void ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::destroy() {
+        //Test if the singleton instance was created
+        if (mInstance) {
+            //Stop the Workers
+            mInstance->mQueueLock.lock();
+            mInstance->mRunning = false;
+            mInstance->mQueueCondition.notify_all();
+            mInstance->mQueueLock.unlock();
+            for (auto& worker : mInstance->mWorkers) worker.join();
+
+            //Delete the singleton instance
+            delete mInstance;
+            mInstance = nullptr;
+        }
+    }
+
+    /*
+        ClosedTaskManager : addTask - Add a Task to the Task Manager for processing
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pTask - The Task to run, of one of the kinds of the Task Manager
+        param[in] pPriority - The priority of the Task, ignored by queues that don't use
+                              priorities (Default Low_Priority)
+
+        return bool - Returns true if the Task was added
+    */
+    template<class... Kinds, class Q, class I>
+    template<class K>
+    inline bool ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::addTask(K&& pTask, ETaskPriority pPriority) {
+        //Ensure the Task Manager exists
+        if (!mInstance) return false;
+
+        //Add the Task to the queue
+        mInstance->mCounters.queued();
+        mInstance->mUnfinished.fetch_add(1, std::memory_order_relaxed);
+        mInstance->mQueueLock.lock();
+        mInstance->mQueue.push(Task(std::forward<K>(pTask)), pPriority);
+        mInstance->mQueueLock.unlock();
+
+        //Wake a Worker if they block
+        if (I::wakes) mInstance->mQueueCondition.notify_one();
+        return true;
+    }
+
+    /*
+        ClosedTaskManager : wait - Block the calling thread until every Task added has finished
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class... Kinds, class Q, class I>
+    inline void ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::wait() {
+        ClosedTaskManager* instance = mInstance;
+        std::unique_lock<std::mutex> lock(instance->mQueueLock);
+        instance->mFinishedCondition.wait(lock, [instance]() { return !instance->mUnfinished.load(std::memory_order_acquire); });
+    }
+
+    /*
+        ClosedTaskManager : metrics - Retrieve the current counters of the Task Manager
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return TaskMetrics - Returns a copy of the counters
+    */
+    template<class... Kinds, class Q, class I>
+    inline TaskMetrics ClosedTaskManager<TaskTypes<Kinds...>, Q, I>::metrics() {
+        return (mInstance ? mInstance->mCounters.metrics() : TaskMetrics());
+    }
+    #pragma endregion
+}
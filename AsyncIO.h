@@ -0,0 +1,977 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <deque>
+#include <condition_variable>
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with an I/O subsystem that
+ *      completes file reads and writes without occupying a Worker
+ *      while the operation is in flight.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the buffer type used to transfer file data
+    typedef std::vector<char> IOBuffer;
+    #pragma endregion
+
+    #pragma region IO Manager Decleration
+    /*
+     *      Name: IOManager
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Submit file reads and writes for Tasks and hand the Task over to
+     *      the TaskManager once the data is available. While the operation is
+     *      in flight the Task remains Pending but is not held by a Worker.
+     *
+     *      On Linux the operations are submitted through io_uring when the
+     *      running kernel supports it (detected on creation). Otherwise a small
+     *      pool of blocking I/O threads is used.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      IOManager. The process function of Tasks given to the IOManager is
+     *      replaced, Tasks should only be re-submitted through the IOManager.
+    **/
+    class IOManager {
+        //! Prototype the internal request object
+        struct Request;
+
+        #ifdef __linux__
+        //! Prototype the io_uring interface object
+        struct Ring;
+        #endif
+
+        /*----------Singleton Values----------*/
+        static IOManager* mInstance;
+        IOManager(unsigned int pFallbackThreads, unsigned int pQueueDepth);
+        ~IOManager() = default;
+
+        IOManager() = delete;
+        IOManager(const IOManager&) = delete;
+        IOManager& operator=(const IOManager&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as constants the sizes of the different backends
+        const unsigned int mFallbackCount;
+        const unsigned int mQueueDepth;
+
+        //! Flag if the IO Manager is operating
+        bool mRunning;
+
+        #ifdef __linux__
+        //! Store the io_uring instance (nullptr if unavailable)
+        Ring* mRing;
+
+        //! Create a lock to prevent thread clashes over the submission queue
+        std::mutex mRingLock;
+
+        //! Maintain a thread for reaping io_uring completions
+        std::thread mCompletionThread;
+        #endif
+
+        //! Maintain the blocking fallback threads
+        std::thread* mFallbackThreads;
+
+        //! Create a lock and signal for the blocking request queue
+        std::mutex mRequestLock;
+        std::condition_variable mRequestSignal;
+
+        //! Keep a queue of the requests waiting on the blocking threads
+        std::deque<std::shared_ptr<Request>> mBlockingRequests;
+
+        /*----------Functions----------*/
+        //! Hand a request to the active backend
+        static void submit(const std::shared_ptr<Request>& pRequest);
+
+        //! Complete a request and queue its Task with the TaskManager
+        static void finishRequest(Request* pRequest, int pError);
+
+        //! Function run on the fallback threads to complete blocking requests
+        void processBlocking();
+        static void performBlocking(Request& pRequest);
+
+        #ifdef __linux__
+        //! Function run on the completion thread to reap io_uring results
+        void reapCompletions();
+        bool pushRequest(Request* pRequest, int& pError);
+        #endif
+
+    public:
+        //! Main operation functionality
+        static bool create(unsigned int pFallbackThreads = 2u, unsigned int pQueueDepth = 256u, bool pAllowIOUring = true);
+        static void destroy();
+
+        //! Report if the io_uring backend is in use
+        static bool usingIOUring();
+
+        //! I/O options
+        static bool readFile(Task<IOBuffer>& pTask, const std::string& pPath);
+        static bool read(Task<IOBuffer>& pTask, int pFile, unsigned long long pOffset, size_t pLength);
+        static bool write(Task<size_t>& pTask, int pFile, unsigned long long pOffset, const IOBuffer& pData);
+    };
+    #pragma endregion
+
+    #pragma region Request Definition
+    /*
+     *      Name: Request
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single I/O operation while it is in flight
+    **/
+    struct IOManager::Request {
+        //! Label the different operations that can be requested
+        enum class EType : char { Read_File, Read, Write };
+
+        //! Store the operation to complete
+        EType type;
+
+        //! Store the Task to queue once the operation completes
+        std::shared_ptr<Asynch_Task_Base> task;
+
+        //! Keep the request alive while it is owned by a backend
+        std::shared_ptr<Request> self;
+
+        //! Store the file that is operated on
+        std::string path;
+        int file;
+        bool ownsFile;
+
+        //! Store the position in the file to start at
+        unsigned long long offset;
+
+        //! Store the data that is read or written
+        IOBuffer buffer;
+
+        //! Track the number of bytes that have been transferred
+        size_t transferred;
+
+        //! Store the error number raised by the operation (0 on success)
+        int error;
+
+        #ifdef __linux__
+        //! Store the vector describing the remaining buffer for io_uring
+        iovec vec;
+        #endif
+
+        //! Initialise with default values
+        inline Request(EType pType) : type(pType), file(-1), ownsFile(false), offset(0), transferred(0), error(0) {}
+
+        //! Raise an exception describing a failed operation
+        inline void raiseError() const {
+            //Create a description of the operation
+            std::string msg = (type == EType::Write ? "Failed to write to file" : "Failed to read from file");
+            if (path.size()) msg += " '" + path + "'";
+
+            //Throw the system error description
+            throw std::runtime_error(msg + ": " + strerror(error));
+        }
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::IOManager* AsynchTasks::IOManager::mInstance = nullptr;
+
+#ifdef __linux__
+#pragma region Ring Definition
+/*
+ *      Name: Ring
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Store the memory mapped queues of an io_uring instance. The
+ *      system calls are used directly so no additional library is
+ *      required for the backend.
+**/
+struct AsynchTasks::IOManager::Ring {
+    //! Store the file descriptor of the ring
+    int ringFile;
+
+    //! Store the submission queue values
+    unsigned int* sqHead;
+    unsigned int* sqTail;
+    unsigned int* sqMask;
+    unsigned int* sqArray;
+    io_uring_sqe* sqes;
+
+    //! Store the completion queue values
+    unsigned int* cqHead;
+    unsigned int* cqTail;
+    unsigned int* cqMask;
+    io_uring_cqe* cqes;
+
+    //! Store the number of completion queue entries to limit operations in flight
+    unsigned int cqEntries;
+
+    //! Track the number of operations that have been submitted and not reaped
+    unsigned int inFlight;
+
+    //! Store requests that could not be submitted while the ring was full
+    std::deque<Request*> backlog;
+
+    //! Store the mapped regions to release on destruction
+    void* sqRing; size_t sqRingSize;
+    void* cqRing; size_t cqRingSize;
+    size_t sqesSize;
+
+    /*
+        Ring : create - Setup a new io_uring instance
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pDepth - The number of submission queue entries to request
+
+        return Ring* - Returns a pointer to the new Ring or nullptr if io_uring is unavailable
+    */
+    static Ring* create(unsigned int pDepth) {
+        //Setup the ring with default parameters
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        int ringFile = (int)syscall(__NR_io_uring_setup, pDepth, &params);
+
+        //Check the kernel supports io_uring
+        if (ringFile < 0) return nullptr;
+
+        //Create the ring object
+        Ring* ring = new Ring();
+        ring->ringFile = ringFile;
+        ring->inFlight = 0;
+        ring->cqEntries = params.cq_entries;
+        ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        //Check if the queues can share a single mapping
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) ring->sqRingSize = ring->cqRingSize = std::max(ring->sqRingSize, ring->cqRingSize);
+
+        //Map the queues into memory
+        ring->sqRing = mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFile, IORING_OFF_SQ_RING);
+        ring->cqRing = (singleMap ? ring->sqRing : mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFile, IORING_OFF_CQ_RING));
+        ring->sqes = (io_uring_sqe*)mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFile, IORING_OFF_SQES);
+
+        //Check the mappings were created
+        if (ring->sqRing == MAP_FAILED || ring->cqRing == MAP_FAILED || (void*)ring->sqes == MAP_FAILED) {
+            if (ring->sqRing != MAP_FAILED) munmap(ring->sqRing, ring->sqRingSize);
+            if (!singleMap && ring->cqRing != MAP_FAILED) munmap(ring->cqRing, ring->cqRingSize);
+            if ((void*)ring->sqes != MAP_FAILED) munmap(ring->sqes, ring->sqesSize);
+            close(ringFile);
+            delete ring;
+            return nullptr;
+        }
+
+        //Find the queue values within the mappings
+        char* sq = (char*)ring->sqRing;
+        ring->sqHead = (unsigned int*)(sq + params.sq_off.head);
+        ring->sqTail = (unsigned int*)(sq + params.sq_off.tail);
+        ring->sqMask = (unsigned int*)(sq + params.sq_off.ring_mask);
+        ring->sqArray = (unsigned int*)(sq + params.sq_off.array);
+
+        char* cq = (char*)ring->cqRing;
+        ring->cqHead = (unsigned int*)(cq + params.cq_off.head);
+        ring->cqTail = (unsigned int*)(cq + params.cq_off.tail);
+        ring->cqMask = (unsigned int*)(cq + params.cq_off.ring_mask);
+        ring->cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+        //Return the new ring
+        return ring;
+    }
+
+    /*
+        Ring : push - Add a single entry to the submission queue and submit it to the kernel
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        If the kernel doesn't accept the entry it is withdrawn from the queue, so it can't be
+        submitted later without being tracked
+
+        Requires:
+        The submission lock of the IOManager must be held when pushing entries
+
+        param[in] pOpcode - The io_uring operation to perform
+        param[in] pFile - The file descriptor to operate on
+        param[in] pVec - The buffer description to use (nullptr for none)
+        param[in] pOffset - The offset in the file to begin at
+        param[in] pUserData - The value returned with the completion
+
+        return int - Returns 0 if the entry was submitted, otherwise the error number raised
+    */
+    int push(unsigned char pOpcode, int pFile, const iovec* pVec, unsigned long long pOffset, unsigned long long pUserData) {
+        //Get the next entry in the queue
+        unsigned int tail = *sqTail;
+        unsigned int index = tail & *sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+
+        //Fill out the operation
+        memset(sqe, 0, sizeof(io_uring_sqe));
+        sqe->opcode = pOpcode;
+        sqe->fd = pFile;
+        sqe->addr = (unsigned long long)pVec;
+        sqe->len = (pVec ? 1 : 0);
+        sqe->off = pOffset;
+        sqe->user_data = pUserData;
+
+        //Publish the entry to the kernel
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        //Submit the entry
+        long submitted;
+        while ((submitted = syscall(__NR_io_uring_enter, ringFile, 1, 0, 0, nullptr, 0)) < 0 && errno == EINTR);
+
+        //Withdraw the entry if the kernel didn't take it (E.g. EAGAIN or EBUSY while completions are pending)
+        if (submitted < 1 && __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == tail) {
+            int error = (submitted < 0 ? errno : EAGAIN);
+            __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+            return error;
+        }
+
+        //Track the operation
+        ++inFlight;
+        return 0;
+    }
+
+    /*
+        Ring : Destructor - Release the mapped queues and close the ring
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    ~Ring() {
+        munmap(sqes, sqesSize);
+        if (cqRing != sqRing) munmap(cqRing, cqRingSize);
+        munmap(sqRing, sqRingSize);
+        close(ringFile);
+    }
+};
+#pragma endregion
+#endif
+
+#pragma region IO Manager Function Definitions
+/*
+    IOManager : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFallbackThreads - The number of blocking threads to use if io_uring is unavailable
+    param[in] pQueueDepth - The number of submission entries to request for io_uring
+*/
+AsynchTasks::IOManager::IOManager(unsigned int pFallbackThreads, unsigned int pQueueDepth) :
+    mFallbackCount(pFallbackThreads),
+    mQueueDepth(pQueueDepth),
+    mRunning(false),
+    #ifdef __linux__
+    mRing(nullptr),
+    #endif
+    mFallbackThreads(nullptr)
+{}
+
+/*
+    IOManager : submit - Hand a request to the active backend for processing
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pRequest - The request object to complete
+*/
+void AsynchTasks::IOManager::submit(const std::shared_ptr<Request>& pRequest) {
+    //Keep the request alive while the backend owns it
+    pRequest->self = pRequest;
+
+    #ifdef __linux__
+    //Check if io_uring is in use
+    if (mInstance->mRing) {
+        //Open the file on the calling thread
+        if (pRequest->type == Request::EType::Read_File) {
+            //Open the file
+            pRequest->file = open(pRequest->path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (pRequest->file < 0) { finishRequest(pRequest.get(), errno); return; }
+            pRequest->ownsFile = true;
+
+            //Get the size of the file
+            struct stat info;
+            if (fstat(pRequest->file, &info) < 0) { finishRequest(pRequest.get(), errno); return; }
+            pRequest->buffer.resize((size_t)info.st_size);
+
+            //Empty files are complete
+            if (!info.st_size) { finishRequest(pRequest.get(), 0); return; }
+        }
+
+        //Submit the request to the ring, waiting in the backlog if it is full
+        int error;
+        std::unique_lock<std::mutex> guard(mInstance->mRingLock);
+        if (!mInstance->pushRequest(pRequest.get(), error)) {
+            if (!error) mInstance->mRing->backlog.push_back(pRequest.get());
+            else {
+                guard.unlock();
+                finishRequest(pRequest.get(), error);
+            }
+        }
+        return;
+    }
+    #endif
+
+    //Add the request to the blocking queue
+    mInstance->mRequestLock.lock();
+    mInstance->mBlockingRequests.push_back(pRequest);
+    mInstance->mRequestLock.unlock();
+
+    //Wake a blocking thread
+    mInstance->mRequestSignal.notify_one();
+}
+
+/*
+    IOManager : finishRequest - Complete a request and queue the Task with the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pRequest - The request that has completed
+    param[in] pError - The error number raised by the operation (0 on success)
+*/
+void AsynchTasks::IOManager::finishRequest(Request* pRequest, int pError) {
+    //Store the error that occurred
+    pRequest->error = pError;
+
+    //Trim reads that reached the end of the file
+    if (!pError && pRequest->type != Request::EType::Write)
+        pRequest->buffer.resize(pRequest->transferred);
+
+    //Close files opened by the request
+    if (pRequest->ownsFile && pRequest->file >= 0) {
+        #ifdef _WIN32
+        _close(pRequest->file);
+        #else
+        close(pRequest->file);
+        #endif
+        pRequest->file = -1;
+    }
+
+    //Take ownership of the request and Task from the request
+    std::shared_ptr<Request> request = std::move(pRequest->self);
+    std::shared_ptr<Asynch_Task_Base> task = std::move(pRequest->task);
+
+    //Hand the Task to the Workers for the callback stage
+    if (task) TaskManager::queueTask(task);
+}
+
+/*
+    IOManager : processBlocking - Complete requests on a blocking fallback thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::IOManager::processBlocking() {
+    //Loop so long as the IO Manager is running
+    while (true) {
+        //Wait for a request to be available
+        std::unique_lock<std::mutex> guard(mRequestLock);
+        mRequestSignal.wait(guard, [&]() { return !mRunning || mBlockingRequests.size(); });
+
+        //Check if the manager is closing
+        if (mBlockingRequests.empty()) return;
+
+        //Get the next request
+        std::shared_ptr<Request> request = mBlockingRequests.front();
+        mBlockingRequests.pop_front();
+        guard.unlock();
+
+        //Complete the operation
+        performBlocking(*request);
+    }
+}
+
+/*
+    IOManager : performBlocking - Complete a request using blocking system calls
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pRequest - The request object to complete
+*/
+void AsynchTasks::IOManager::performBlocking(Request& pRequest) {
+    //Read whole files through the C library
+    if (pRequest.type == Request::EType::Read_File) {
+        //Open the file
+        FILE* file = fopen(pRequest.path.c_str(), "rb");
+        if (!file) { finishRequest(&pRequest, errno); return; }
+
+        //Get the size of the file
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        //Read the contents
+        pRequest.buffer.resize(size > 0 ? (size_t)size : 0);
+        pRequest.transferred = (pRequest.buffer.size() ? fread(pRequest.buffer.data(), 1, pRequest.buffer.size(), file) : 0);
+        int error = (ferror(file) ? EIO : 0);
+        fclose(file);
+
+        //Complete the request
+        finishRequest(&pRequest, error);
+        return;
+    }
+
+    //Loop until all of the data has been transferred
+    while (pRequest.transferred < pRequest.buffer.size()) {
+        //Find the remaining section of the buffer
+        char* data = pRequest.buffer.data() + pRequest.transferred;
+        size_t remaining = pRequest.buffer.size() - pRequest.transferred;
+        unsigned long long offset = pRequest.offset + pRequest.transferred;
+
+        #ifdef _WIN32
+        //Setup the position to operate at
+        OVERLAPPED position;
+        memset(&position, 0, sizeof(position));
+        position.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        position.OffsetHigh = (DWORD)(offset >> 32);
+
+        //Complete the operation on the file handle
+        HANDLE handle = (HANDLE)_get_osfhandle(pRequest.file);
+        DWORD count = 0;
+        BOOL success = (pRequest.type == Request::EType::Write ?
+            WriteFile(handle, data, (DWORD)remaining, &count, &position) :
+            ReadFile(handle, data, (DWORD)remaining, &count, &position));
+
+        //Check for errors (reading past the end of the file is not an error)
+        if (!success && GetLastError() != ERROR_HANDLE_EOF) { finishRequest(&pRequest, EIO); return; }
+        long long result = (long long)count;
+        #else
+        //Complete the operation on the file descriptor
+        long long result = (pRequest.type == Request::EType::Write ?
+            (long long)pwrite(pRequest.file, data, remaining, (off_t)offset) :
+            (long long)pread(pRequest.file, data, remaining, (off_t)offset));
+
+        //Check for errors
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            finishRequest(&pRequest, errno);
+            return;
+        }
+        #endif
+
+        //Check if the end of the file was reached
+        if (!result) break;
+
+        //Track the transferred data
+        pRequest.transferred += (size_t)result;
+    }
+
+    //Complete the request
+    finishRequest(&pRequest, 0);
+}
+
+#ifdef __linux__
+/*
+    IOManager : pushRequest - Submit the remaining section of a request to the ring
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If the kernel is busy the request waits for the operations in flight to complete before
+    it is submitted again. With nothing in flight to wait on the request fails instead
+
+    Requires:
+    The submission lock of the IOManager must be held when pushing requests
+
+    param[in] pRequest - The request object to submit
+    param[out] pError - Set to the error number the request should fail with (0 if it should wait)
+
+    return bool - Returns false if the request was not submitted
+*/
+bool AsynchTasks::IOManager::pushRequest(Request* pRequest, int& pError) {
+    //Leave a completion entry for the wake up operation
+    pError = 0;
+    if (mRing->inFlight + 1 >= mRing->cqEntries) return false;
+
+    //Describe the remaining section of the buffer
+    pRequest->vec.iov_base = pRequest->buffer.data() + pRequest->transferred;
+    pRequest->vec.iov_len = pRequest->buffer.size() - pRequest->transferred;
+
+    //Push the operation
+    int error = mRing->push((pRequest->type == Request::EType::Write ? IORING_OP_WRITEV : IORING_OP_READV),
+                            pRequest->file, &pRequest->vec, pRequest->offset + pRequest->transferred, (unsigned long long)pRequest);
+    if (!error) return true;
+
+    //Wait for completions to free the kernel resources, unless none are in flight
+    if ((error == EAGAIN || error == EBUSY) && mRing->inFlight) return false;
+    pError = error;
+    return false;
+}
+
+/*
+    IOManager : reapCompletions - Complete the requests returned by io_uring
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::IOManager::reapCompletions() {
+    //Loop until the manager is closing and there are no operations in flight
+    while (true) {
+        //Check for available completions
+        unsigned int head = *mRing->cqHead;
+        unsigned int tail = __atomic_load_n(mRing->cqTail, __ATOMIC_ACQUIRE);
+
+        //Wait for an operation to complete
+        if (head == tail) {
+            //Check if the manager has finished
+            mRingLock.lock();
+            bool finished = (!mRunning && !mRing->inFlight);
+            mRingLock.unlock();
+            if (finished) return;
+
+            //Block until a completion arrives
+            syscall(__NR_io_uring_enter, mRing->ringFile, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            continue;
+        }
+
+        //Retrieve the completion
+        io_uring_cqe* cqe = &mRing->cqes[head & *mRing->cqMask];
+        Request* request = (Request*)cqe->user_data;
+        int result = cqe->res;
+        __atomic_store_n(mRing->cqHead, head + 1, __ATOMIC_RELEASE);
+
+        //Lock the ring to update the request
+        std::unique_lock<std::mutex> guard(mRingLock);
+        --mRing->inFlight;
+
+        //Check if the completion was for a request
+        if (request) {
+            //Check if the operation should be attempted again
+            if (result == -EINTR || result == -EAGAIN) mRing->backlog.push_front(request);
+
+            //Check for an error
+            else if (result < 0) {
+                guard.unlock();
+                finishRequest(request, -result);
+                guard.lock();
+            }
+
+            //Track the transferred data
+            else {
+                request->transferred += (size_t)result;
+
+                //Check if the operation has finished
+                if (!result || request->transferred >= request->buffer.size()) {
+                    guard.unlock();
+                    finishRequest(request, 0);
+                    guard.lock();
+                }
+
+                //Submit the remainder of a short operation
+                else mRing->backlog.push_front(request);
+            }
+        }
+
+        //Submit the requests waiting for space in the ring
+        while (mRing->backlog.size()) {
+            //Submit the next request
+            Request* next = mRing->backlog.front();
+            int error;
+            if (pushRequest(next, error)) mRing->backlog.pop_front();
+
+            //Fail requests the kernel won't accept
+            else if (error) {
+                mRing->backlog.pop_front();
+                guard.unlock();
+                finishRequest(next, error);
+                guard.lock();
+            }
+
+            //Wait for space in the ring
+            else break;
+        }
+    }
+}
+#endif
+
+/*
+    IOManager : create - Initialise and setup the IO manager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFallbackThreads - The number of blocking threads to use if io_uring is
+                                 unavailable (Default 2)
+    param[in] pQueueDepth - The number of submission entries to request for io_uring (Default 256)
+    param[in] pAllowIOUring - Flags if io_uring should be used when available (Default true)
+
+    return bool - Returns true if the IOManager was created successfully
+*/
+bool AsynchTasks::IOManager::create(unsigned int pFallbackThreads, unsigned int pQueueDepth, bool pAllowIOUring) {
+    //Assert that the IO Manager doesn't already exist
+    assert(!mInstance);
+
+    //Assert that there is a backend that can be used
+    assert(pFallbackThreads && pQueueDepth);
+
+    //Create the new IO Manager
+    mInstance = new IOManager(pFallbackThreads, pQueueDepth);
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the IOManager singleton instance.");
+        return false;
+    }
+
+    //Set the operating flag
+    mInstance->mRunning = true;
+
+    #ifdef __linux__
+    //Attempt to setup io_uring
+    if (pAllowIOUring) mInstance->mRing = Ring::create(pQueueDepth);
+
+    //Start the completion thread if io_uring is available
+    if (mInstance->mRing) {
+        mInstance->mCompletionThread = std::thread([&]() {
+            //Call the completion function
+            mInstance->reapCompletions();
+        });
+        return true;
+    }
+    #endif
+
+    //Create the fallback threads
+    mInstance->mFallbackThreads = new std::thread[mInstance->mFallbackCount];
+    for (unsigned int i = 0; i < mInstance->mFallbackCount; i++)
+        mInstance->mFallbackThreads[i] = std::thread(&IOManager::processBlocking, mInstance);
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    IOManager : destroy - Wait for operations in flight, close all threads and delete the IOManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::IOManager::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        #ifdef __linux__
+        //Check if io_uring is in use
+        if (mInstance->mRing) {
+            //Clear the operating flag and wake the completion thread
+            mInstance->mRingLock.lock();
+            mInstance->mRunning = false;
+            while (mInstance->mRing->push(IORING_OP_NOP, -1, nullptr, 0, 0) && !mInstance->mRing->inFlight) {
+                //Retry until the wake up is accepted, the completion of operations in flight wakes the thread otherwise
+                mInstance->mRingLock.unlock();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                mInstance->mRingLock.lock();
+            }
+            mInstance->mRingLock.unlock();
+
+            //Join the completion thread
+            if (mInstance->mCompletionThread.get_id() != std::thread::id())
+                mInstance->mCompletionThread.join();
+
+            //Delete the ring
+            delete mInstance->mRing;
+        }
+        #endif
+
+        //Check if the fallback threads are in use
+        if (mInstance->mFallbackThreads) {
+            //Clear the operating flag and wake the threads
+            mInstance->mRequestLock.lock();
+            mInstance->mRunning = false;
+            mInstance->mRequestLock.unlock();
+            mInstance->mRequestSignal.notify_all();
+
+            //Join the fallback threads
+            for (unsigned int i = 0; i < mInstance->mFallbackCount; i++) {
+                if (mInstance->mFallbackThreads[i].get_id() != std::thread::id())
+                    mInstance->mFallbackThreads[i].join();
+            }
+
+            //Delete the threads
+            delete[] mInstance->mFallbackThreads;
+        }
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    IOManager : usingIOUring - Report if the io_uring backend was detected and is in use
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return bool - Returns true if operations are submitted through io_uring
+*/
+bool AsynchTasks::IOManager::usingIOUring() {
+    #ifdef __linux__
+    return (mInstance && mInstance->mRing);
+    #else
+    return false;
+    #endif
+}
+
+/*
+    IOManager : readFile - Read the entire contents of a file for a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the contents of the file. Once
+                          added the property values will be uneditable
+    param[in] pPath - The path of the file to read
+
+    return bool - Returns a flag determining if the read was submitted successfully
+*/
+bool AsynchTasks::IOManager::readFile(Task<IOBuffer>& pTask, const std::string& pPath) {
+    //Ensure the manager exists, the pointer is valid and the task can be used
+    if (!mInstance || !pTask || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the request
+    std::shared_ptr<Request> request = std::make_shared<Request>(Request::EType::Read_File);
+    request->task = pTask;
+    request->path = pPath;
+
+    //Set the process to return the data once read
+    TaskManager::setProcess<IOBuffer>(*pTask, [request]() -> IOBuffer {
+        if (request->error) request->raiseError();
+        return std::move(request->buffer);
+    });
+
+    //Submit the request
+    submit(request);
+    return true;
+}
+
+/*
+    IOManager : read - Read a section of an open file for a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If the end of the file is reached the result will contain less than pLength bytes
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the data. Once added the property
+                          values will be uneditable
+    param[in] pFile - The file descriptor to read from. Must remain open until the Task completes
+    param[in] pOffset - The position in the file to start reading from
+    param[in] pLength - The number of bytes to read
+
+    return bool - Returns a flag determining if the read was submitted successfully
+*/
+bool AsynchTasks::IOManager::read(Task<IOBuffer>& pTask, int pFile, unsigned long long pOffset, size_t pLength) {
+    //Ensure the manager exists, the pointer is valid and the task can be used
+    if (!mInstance || !pTask || pFile < 0 || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the request
+    std::shared_ptr<Request> request = std::make_shared<Request>(Request::EType::Read);
+    request->task = pTask;
+    request->file = pFile;
+    request->offset = pOffset;
+    request->buffer.resize(pLength);
+
+    //Set the process to return the data once read
+    TaskManager::setProcess<IOBuffer>(*pTask, [request]() -> IOBuffer {
+        if (request->error) request->raiseError();
+        return std::move(request->buffer);
+    });
+
+    //Submit the request
+    if (pLength) submit(request);
+    else { request->self = request; finishRequest(request.get(), 0); }
+    return true;
+}
+
+/*
+    IOManager : write - Write data to a section of an open file for a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - A Task<size_t> object to receive the number of bytes written. Once
+                          added the property values will be uneditable
+    param[in] pFile - The file descriptor to write to. Must remain open until the Task completes
+    param[in] pOffset - The position in the file to start writing at
+    param[in] pData - The data to be written
+
+    return bool - Returns a flag determining if the write was submitted successfully
+*/
+bool AsynchTasks::IOManager::write(Task<size_t>& pTask, int pFile, unsigned long long pOffset, const IOBuffer& pData) {
+    //Ensure the manager exists, the pointer is valid and the task can be used
+    if (!mInstance || !pTask || pFile < 0 || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the request
+    std::shared_ptr<Request> request = std::make_shared<Request>(Request::EType::Write);
+    request->task = pTask;
+    request->file = pFile;
+    request->offset = pOffset;
+    request->buffer = pData;
+
+    //Set the process to return the number of bytes written
+    TaskManager::setProcess<size_t>(*pTask, [request]() -> size_t {
+        if (request->error) request->raiseError();
+        return request->transferred;
+    });
+
+    //Submit the request
+    if (pData.size()) submit(request);
+    else { request->self = request; finishRequest(request.get(), 0); }
+    return true;
+}
+#pragma endregion
+#endif
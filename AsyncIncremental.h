@@ -0,0 +1,734 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <utility>
+#include <condition_variable>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with an incremental computation
+ *      graph, recomputing derived values only when their inputs change.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the type used to identify the cells of the graph
+    typedef unsigned int cellID;
+
+    //! Define the type used to store the version of a cell value
+    typedef unsigned long long int cellVersion;
+
+    //! Define the type erased value stored in a cell
+    typedef std::shared_ptr<const void> cellValue;
+    #pragma endregion
+
+    #pragma region Incremental Graph Decleration
+    /*
+     *      Name: Cell
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Identify a cell of the IncrementalGraph holding a value of type T
+    **/
+    template<class T>
+    struct Cell {
+        //! Store the ID of the cell in the graph
+        cellID id;
+    };
+
+    /*
+     *      Name: IncrementalGraph
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a graph of versioned cells. Input cells are set by the user,
+     *      derived cells are computed from other cells by a Task. Each derived
+     *      cell remembers the versions of the inputs its value was computed
+     *      from, so it is only recomputed when one of them has changed.
+     *
+     *      Setting an input marks every cell that depends on it dirty. Dirty
+     *      cells are added to the TaskManager as soon as none of their inputs
+     *      are dirty or being computed, so cells are recomputed in topological
+     *      order with independent cells computed in parallel. A recomputed
+     *      value that compares equal (==, when T provides it) to the previous
+     *      value keeps its version, stopping the change from propagating.
+     *
+     *      Values are stored immutably and shared, reading a cell never waits
+     *      for it to be recomputed.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      IncrementalGraph. A cell can only depend on cells that already
+     *      exist, so the graph can't contain cycles.
+    **/
+    class IncrementalGraph {
+        //! Prototype the internal node object
+        struct Node;
+
+        /*----------Singleton Values----------*/
+        static IncrementalGraph* mInstance;
+
+        //! Create a lock to prevent the finish hooks using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        IncrementalGraph();
+        ~IncrementalGraph() = default;
+
+        IncrementalGraph(const IncrementalGraph&) = delete;
+        IncrementalGraph& operator=(const IncrementalGraph&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the nodes of the graph, indexed by cell ID
+        std::vector<std::shared_ptr<Node>> mNodes;
+
+        //! Count the cells that are dirty or being computed
+        size_t mPending;
+
+        //! Create a lock to prevent thread clashes over the nodes
+        std::mutex mGraphLock;
+
+        //! Signal the threads waiting for the graph to settle
+        std::condition_variable mSettled;
+
+        /*----------Functions----------*/
+        //! Add a node to the graph
+        cellID addNode(const std::shared_ptr<Node>& pNode, const cellID* pInputs, size_t pCount);
+
+        //! Mark a node and its dependents as dirty
+        void markDirty(Node& pNode);
+
+        //! Add a dirty node to the TaskManager if its inputs are up to date
+        void tryDispatch(Node& pNode);
+
+        //! Store the result of a computed node and dispatch its dependents
+        void finish(Node& pNode);
+
+        //! Retrieve a node by ID
+        static std::shared_ptr<Node> nodeOf(cellID pCell);
+
+        //! Compute a value of T from the type erased input values
+        template<class T, class F, class... In, size_t... I>
+        static cellValue invoke(F& pCompute, const std::vector<cellValue>& pInputs, std::index_sequence<I...>);
+
+        //! Compare two type erased values of T
+        template<class T> static bool sameValue(const void* pFirst, const void* pSecond);
+        template<class T> static auto equal(const T& pFirst, const T& pSecond, int) -> decltype(bool(pFirst == pSecond));
+        template<class T> static bool equal(const T& pFirst, const T& pSecond, long);
+
+    public:
+        //! Main operation functionality
+        static bool create();
+        static void destroy();
+
+        //! Cell options
+        template<class T> static Cell<T> createInput(const T& pValue);
+        template<class T, class F, class... In> static Cell<T> createDerived(F pCompute, const Cell<In>&... pInputs);
+        template<class T> static bool setInput(const Cell<T>& pCell, const T& pValue);
+
+        //! Retrieve the current value, version and error of a cell
+        template<class T> static std::shared_ptr<const T> value(const Cell<T>& pCell);
+        template<class T> static cellVersion version(const Cell<T>& pCell);
+        template<class T> static std::string error(const Cell<T>& pCell);
+
+        //! Retrieve the number of cells that are dirty or being computed
+        static size_t pending();
+
+        //! Wait for all dirty cells to be computed
+        static void wait();
+    };
+    #pragma endregion
+
+    #pragma region Incremental Graph Definitions
+    /*
+     *      Name: Node
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single cell of the graph
+    **/
+    struct IncrementalGraph::Node {
+        //! Store the current value and its version (0 until a derived cell is first computed)
+        cellValue value;
+        cellVersion version;
+
+        //! Store the error of the last computation
+        std::string error;
+
+        //! Store the cells used to compute the value and the cells that use the value
+        std::vector<cellID> inputs;
+        std::vector<cellID> dependents;
+
+        //! Store the versions of the inputs the value was computed from
+        std::vector<cellVersion> computedFrom;
+
+        //! Store the function used to compute the value (empty for input cells)
+        std::function<cellValue(const std::vector<cellValue>&)> compute;
+
+        //! Store the function used to compare values
+        bool(*same)(const void*, const void*);
+
+        //! Store the Task used to compute the value, reused for every computation
+        Task<void> task;
+
+        //! Store the input values and versions given to the running computation and its result
+        std::vector<cellValue> arguments;
+        std::vector<cellVersion> dispatchedFrom;
+        cellValue result;
+
+        //! Flag if the value is out of date or being computed
+        bool dirty;
+        bool running;
+    };
+
+    /*
+        IncrementalGraph : invoke - Compute a value of T from the type erased input values
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pCompute - The user function to call
+        param[in] pInputs - The values of the inputs, in the order of In
+
+        return cellValue - Returns the computed value
+    */
+    template<class T, class F, class... In, size_t... I>
+    inline cellValue IncrementalGraph::invoke(F& pCompute, const std::vector<cellValue>& pInputs, std::index_sequence<I...>) {
+        return std::make_shared<T>(pCompute(*static_cast<const In*>(pInputs[I].get())...));
+    }
+
+    /*
+        IncrementalGraph : sameValue - Compare two type erased values of T
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pFirst - The first value
+        param[in] pSecond - The second value
+
+        return bool - Returns true if T can be compared and the values are equal
+    */
+    template<class T>
+    inline bool IncrementalGraph::sameValue(const void* pFirst, const void* pSecond) {
+        return equal<T>(*static_cast<const T*>(pFirst), *static_cast<const T*>(pSecond), 0);
+    }
+
+    /*
+        IncrementalGraph : equal - Compare two values of a type providing the == operator
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pFirst - The first value
+        param[in] pSecond - The second value
+
+        return bool - Returns true if the values are equal
+    */
+    template<class T>
+    inline auto IncrementalGraph::equal(const T& pFirst, const T& pSecond, int) -> decltype(bool(pFirst == pSecond)) {
+        return pFirst == pSecond;
+    }
+
+    /*
+        IncrementalGraph : equal - Fallback for types that can't be compared
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return bool - Returns false so that every new value is treated as a change
+    */
+    template<class T>
+    inline bool IncrementalGraph::equal(const T&, const T&, long) {
+        return false;
+    }
+
+    /*
+        IncrementalGraph : createInput - Create a cell that is set by the user
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pValue - The initial value of the cell
+
+        return Cell<T> - Returns the new cell
+    */
+    template<class T>
+    inline Cell<T> IncrementalGraph::createInput(const T& pValue) {
+        //Create the node
+        std::shared_ptr<Node> node = std::make_shared<Node>();
+        node->value = std::make_shared<T>(pValue);
+        node->version = 1;
+        node->same = &sameValue<T>;
+        node->dirty = node->running = false;
+
+        //Add the node
+        return { mInstance->addNode(node, nullptr, 0) };
+    }
+
+    /*
+        IncrementalGraph : createDerived - Create a cell computed from other cells
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The cell is computed as soon as it is created. The compute function is called on
+        the Worker threads with const references to the values of the inputs, and must
+        return a value of T
+
+        param[in] pCompute - The function used to compute the value
+        param[in] pInputs - The cells the value is computed from
+
+        return Cell<T> - Returns the new cell
+    */
+    template<class T, class F, class... In>
+    inline Cell<T> IncrementalGraph::createDerived(F pCompute, const Cell<In>&... pInputs) {
+        //Create the node
+        std::shared_ptr<Node> node = std::make_shared<Node>();
+        node->version = 0;
+        node->same = &sameValue<T>;
+        node->dirty = node->running = false;
+        node->compute = [pCompute](const std::vector<cellValue>& pValues) mutable {
+            return invoke<T, F, In...>(pCompute, pValues, std::index_sequence_for<In...>());
+        };
+
+        //Add the node
+        const cellID inputs[] = { pInputs.id..., 0u };
+        return { mInstance->addNode(node, inputs, sizeof...(In)) };
+    }
+
+    /*
+        IncrementalGraph : setInput - Change the value of an input cell
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Cells depending on the input are marked dirty and recomputed. Setting a value equal
+        to the current value has no effect
+
+        param[in] pCell - The input cell to change
+        param[in] pValue - The new value
+
+        return bool - Returns true if the cell is an input cell
+    */
+    template<class T>
+    inline bool IncrementalGraph::setInput(const Cell<T>& pCell, const T& pValue) {
+        //Get the node of the cell
+        std::shared_ptr<Node> node = nodeOf(pCell.id);
+        if (!node || node->compute) return false;
+
+        //Lock the graph
+        std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+
+        //Check the value has changed
+        if (sameValue<T>(node->value.get(), &pValue)) return true;
+
+        //Store the new value
+        node->value = std::make_shared<T>(pValue);
+        ++node->version;
+
+        //Mark the cells using the value as dirty
+        for (cellID dependent : node->dependents) mInstance->markDirty(*mInstance->mNodes[dependent]);
+
+        //Compute the cells that are ready
+        for (cellID dependent : node->dependents) mInstance->tryDispatch(*mInstance->mNodes[dependent]);
+        return true;
+    }
+
+    /*
+        IncrementalGraph : value - Retrieve the current value of a cell
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The value may be out of date while the cell is dirty, use wait to read settled values
+
+        param[in] pCell - The cell to read
+
+        return std::shared_ptr<const T> - Returns the value, or nullptr if the cell hasn't
+                                          been computed
+    */
+    template<class T>
+    inline std::shared_ptr<const T> IncrementalGraph::value(const Cell<T>& pCell) {
+        //Get the node of the cell
+        std::shared_ptr<Node> node = nodeOf(pCell.id);
+        if (!node) return nullptr;
+
+        //Share the value
+        std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+        return std::static_pointer_cast<const T>(node->value);
+    }
+
+    /*
+        IncrementalGraph : version - Retrieve the version of the current value of a cell
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pCell - The cell to check
+
+        return cellVersion - Returns the version, incremented each time the value changes
+                             (0 if the cell hasn't been computed)
+    */
+    template<class T>
+    inline cellVersion IncrementalGraph::version(const Cell<T>& pCell) {
+        //Get the node of the cell
+        std::shared_ptr<Node> node = nodeOf(pCell.id);
+        if (!node) return 0;
+
+        //Read the version
+        std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+        return node->version;
+    }
+
+    /*
+        IncrementalGraph : error - Retrieve the error of the last computation of a cell
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        A cell that fails to compute keeps its previous value
+
+        param[in] pCell - The cell to check
+
+        return std::string - Returns the error message, or an empty string if it succeeded
+    */
+    template<class T>
+    inline std::string IncrementalGraph::error(const Cell<T>& pCell) {
+        //Get the node of the cell
+        std::shared_ptr<Node> node = nodeOf(pCell.id);
+        if (!node) return "";
+
+        //Copy the error
+        std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+        return node->error;
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::IncrementalGraph* AsynchTasks::IncrementalGraph::mInstance = nullptr;
+std::mutex AsynchTasks::IncrementalGraph::mInstanceLock;
+
+#pragma region Incremental Graph Function Definitions
+/*
+    IncrementalGraph : Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::IncrementalGraph::IncrementalGraph() :
+    mPending(0)
+{}
+
+/*
+    IncrementalGraph : addNode - Add a node to the graph and compute it if it is derived
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pNode - The node to add
+    param[in] pInputs - The IDs of the cells the node is computed from
+    param[in] pCount - The number of inputs
+
+    return cellID - Returns the ID of the new cell
+*/
+AsynchTasks::cellID AsynchTasks::IncrementalGraph::addNode(const std::shared_ptr<Node>& pNode, const cellID* pInputs, size_t pCount) {
+    //Lock the graph
+    std::lock_guard<std::mutex> guard(mGraphLock);
+
+    //Link the node to its inputs
+    const cellID id = (cellID)mNodes.size();
+    for (size_t i = 0; i < pCount; i++) {
+        assert(pInputs[i] < id);
+        pNode->inputs.push_back(pInputs[i]);
+        mNodes[pInputs[i]]->dependents.push_back(id);
+    }
+    mNodes.push_back(pNode);
+
+    //Check if the node is computed
+    if (pNode->compute) {
+        //Create the Task used to compute the node
+        std::weak_ptr<Node> weak = pNode;
+        pNode->task = TaskManager::createTask<void>();
+        pNode->task->process = [weak]() {
+            //Compute the value if the graph still exists
+            std::shared_ptr<Node> node = weak.lock();
+            if (node) node->result = node->compute(node->arguments);
+        };
+
+        //Store the result once the computation finishes
+        TaskManager::setFinishHook(*pNode->task, [weak]() {
+            std::lock_guard<std::mutex> guard(mInstanceLock);
+            std::shared_ptr<Node> node = weak.lock();
+            if (!mInstance || !node) return;
+            std::lock_guard<std::mutex> graph(mInstance->mGraphLock);
+            mInstance->finish(*node);
+        });
+
+        //Compute the initial value
+        markDirty(*pNode);
+        tryDispatch(*pNode);
+    }
+    return id;
+}
+
+/*
+    IncrementalGraph : markDirty - Mark a node and every node depending on it as dirty
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The graph lock must be held
+
+    param[in/out] pNode - The node to mark
+*/
+void AsynchTasks::IncrementalGraph::markDirty(Node& pNode) {
+    //Dependents of a dirty node are already dirty
+    if (pNode.dirty) return;
+
+    //Count the node as pending if it isn't being computed
+    if (!pNode.running) ++mPending;
+    pNode.dirty = true;
+
+    //Mark the dependents
+    for (cellID dependent : pNode.dependents) markDirty(*mNodes[dependent]);
+}
+
+/*
+    IncrementalGraph : tryDispatch - Compute a dirty node if all of its inputs are up to date
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A node whose inputs have the same versions it was last computed from is cleaned without
+    being computed, and its dependents are checked in turn
+
+    Requires:
+    The graph lock must be held
+
+    param[in/out] pNode - The node to check
+*/
+void AsynchTasks::IncrementalGraph::tryDispatch(Node& pNode) {
+    //Check the node needs computing and isn't already
+    if (!pNode.dirty || pNode.running) return;
+
+    //Check the inputs are up to date and gather their versions
+    std::vector<cellVersion> versions;
+    versions.reserve(pNode.inputs.size());
+    bool available = true;
+    for (cellID input : pNode.inputs) {
+        const Node& node = *mNodes[input];
+        if (node.dirty || node.running) return;
+        if (!node.version) available = false;
+        versions.push_back(node.version);
+    }
+
+    //Clear the dirty flag
+    pNode.dirty = false;
+
+    //Check if the value needs to be computed
+    if (versions != pNode.computedFrom && available) {
+        //Give the computation the current input values
+        pNode.arguments.clear();
+        for (cellID input : pNode.inputs) pNode.arguments.push_back(mNodes[input]->value);
+        pNode.dispatchedFrom = std::move(versions);
+
+        //Add the Task
+        pNode.running = true;
+        if (TaskManager::addTask(pNode.task)) return;
+
+        //Record the failure to add the Task
+        pNode.running = false;
+        pNode.arguments.clear();
+        pNode.error = "Unable to add the Task computing the cell to the TaskManager";
+    }
+
+    //Record the missing input values
+    else if (!available) pNode.error = "An input of the cell has no value";
+
+    //The node is up to date, check its dependents
+    if (!--mPending) mSettled.notify_all();
+    for (cellID dependent : pNode.dependents) tryDispatch(*mNodes[dependent]);
+}
+
+/*
+    IncrementalGraph : finish - Store the result of a computed node and check its dependents
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The graph lock must be held
+
+    param[in/out] pNode - The node that finished computing
+*/
+void AsynchTasks::IncrementalGraph::finish(Node& pNode) {
+    //Flag the computation as finished
+    pNode.running = false;
+    pNode.arguments.clear();
+    pNode.computedFrom = std::move(pNode.dispatchedFrom);
+
+    //Check if the computation failed, keeping the previous value
+    if (pNode.task->status == ETaskStatus::Error) {
+        pNode.error = pNode.task->error;
+        TaskManager::releaseTask(*pNode.task);
+    }
+
+    //Store the value, only changing the version if it differs
+    else {
+        pNode.error.clear();
+        if (!pNode.value || !pNode.same(pNode.value.get(), pNode.result.get())) {
+            pNode.value = std::move(pNode.result);
+            ++pNode.version;
+        }
+        pNode.result.reset();
+    }
+
+    //Compute the node again if an input changed while it was running
+    if (pNode.dirty) tryDispatch(pNode);
+    else if (!--mPending) mSettled.notify_all();
+
+    //Check the dependents
+    for (cellID dependent : pNode.dependents) tryDispatch(*mNodes[dependent]);
+}
+
+/*
+    IncrementalGraph : nodeOf - Retrieve the node of a cell
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pCell - The ID of the cell
+
+    return std::shared_ptr<Node> - Returns the node, or nullptr if the cell doesn't exist
+*/
+std::shared_ptr<AsynchTasks::IncrementalGraph::Node> AsynchTasks::IncrementalGraph::nodeOf(cellID pCell) {
+    //Check the graph exists
+    if (!mInstance) return nullptr;
+
+    //Find the node
+    std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+    return (pCell < mInstance->mNodes.size() ? mInstance->mNodes[pCell] : nullptr);
+}
+
+/*
+    IncrementalGraph : create - Initialise the graph
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return bool - Returns true if the IncrementalGraph was created successfully
+*/
+bool AsynchTasks::IncrementalGraph::create() {
+    //Assert that the graph doesn't already exist
+    assert(!mInstance);
+
+    //Create the new graph
+    IncrementalGraph* instance = new IncrementalGraph();
+
+    //Test to ensure the instance were created
+    if (!instance) {
+        printf("Unable to create the IncrementalGraph singleton instance.");
+        return false;
+    }
+
+    //Publish the instance
+    mInstanceLock.lock();
+    mInstance = instance;
+    mInstanceLock.unlock();
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    IncrementalGraph : destroy - Delete the graph and all of its cells
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Computations already in the TaskManager are finished but their results are discarded
+
+    Requires:
+    No other thread can be waiting on the graph
+*/
+void AsynchTasks::IncrementalGraph::destroy() {
+    //Take the singleton instance so the finish hooks of running Tasks no longer use it
+    mInstanceLock.lock();
+    IncrementalGraph* instance = mInstance;
+    mInstance = nullptr;
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    IncrementalGraph : pending - Retrieve the number of cells that are dirty or being computed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of cells that are not up to date
+*/
+size_t AsynchTasks::IncrementalGraph::pending() {
+    //Check the graph exists
+    if (!mInstance) return 0;
+
+    //Read the count
+    std::lock_guard<std::mutex> guard(mInstance->mGraphLock);
+    return mInstance->mPending;
+}
+
+/*
+    IncrementalGraph : wait - Block until all of the dirty cells have been computed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    Must not be called from a Task or the TaskManager update, as the cells are finished
+    on the organisation thread
+*/
+void AsynchTasks::IncrementalGraph::wait() {
+    //Check the graph exists
+    if (!mInstance) return;
+
+    //Wait for the pending count to reach zero
+    IncrementalGraph* instance = mInstance;
+    std::unique_lock<std::mutex> guard(instance->mGraphLock);
+    instance->mSettled.wait(guard, [instance]() { return !instance->mPending; });
+}
+#pragma endregion
+#endif
@@ -0,0 +1,494 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncRemote.h"
+
+#include <map>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with snapshots of the live
+ *      TaskManager state and an optional server exposing them.
+**/
+namespace AsynchTasks {
+    #pragma region Introspection Decleration
+    /*
+     *      Name: TaskManagerSnapshot
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a copy of the TaskManager state at a point in time
+    **/
+    struct TaskManagerSnapshot {
+        //! Store the state of a Task that is waiting
+        struct WaitingTask {
+            taskID id;
+            unsigned int priority;
+            double age;             //Seconds since the Task was queued
+        };
+
+        //! Store the state of a Worker
+        struct WorkerState {
+            taskID task;            //0 when no Task is being processed
+            unsigned int priority;
+            double elapsed;         //Seconds the Task has been processed for
+            bool sleeping;
+            unsigned long long completed;
+            unsigned long long failed;
+        };
+
+        //! Store the Workers, in the order they were created
+        std::vector<WorkerState> workers;
+
+        //! Store the Tasks waiting for a Worker, in the order they will be handed out
+        std::vector<WaitingTask> pending;
+
+        //! Store the Tasks waiting for their callback to be called by update
+        std::vector<WaitingTask> callbacks;
+
+        //! Store the counters of the TaskManager
+        TaskMetrics metrics;
+    };
+
+    /*
+     *      Name: Introspection
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Capture snapshots of the TaskManager while it is running and format
+     *      them as plain text or in the Prometheus text format.
+     *
+     *      The Workers publish their state through atomics, so they are never
+     *      locked or paused by a snapshot. The Task lock is held only while the
+     *      waiting Tasks are copied, briefly delaying the organisation thread.
+     *
+     *      The optional server (created with create) listens on a unix or TCP
+     *      socket and answers each connection with a single snapshot. Sending
+     *      "metrics" (or an HTTP GET for /metrics) returns the Prometheus text,
+     *      any other request returns the plain text snapshot.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      Introspection server.
+    **/
+    class Introspection {
+        /*----------Singleton Values----------*/
+        static Introspection* mInstance;
+        Introspection();
+        ~Introspection() = default;
+
+        Introspection(const Introspection&) = delete;
+        Introspection& operator=(const Introspection&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the socket the server listens on
+        int mListener;
+
+        //! Store the address the server listens on, so a unix socket can be removed
+        std::string mAddress;
+
+        //! Flag if the server is operating
+        std::atomic_bool mRunning;
+
+        //! Maintain the thread that answers the connections
+        std::thread mServerThread;
+
+        /*----------Functions----------*/
+        //! Function run on the server thread to answer connections
+        void runServer();
+
+        //! Answer a single connection
+        static void answer(int pSocket);
+
+    public:
+        //! Main operation functionality for the server
+        static bool create(const std::string& pAddress);
+        static void destroy();
+
+        //! Capture the current state of the TaskManager
+        static TaskManagerSnapshot capture();
+
+        //! Format a snapshot for output
+        static std::string toText(const TaskManagerSnapshot& pSnapshot, size_t pMaxListed = 10u);
+        static std::string toPrometheus(const TaskManagerSnapshot& pSnapshot);
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::Introspection* AsynchTasks::Introspection::mInstance = nullptr;
+
+#pragma region Introspection Function Definitions
+/*
+    Introspection : Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::Introspection::Introspection() :
+    mListener(-1),
+    mRunning(false)
+{}
+
+/*
+    Introspection : capture - Copy the current state of the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Safe to call from any thread while the TaskManager is running. The Workers are not locked,
+    so the state of each Worker is read independently of the others
+
+    return TaskManagerSnapshot - Returns the snapshot, empty if the TaskManager doesn't exist
+*/
+AsynchTasks::TaskManagerSnapshot AsynchTasks::Introspection::capture() {
+    //Store the snapshot
+    TaskManagerSnapshot snapshot = {};
+
+    //Check the Task Manager exists
+    TaskManager* manager = TaskManager::mInstance;
+    if (!manager) return snapshot;
+
+    //Store the current time to measure ages against
+    const long long now = std::chrono::steady_clock::now().time_since_epoch().count();
+    const double tick = (double)std::chrono::steady_clock::period::num / (double)std::chrono::steady_clock::period::den;
+
+    //Copy the waiting Tasks
+    manager->mTaskLock.lock();
+    snapshot.pending.reserve(manager->mUncompletedTasks.size());
+    for (auto& task : manager->mUncompletedTasks)
+        snapshot.pending.push_back({ task->id, (unsigned int)task->priority.value(), (double)(now - TaskManager::queuedAt(*task)) * tick });
+    snapshot.callbacks.reserve(manager->mToCallOnUpdate.size());
+    for (auto& task : manager->mToCallOnUpdate)
+        snapshot.callbacks.push_back({ task->id, (unsigned int)task->priority.value(), (double)(now - TaskManager::queuedAt(*task)) * tick });
+    manager->mTaskLock.unlock();
+
+    //Read the state of the Workers
+    snapshot.workers.resize(manager->mWorkerCount);
+    for (unsigned int i = 0; i < manager->mWorkerCount; i++) {
+        TaskManager::Worker& worker = manager->mWorkers[i];
+        TaskManagerSnapshot::WorkerState& state = snapshot.workers[i];
+
+        //Read the active Task, ignoring it if the Worker moved on while reading
+        state.task = worker.activeID.load(std::memory_order_acquire);
+        state.priority = worker.activePriority.load(std::memory_order_relaxed);
+        const long long since = worker.activeSince.load(std::memory_order_relaxed);
+        if (worker.activeID.load(std::memory_order_acquire) != state.task) state.task = 0;
+        state.elapsed = (state.task ? (double)(now - since) * tick : 0.0);
+        if (!state.task) state.priority = 0;
+
+        //Read the counters
+        state.sleeping = worker.sleeping.load(std::memory_order_relaxed);
+        state.completed = worker.completed.load(std::memory_order_relaxed);
+        state.failed = worker.failed.load(std::memory_order_relaxed);
+    }
+
+    //Copy the metrics
+    snapshot.metrics = TaskManager::metrics();
+    return snapshot;
+}
+
+/*
+    Introspection : toText - Format a snapshot as human readable text
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pSnapshot - The snapshot to format
+    param[in] pMaxListed - The maximum number of waiting Tasks listed for each priority (Default 10)
+
+    return std::string - Returns the formatted snapshot
+*/
+std::string AsynchTasks::Introspection::toText(const TaskManagerSnapshot& pSnapshot, size_t pMaxListed) {
+    //Store the output
+    std::string text;
+    char line[256];
+
+    //Output the Workers
+    snprintf(line, sizeof(line), "Workers: %zu\n", pSnapshot.workers.size());
+    text += line;
+    for (size_t i = 0; i < pSnapshot.workers.size(); i++) {
+        const TaskManagerSnapshot::WorkerState& worker = pSnapshot.workers[i];
+        if (worker.task) snprintf(line, sizeof(line), "  [%zu] Busy     Task %llu (priority %u) for %.3fs, %llu completed, %llu failed\n", i, worker.task, worker.priority, worker.elapsed, worker.completed, worker.failed);
+        else snprintf(line, sizeof(line), "  [%zu] %-8s %llu completed, %llu failed\n", i, (worker.sleeping ? "Sleeping" : "Idle"), worker.completed, worker.failed);
+        text += line;
+    }
+
+    //Group the pending Tasks by priority, highest first
+    std::map<unsigned int, std::vector<const TaskManagerSnapshot::WaitingTask*>, std::greater<unsigned int>> priorities;
+    for (auto& task : pSnapshot.pending) priorities[task.priority].push_back(&task);
+
+    //Output the pending Tasks
+    snprintf(line, sizeof(line), "\nPending Tasks: %zu\n", pSnapshot.pending.size());
+    text += line;
+    for (auto& priority : priorities) {
+        double oldest = 0.0;
+        for (auto task : priority.second) oldest = std::max(oldest, task->age);
+        snprintf(line, sizeof(line), "  Priority %u: %zu Tasks, oldest waiting %.3fs\n", priority.first, priority.second.size(), oldest);
+        text += line;
+        for (size_t i = 0; i < priority.second.size() && i < pMaxListed; i++) {
+            snprintf(line, sizeof(line), "    Task %llu waiting %.3fs\n", priority.second[i]->id, priority.second[i]->age);
+            text += line;
+        }
+        if (priority.second.size() > pMaxListed) {
+            snprintf(line, sizeof(line), "    ... %zu more\n", priority.second.size() - pMaxListed);
+            text += line;
+        }
+    }
+
+    //Output the callbacks waiting for update
+    snprintf(line, sizeof(line), "\nCallbacks Waiting: %zu\n", pSnapshot.callbacks.size());
+    text += line;
+    for (size_t i = 0; i < pSnapshot.callbacks.size() && i < pMaxListed; i++) {
+        snprintf(line, sizeof(line), "    Task %llu (priority %u)\n", pSnapshot.callbacks[i].id, pSnapshot.callbacks[i].priority);
+        text += line;
+    }
+
+    //Output the metrics
+    const TaskMetrics& metrics = pSnapshot.metrics;
+    snprintf(line, sizeof(line), "\nMetrics:\n  Queued %llu, Completed %llu, Failed %llu, Retries %llu, Retries Exhausted %llu\n",
+             metrics.tasksQueued, metrics.tasksCompleted, metrics.tasksFailed, metrics.retries, metrics.retriesExhausted);
+    text += line;
+    return text;
+}
+
+/*
+    Introspection : toPrometheus - Format a snapshot in the Prometheus text exposition format
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pSnapshot - The snapshot to format
+
+    return std::string - Returns the formatted metrics
+*/
+std::string AsynchTasks::Introspection::toPrometheus(const TaskManagerSnapshot& pSnapshot) {
+    //Store the output
+    std::string text;
+    char line[256];
+
+    //Add a metric with a single value
+    auto metric = [&](const char* pName, const char* pType, const char* pHelp, double pValue) {
+        snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n%s %.17g\n", pName, pHelp, pName, pType, pName, pValue);
+        text += line;
+    };
+
+    //Output the counters
+    const TaskMetrics& metrics = pSnapshot.metrics;
+    metric("asynchtasks_tasks_queued_total", "counter", "Tasks added to the TaskManager for processing.", (double)metrics.tasksQueued);
+    metric("asynchtasks_tasks_completed_total", "counter", "Tasks processed successfully by the Workers.", (double)metrics.tasksCompleted);
+    metric("asynchtasks_tasks_failed_total", "counter", "Tasks whose process or callback threw on a Worker.", (double)metrics.tasksFailed);
+    metric("asynchtasks_task_retries_total", "counter", "Tasks queued again by their retry policy.", (double)metrics.retries);
+    metric("asynchtasks_task_retries_exhausted_total", "counter", "Tasks that failed after using all of their attempts.", (double)metrics.retriesExhausted);
+
+    //Output the pending Tasks by priority
+    std::map<unsigned int, std::pair<size_t, double>, std::greater<unsigned int>> priorities;
+    for (auto& task : pSnapshot.pending) {
+        auto& priority = priorities[task.priority];
+        ++priority.first;
+        priority.second = std::max(priority.second, task.age);
+    }
+    text += "# HELP asynchtasks_tasks_pending Tasks waiting for a Worker.\n# TYPE asynchtasks_tasks_pending gauge\n";
+    for (auto& priority : priorities) {
+        snprintf(line, sizeof(line), "asynchtasks_tasks_pending{priority=\"%u\"} %zu\n", priority.first, priority.second.first);
+        text += line;
+    }
+    text += "# HELP asynchtasks_tasks_pending_oldest_seconds Age of the oldest Task waiting for a Worker.\n# TYPE asynchtasks_tasks_pending_oldest_seconds gauge\n";
+    for (auto& priority : priorities) {
+        snprintf(line, sizeof(line), "asynchtasks_tasks_pending_oldest_seconds{priority=\"%u\"} %.6f\n", priority.first, priority.second.second);
+        text += line;
+    }
+    metric("asynchtasks_callbacks_waiting", "gauge", "Tasks waiting for their callback to be called by update.", (double)pSnapshot.callbacks.size());
+
+    //Output the Workers
+    text += "# HELP asynchtasks_worker_busy Whether the Worker is processing a Task.\n# TYPE asynchtasks_worker_busy gauge\n";
+    for (size_t i = 0; i < pSnapshot.workers.size(); i++) {
+        snprintf(line, sizeof(line), "asynchtasks_worker_busy{worker=\"%zu\"} %d\n", i, (pSnapshot.workers[i].task ? 1 : 0));
+        text += line;
+    }
+    text += "# HELP asynchtasks_worker_task_elapsed_seconds Time the current Task of the Worker has been processed for.\n# TYPE asynchtasks_worker_task_elapsed_seconds gauge\n";
+    for (size_t i = 0; i < pSnapshot.workers.size(); i++) {
+        snprintf(line, sizeof(line), "asynchtasks_worker_task_elapsed_seconds{worker=\"%zu\"} %.6f\n", i, pSnapshot.workers[i].elapsed);
+        text += line;
+    }
+    text += "# HELP asynchtasks_worker_tasks_completed_total Tasks processed successfully by the Worker.\n# TYPE asynchtasks_worker_tasks_completed_total counter\n";
+    for (size_t i = 0; i < pSnapshot.workers.size(); i++) {
+        snprintf(line, sizeof(line), "asynchtasks_worker_tasks_completed_total{worker=\"%zu\"} %llu\n", i, pSnapshot.workers[i].completed);
+        text += line;
+    }
+    return text;
+}
+
+/*
+    Introspection : runServer - Answer connections until the server is destroyed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::Introspection::runServer() {
+    #ifndef _WIN32
+    //Loop so long as the server is running
+    while (mRunning) {
+        //Wait for a connection, checking the running flag periodically
+        pollfd listener = { mListener, POLLIN, 0 };
+        if (poll(&listener, 1, 100) <= 0 || !(listener.revents & POLLIN)) continue;
+
+        //Answer the connection
+        int file = accept(mListener, nullptr, nullptr);
+        if (file < 0) continue;
+        fcntl(file, F_SETFD, FD_CLOEXEC);
+        answer(file);
+        close(file);
+    }
+    #endif
+}
+
+/*
+    Introspection : answer - Read the request of a connection and write the snapshot
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pSocket - The connected socket
+*/
+void AsynchTasks::Introspection::answer(int pSocket) {
+    #ifndef _WIN32
+    //Read the first line of the request, waiting at most a second
+    std::string request;
+    char buffer[512];
+    while (request.find('\n') == std::string::npos && request.size() < 4096) {
+        pollfd file = { pSocket, POLLIN, 0 };
+        if (poll(&file, 1, 1000) <= 0) break;
+        ssize_t count = recv(pSocket, buffer, sizeof(buffer), 0);
+        if (count <= 0) break;
+        request.append(buffer, (size_t)count);
+    }
+    request = request.substr(0, request.find_first_of("\r\n"));
+
+    //Format the requested snapshot
+    const bool http = !request.compare(0, 4, "GET ");
+    const bool prometheus = (http ? !request.compare(4, 8, "/metrics") : request == "metrics");
+    const TaskManagerSnapshot snapshot = capture();
+    std::string response = (prometheus ? toPrometheus(snapshot) : toText(snapshot));
+
+    //Add the HTTP header
+    if (http) {
+        response = std::string("HTTP/1.0 200 OK\r\nContent-Type: ") + (prometheus ? "text/plain; version=0.0.4" : "text/plain") +
+                   "\r\nContent-Length: " + std::to_string(response.size()) + "\r\nConnection: close\r\n\r\n" + response;
+    }
+
+    //Write the response without blocking, waiting at most a second for the client to drain it
+    size_t sent = 0;
+    while (sent < response.size()) {
+        pollfd file = { pSocket, POLLOUT, 0 };
+        if (poll(&file, 1, 1000) <= 0) break;
+        #ifdef MSG_NOSIGNAL
+        ssize_t count = send(pSocket, response.data() + sent, response.size() - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+        #else
+        ssize_t count = send(pSocket, response.data() + sent, response.size() - sent, MSG_DONTWAIT);
+        #endif
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) continue;
+        if (count <= 0) break;
+        sent += (size_t)count;
+    }
+    #endif
+}
+
+/*
+    Introspection : create - Start the introspection server
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Snapshots can be captured without creating the server
+
+    param[in] pAddress - The address to listen on, in the form "unix:path" or "tcp:host:port"
+
+    return bool - Returns true if the server is listening
+*/
+bool AsynchTasks::Introspection::create(const std::string& pAddress) {
+    //Assert that the server doesn't already exist
+    assert(!mInstance);
+
+    //Create the new server
+    mInstance = new Introspection();
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the Introspection singleton instance.");
+        return false;
+    }
+
+    //Open the listening socket
+    std::string error;
+    mInstance->mAddress = pAddress;
+    mInstance->mListener = RemoteProtocol::listenOn(pAddress, error);
+    if (mInstance->mListener < 0) {
+        printf("%s\n", error.c_str());
+        destroy();
+        return false;
+    }
+
+    //Start the server thread
+    mInstance->mRunning = true;
+    Introspection* instance = mInstance;
+    mInstance->mServerThread = std::thread([instance]() {
+        //Call the server function
+        instance->runServer();
+    });
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    Introspection : destroy - Stop the introspection server
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::Introspection::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        //Stop the server thread
+        mInstance->mRunning = false;
+        if (mInstance->mServerThread.get_id() != std::thread::id())
+            mInstance->mServerThread.join();
+
+        //Close the listening socket
+        #ifndef _WIN32
+        if (mInstance->mListener >= 0) {
+            close(mInstance->mListener);
+            if (!mInstance->mAddress.compare(0, 5, "unix:")) unlink(mInstance->mAddress.c_str() + 5);
+        }
+        #endif
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+#pragma endregion
+#endif
@@ -0,0 +1,744 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+#include "AsyncSerialisable.h"
+
+#include <unordered_map>
+#include <algorithm>
+#include <condition_variable>
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a durable journal of
+ *      serialisable Tasks, allowing the Tasks that were pending when the
+ *      process stopped to be replayed when it is next started.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the function used to set up a Task that is replayed from the journal
+    typedef std::function<void(Task<IOBuffer>& pTask, taskKind pKind)> journalReplay;
+    #pragma endregion
+
+    #pragma region Task Journal Decleration
+    /*
+     *      Name: TaskJournal
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Record the submission and completion of serialisable Tasks in an
+     *      append only log that is memory mapped. Appending a record is a copy
+     *      into the mapping under a short lock, the mapped pages are written
+     *      to disk by a commit thread that syncs everything appended since
+     *      the last commit at once (group commit).
+     *
+     *      When the journal is created, the Tasks that were submitted but
+     *      never finished are submitted again in their original order. The
+     *      log is compacted down to the pending Tasks when it fills up.
+     *
+     *      Records that were appended but not yet committed survive the
+     *      process dying (they are in the page cache), only a failure of the
+     *      machine can lose them. Use flush to wait until they are on disk.
+     *
+     *      Requires:
+     *      POSIX only. The TaskManager must be created before and destroyed
+     *      after the TaskJournal. Kinds must be registered with the
+     *      TaskRegistry before the journal is created so pending Tasks can
+     *      be replayed, Tasks of unregistered kinds remain in the journal.
+    **/
+    class TaskJournal {
+        //! Prototype the internal record object
+        struct Record;
+
+        /*----------Singleton Values----------*/
+        static TaskJournal* mInstance;
+
+        //! Create a lock to prevent the finish hooks using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        TaskJournal(const std::string& pPath, unsigned int pCommitInterval);
+        ~TaskJournal() = default;
+
+        TaskJournal() = delete;
+        TaskJournal(const TaskJournal&) = delete;
+        TaskJournal& operator=(const TaskJournal&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the path of the journal file
+        const std::string mPath;
+
+        //! Keep as a constant the number of milliseconds between commits
+        const unsigned int mCommitInterval;
+
+        //! Store the descriptor and mapping of the journal file
+        int mFile;
+        char* mMemory;
+        size_t mCapacity;
+
+        //! Store the offset that the next record is appended at
+        size_t mTail;
+
+        //! Store the offset that has been committed to disk
+        size_t mCommitted;
+
+        //! Count the bytes appended and committed over the life of the journal
+        unsigned long long mAppended;
+        unsigned long long mDurable;
+
+        //! Store the ID to give the next Task
+        unsigned long long mNextID;
+
+        //! Store the offsets of the submission records of the pending Tasks, by ID
+        std::unordered_map<unsigned long long, size_t> mPending;
+
+        //! Create a lock to prevent thread clashes over the log
+        std::mutex mLogLock;
+
+        //! Create a lock held while the mapping is in use outside of the log lock
+        std::mutex mCommitLock;
+
+        //! Signal the commit thread and the threads waiting for a commit
+        std::condition_variable mCommitCondition;
+        std::condition_variable mDurableCondition;
+
+        //! Flag if the journal is operating
+        bool mRunning;
+
+        //! Maintain the thread that commits the log
+        std::thread mCommitThread;
+
+        /*----------Functions----------*/
+        //! Function run on the commit thread to sync the log
+        void runCommits();
+
+        //! Add a record to the log
+        unsigned long long append(unsigned char pType, unsigned long long pID, taskKind pKind, const char* pData, size_t pSize);
+
+        //! Rewrite the log with only the pending Tasks
+        bool compact(size_t pRequired);
+
+        //! Open a mapped journal file
+        static char* mapFile(const std::string& pPath, size_t& pCapacity, int& pFile);
+
+        //! Read the records of a mapped journal
+        static size_t readRecord(const char* pMemory, size_t pCapacity, size_t pOffset, Record& pRecord);
+
+        //! Attach the finish hook that records the completion of a Task
+        static void watchTask(Task<IOBuffer>& pTask, unsigned long long pID);
+
+    public:
+        //! Main operation functionality
+        static bool create(const std::string& pPath, const journalReplay& pOnReplay = nullptr, size_t pCapacity = 16u * 1024u * 1024u, unsigned int pCommitInterval = 2u);
+        static void destroy();
+
+        //! Submission options
+        static bool submit(Task<IOBuffer>& pTask, taskKind pKind, const IOBuffer& pPayload);
+
+        //! Wait until everything appended has been committed to disk
+        static void flush();
+
+        //! Retrieve the number of Tasks that have not finished
+        static size_t pending();
+    };
+    #pragma endregion
+
+    #pragma region Record Definition
+    /*
+     *      Name: Record
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe the header of a single record in the journal. Records are
+     *      followed by their payload and padded to 8 bytes. A zero type marks
+     *      the end of the log
+    **/
+    struct TaskJournal::Record {
+        //! Label the types of record
+        enum EType : unsigned char { End, Submission, Completion };
+
+        //! Store the size of the payload after the header
+        unsigned int size;
+
+        //! Store the type of the record
+        unsigned char type;
+        unsigned char padding[3];
+
+        //! Store the ID of the Task the record is for
+        unsigned long long id;
+
+        //! Store the kind of the Task (Submission only)
+        taskKind kind;
+
+        //! Store a checksum of the header and payload, used to detect a torn write
+        unsigned int checksum;
+
+        //! Retrieve the number of bytes used by a record with a payload
+        inline static size_t recordSize(size_t pSize) { return (sizeof(Record) + pSize + 7) & ~(size_t)7; }
+
+        //! Calculate the checksum of a record
+        static unsigned int calculate(const Record& pRecord, const char* pData);
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::TaskJournal* AsynchTasks::TaskJournal::mInstance = nullptr;
+std::mutex AsynchTasks::TaskJournal::mInstanceLock;
+
+#pragma region Task Journal Function Definitions
+/*
+    Record : calculate - Calculate the checksum of a record header and its payload
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pRecord - The header of the record. The checksum value is ignored
+    param[in] pData - A pointer to the payload of the record
+
+    return unsigned int - Returns the FNV-1a hash of the record
+*/
+unsigned int AsynchTasks::TaskJournal::Record::calculate(const Record& pRecord, const char* pData) {
+    //Hash the header without the checksum
+    Record header = pRecord;
+    header.checksum = 0;
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(Record); i++) hash = (hash ^ (unsigned char)((const char*)&header)[i]) * 16777619u;
+
+    //Hash the payload
+    for (size_t i = 0; i < pRecord.size; i++) hash = (hash ^ (unsigned char)pData[i]) * 16777619u;
+    return hash;
+}
+
+/*
+    TaskJournal : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPath - The path of the journal file
+    param[in] pCommitInterval - The number of milliseconds between commits
+*/
+AsynchTasks::TaskJournal::TaskJournal(const std::string& pPath, unsigned int pCommitInterval) :
+    mPath(pPath),
+    mCommitInterval(pCommitInterval),
+    mFile(-1),
+    mMemory(nullptr),
+    mCapacity(0),
+    mTail(0),
+    mCommitted(0),
+    mAppended(0),
+    mDurable(0),
+    mNextID(1),
+    mRunning(false)
+{}
+
+/*
+    TaskJournal : runCommits - Sync the appended records to disk until the journal is destroyed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TaskJournal::runCommits() {
+    #ifndef _WIN32
+    //Retrieve the page size for aligning the synced range
+    const size_t PAGE_SIZE = (size_t)sysconf(_SC_PAGESIZE);
+
+    //Loop so long as the journal is running
+    std::unique_lock<std::mutex> log(mLogLock);
+    while (mRunning || mAppended != mDurable) {
+        //Wait for the next commit
+        if (mRunning && mAppended == mDurable)
+            mCommitCondition.wait_for(log, std::chrono::milliseconds(mCommitInterval));
+        if (mAppended == mDurable) continue;
+
+        //Take the range to commit
+        unsigned long long appended = mAppended;
+        size_t start = mCommitted & ~(PAGE_SIZE - 1), end = mTail;
+        char* memory = mMemory;
+
+        //Hold the mapping while syncing without blocking appends
+        log.unlock();
+        mCommitLock.lock();
+        if (memory == mMemory) msync(memory + start, end - start, MS_SYNC);
+        mCommitLock.unlock();
+        log.lock();
+
+        //Mark the range as committed, unless the log was compacted in the meantime
+        if (memory == mMemory && appended > mDurable) {
+            mCommitted = end;
+            mDurable = appended;
+        }
+        mDurableCondition.notify_all();
+    }
+    #endif
+}
+
+/*
+    TaskJournal : append - Add a record to the end of the log
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pType - The type of the record
+    param[in] pID - The ID of the Task (0 to assign a new ID)
+    param[in] pKind - The kind of the Task
+    param[in] pData - A pointer to the payload of the record
+    param[in] pSize - The number of bytes in the payload
+
+    return unsigned long long - Returns the ID of the Task or 0 if the record couldn't be added
+*/
+unsigned long long AsynchTasks::TaskJournal::append(unsigned char pType, unsigned long long pID, taskKind pKind, const char* pData, size_t pSize) {
+    //Get the size of the record, leaving space for the end marker
+    const size_t size = Record::recordSize(pSize);
+
+    //Lock the log
+    std::unique_lock<std::mutex> log(mLogLock);
+
+    //Make space for the record
+    if (mTail + size + sizeof(Record) > mCapacity) {
+        //The commit lock is taken first to match the commit thread
+        log.unlock();
+        std::lock_guard<std::mutex> guard(mCommitLock);
+        log.lock();
+        if (mTail + size + sizeof(Record) > mCapacity && !compact(size + sizeof(Record))) return 0;
+    }
+
+    //Completion of a Task no longer in the log (compacted away) doesn't need to be recorded
+    if (pType == Record::Completion && !mPending.erase(pID)) return pID;
+
+    //Fill out the header
+    Record record;
+    memset(&record, 0, sizeof(record));
+    record.size = (unsigned int)pSize;
+    record.type = pType;
+    record.id = (pID ? pID : mNextID++);
+    record.kind = pKind;
+    record.checksum = Record::calculate(record, pData);
+
+    //Copy the record into the log, the payload is written before the header
+    if (pSize) memcpy(mMemory + mTail + sizeof(Record), pData, pSize);
+    memcpy(mMemory + mTail, &record, sizeof(Record));
+
+    //Track the pending Tasks
+    if (pType == Record::Submission) mPending[record.id] = mTail;
+
+    //Move the tail
+    mTail += size;
+    mAppended += size;
+    return record.id;
+}
+
+/*
+    TaskJournal : compact - Rewrite the log so that it contains only the pending Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The commit and log locks must be held
+
+    Note:
+    The new log is written to a separate file which replaces the journal once synced, so the
+    journal is never left without the pending Tasks. The capacity is doubled when the pending
+    Tasks would fill more than half of the log
+
+    param[in] pRequired - The number of free bytes required after compacting
+
+    return bool - Returns true if the log was compacted
+*/
+bool AsynchTasks::TaskJournal::compact(size_t pRequired) {
+    #ifndef _WIN32
+    //Order the pending Tasks by submission
+    std::vector<std::pair<unsigned long long, size_t>> pending(mPending.begin(), mPending.end());
+    std::sort(pending.begin(), pending.end());
+
+    //Find the size of the pending Tasks
+    size_t used = 0;
+    for (auto& entry : pending) used += Record::recordSize(((const Record*)(mMemory + entry.second))->size);
+
+    //Determine the capacity of the new log
+    size_t capacity = mCapacity;
+    while ((used + pRequired) * 2 > capacity) capacity *= 2;
+
+    //Create the new log
+    std::string path = mPath + ".compact";
+    unlink(path.c_str());
+    int file = -1;
+    char* memory = mapFile(path, capacity, file);
+    if (!memory) return false;
+
+    //Copy the pending Tasks
+    size_t tail = 0;
+    for (auto& entry : pending) {
+        size_t size = Record::recordSize(((const Record*)(mMemory + entry.second))->size);
+        memcpy(memory + tail, mMemory + entry.second, size);
+        entry.second = tail;
+        tail += size;
+    }
+
+    //Commit the new log and replace the journal with it
+    if (msync(memory, std::max(tail, (size_t)1), MS_SYNC) < 0 || fsync(file) < 0 || rename(path.c_str(), mPath.c_str()) < 0) {
+        munmap(memory, capacity);
+        close(file);
+        unlink(path.c_str());
+        return false;
+    }
+
+    //Swap to the new log
+    munmap(mMemory, mCapacity);
+    close(mFile);
+    mMemory = memory;
+    mFile = file;
+    mCapacity = capacity;
+    mTail = mCommitted = tail;
+    mDurable = mAppended;
+    mPending.clear();
+    mPending.insert(pending.begin(), pending.end());
+    mDurableCondition.notify_all();
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/*
+    TaskJournal : mapFile - Open and map a journal file, creating it if required
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPath - The path of the journal file
+    param[in/out] pCapacity - The minimum size of the mapping. Set to the size mapped
+    param[out] pFile - The descriptor of the opened file
+
+    return char* - Returns a pointer to the mapping or nullptr on failure
+*/
+char* AsynchTasks::TaskJournal::mapFile(const std::string& pPath, size_t& pCapacity, int& pFile) {
+    #ifndef _WIN32
+    //Open the file
+    pFile = open(pPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (pFile < 0) return nullptr;
+
+    //Grow the file to the capacity, unused space is left zero filled
+    struct stat info;
+    if (fstat(pFile, &info) == 0 && (size_t)info.st_size > pCapacity) pCapacity = (size_t)info.st_size;
+    if (ftruncate(pFile, (off_t)pCapacity) < 0) {
+        close(pFile);
+        return nullptr;
+    }
+
+    //Map the file, populating the pages up front so appends don't fault
+    #ifdef MAP_POPULATE
+    void* memory = mmap(nullptr, pCapacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pFile, 0);
+    #else
+    void* memory = mmap(nullptr, pCapacity, PROT_READ | PROT_WRITE, MAP_SHARED, pFile, 0);
+    #endif
+    if (memory == MAP_FAILED) {
+        close(pFile);
+        return nullptr;
+    }
+    return (char*)memory;
+    #else
+    return nullptr;
+    #endif
+}
+
+/*
+    TaskJournal : readRecord - Read the header of a record from a mapped journal
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pMemory - A pointer to the mapped journal
+    param[in] pCapacity - The size of the mapping
+    param[in] pOffset - The offset of the record
+    param[out] pRecord - The header of the record
+
+    return size_t - Returns the offset of the next record or 0 if this is the end of the
+                    log (or the record was torn)
+*/
+size_t AsynchTasks::TaskJournal::readRecord(const char* pMemory, size_t pCapacity, size_t pOffset, Record& pRecord) {
+    //Check there is space for a header
+    if (pOffset + sizeof(Record) > pCapacity) return 0;
+
+    //Read the header
+    memcpy(&pRecord, pMemory + pOffset, sizeof(Record));
+    if (pRecord.type != Record::Submission && pRecord.type != Record::Completion) return 0;
+
+    //Validate the record
+    size_t next = pOffset + Record::recordSize(pRecord.size);
+    if (next > pCapacity || next <= pOffset || Record::calculate(pRecord, pMemory + pOffset + sizeof(Record)) != pRecord.checksum) return 0;
+    return next;
+}
+
+/*
+    TaskJournal : watchTask - Record the completion of a Task when it finishes
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - The Task to watch
+    param[in] pID - The ID of the Task in the journal
+*/
+void AsynchTasks::TaskJournal::watchTask(Task<IOBuffer>& pTask, unsigned long long pID) {
+    //The Task is held by the TaskManager while the hook is raised
+    Asynch_Task_Base* task = pTask.get();
+    TaskManager::setFinishHook(*task, [task, pID]() {
+        //Record the completion, Tasks that errored are finished as well
+        mInstanceLock.lock();
+        if (mInstance) mInstance->append(Record::Completion, pID, 0, nullptr, 0);
+        mInstanceLock.unlock();
+
+        //Remove the hook so that re-using the Task isn't recorded
+        TaskManager::setFinishHook(*task, nullptr);
+    });
+}
+
+/*
+    TaskJournal : create - Open the journal and replay the Tasks that were pending
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPath - The path of the journal file
+    param[in] pOnReplay - An optional function called for each replayed Task before it is
+                          submitted, used to set the callback (Default nullptr)
+    param[in] pCapacity - The initial size of the log in bytes (Default 16MB)
+    param[in] pCommitInterval - The number of milliseconds between commits (Default 2)
+
+    return bool - Returns true if the TaskJournal was created successfully
+*/
+bool AsynchTasks::TaskJournal::create(const std::string& pPath, const journalReplay& pOnReplay, size_t pCapacity, unsigned int pCommitInterval) {
+    //Assert that the journal doesn't already exist
+    assert(!mInstance);
+
+    #ifndef _WIN32
+    //Create the new journal
+    mInstance = new TaskJournal(pPath, (pCommitInterval ? pCommitInterval : 1u));
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the TaskJournal singleton instance.");
+        return false;
+    }
+
+    //Open the journal
+    mInstance->mCapacity = std::max(pCapacity, (size_t)64u * 1024u);
+    mInstance->mMemory = mapFile(pPath, mInstance->mCapacity, mInstance->mFile);
+    if (!mInstance->mMemory) {
+        printf("Unable to open the journal file '%s': %s\n", pPath.c_str(), strerror(errno));
+        destroy();
+        return false;
+    }
+
+    //Read the existing records
+    Record record;
+    size_t offset = 0, next;
+    while ((next = readRecord(mInstance->mMemory, mInstance->mCapacity, offset, record))) {
+        //Track the pending Tasks
+        if (record.type == Record::Submission) mInstance->mPending[record.id] = offset;
+        else mInstance->mPending.erase(record.id);
+
+        //Continue the IDs after the last Task
+        mInstance->mNextID = std::max(mInstance->mNextID, record.id + 1);
+        offset = next;
+    }
+    mInstance->mTail = offset;
+
+    //Start from a compacted log, removing finished Tasks and any torn record
+    {
+        std::lock_guard<std::mutex> commit(mInstance->mCommitLock);
+        std::lock_guard<std::mutex> log(mInstance->mLogLock);
+        if (!mInstance->compact(0)) {
+            printf("Unable to compact the journal file '%s': %s\n", pPath.c_str(), strerror(errno));
+            destroy();
+            return false;
+        }
+    }
+
+    //Start the commit thread
+    mInstance->mRunning = true;
+    TaskJournal* instance = mInstance;
+    mInstance->mCommitThread = std::thread([instance]() {
+        //Call the commit function, the instance is taken before destroy clears it
+        instance->runCommits();
+    });
+
+    //Copy the pending submissions out of the log, replayed Tasks append to it (and can remap it) as they finish
+    struct Replay { unsigned long long id; taskKind kind; IOBuffer payload; };
+    std::vector<Replay> replays;
+    {
+        std::lock_guard<std::mutex> log(mInstance->mLogLock);
+        replays.reserve(mInstance->mPending.size());
+        for (auto& entry : mInstance->mPending) {
+            const Record* submission = (const Record*)(mInstance->mMemory + entry.second);
+            const char* payload = (const char*)(submission + 1);
+            replays.push_back({ entry.first, submission->kind, IOBuffer(payload, payload + submission->size) });
+        }
+    }
+
+    //Order the pending Tasks by submission
+    std::sort(replays.begin(), replays.end(), [](const Replay& pLeft, const Replay& pRight) { return pLeft.id < pRight.id; });
+
+    //Replay the pending Tasks
+    for (auto& replay : replays) {
+        //Skip kinds that are no longer registered
+        if (!TaskRegistry::isRegistered(replay.kind)) continue;
+
+        //Allow the Task to be set up
+        Task<IOBuffer> task = TaskManager::createTask<IOBuffer>();
+        if (pOnReplay) pOnReplay(task, replay.kind);
+
+        //Submit the Task again under its original ID
+        watchTask(task, replay.id);
+        if (!TaskRegistry::addTask(task, replay.kind, std::move(replay.payload)))
+            TaskManager::setFinishHook(*task, nullptr);
+    }
+
+    //Return creation was completed successfully
+    return true;
+    #else
+    printf("The TaskJournal is not supported on this platform");
+    return false;
+    #endif
+}
+
+/*
+    TaskJournal : destroy - Commit the log and close the journal
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Tasks that haven't finished (including those still being processed) remain in the
+    journal and are replayed by the next create
+*/
+void AsynchTasks::TaskJournal::destroy() {
+    //Take the singleton instance so the finish hooks of running Tasks no longer use it
+    mInstanceLock.lock();
+    TaskJournal* instance = mInstance;
+    mInstance = nullptr;
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Stop the commit thread, committing what remains
+        instance->mLogLock.lock();
+        instance->mRunning = false;
+        instance->mCommitCondition.notify_all();
+        instance->mLogLock.unlock();
+        if (instance->mCommitThread.get_id() != std::thread::id())
+            instance->mCommitThread.join();
+
+        //Close the journal
+        #ifndef _WIN32
+        if (instance->mMemory) munmap(instance->mMemory, instance->mCapacity);
+        if (instance->mFile >= 0) close(instance->mFile);
+        #endif
+
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    TaskJournal : submit - Record a serialisable Task in the journal and process it on the
+                           Workers of the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The completion of the Task is recorded once it has finished, including the callback
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the result. Once added the property
+                          values will be uneditable
+    param[in] pKind - The kind of the Task
+    param[in] pPayload - The payload to process
+
+    return bool - Returns a flag determining if the Task was submitted successfully
+*/
+bool AsynchTasks::TaskJournal::submit(Task<IOBuffer>& pTask, taskKind pKind, const IOBuffer& pPayload) {
+    //Ensure the journal exists and the Task can be added
+    if (!mInstance || !pTask || !TaskRegistry::isRegistered(pKind) ||
+        (pTask->status != ETaskStatus::Setup && pTask->status != ETaskStatus::Completed)) return false;
+
+    //Record the submission
+    unsigned long long id = mInstance->append(Record::Submission, 0, pKind, pPayload.data(), pPayload.size());
+    if (!id) return false;
+
+    //Add the Task, recording its completion if it couldn't be added
+    watchTask(pTask, id);
+    if (!TaskRegistry::addTask(pTask, pKind, pPayload)) {
+        TaskManager::setFinishHook(*pTask, nullptr);
+        mInstance->append(Record::Completion, id, 0, nullptr, 0);
+        return false;
+    }
+    return true;
+}
+
+/*
+    TaskJournal : flush - Wait until all of the records appended so far have been committed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TaskJournal::flush() {
+    //Check the journal exists
+    if (!mInstance) return;
+
+    //Request a commit and wait for it
+    std::unique_lock<std::mutex> log(mInstance->mLogLock);
+    unsigned long long target = mInstance->mAppended;
+    mInstance->mCommitCondition.notify_all();
+    while (mInstance->mDurable < target) mInstance->mDurableCondition.wait(log);
+}
+
+/*
+    TaskJournal : pending - Retrieve the number of Tasks in the journal that haven't finished
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of pending Tasks
+*/
+size_t AsynchTasks::TaskJournal::pending() {
+    //Check the journal exists
+    if (!mInstance) return 0;
+
+    //Count the pending Tasks
+    std::lock_guard<std::mutex> guard(mInstance->mLogLock);
+    return mInstance->mPending.size();
+}
+#pragma endregion
+#endif
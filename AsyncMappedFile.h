@@ -0,0 +1,389 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <string.h>
+#include <errno.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with helpers for processing
+ *      large files in parallel directly from a memory mapping.
+**/
+namespace AsynchTasks {
+    #pragma region Mapped File Decleration
+    /*
+     *      Name: MappedFile
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Map the contents of a file into memory for reading for the
+     *      lifetime of the object.
+    **/
+    class MappedFile {
+        /*----------Variables----------*/
+        //! Store the start and size of the mapped contents
+        const char* mData;
+        size_t mSize;
+
+        //! Store the handles of the open file
+        #ifdef _WIN32
+        HANDLE mFile;
+        HANDLE mMapping;
+        #else
+        int mFile;
+        #endif
+
+        //! Store the description of an error that occurred when mapping the file
+        std::string mError;
+
+    public:
+        //! Map the file on construction and unmap on destruction
+        MappedFile(const std::string& pPath);
+        ~MappedFile();
+
+        //! Prevent copying of the mapping
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        //! Retrieve the state of the mapping
+        inline bool isOpen() const { return mError.empty(); }
+        inline const std::string& error() const { return mError; }
+
+        //! Retrieve the mapped contents
+        inline const char* data() const { return mData; }
+        inline size_t size() const { return mSize; }
+    };
+    #pragma endregion
+
+    #pragma region Mapped File Processor Decleration
+    /*
+     *      Name: MappedFileProcessor
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Process a large file in parallel across the Workers. The file is
+     *      memory mapped and split into chunks that end on a record delimiter,
+     *      each chunk is processed on a Worker directly from the mapping (the
+     *      contents are never copied) and the per-chunk results are merged
+     *      in file order once all chunks have been processed.
+     *
+     *      Requires:
+     *      The chunk result type must be default constructible (and not bool, as
+     *      the results are written concurrently to a std::vector). The TaskManager
+     *      must be created before processing a file.
+    **/
+    class MappedFileProcessor {
+        //! Prototype the internal job object
+        template<class TChunk, class TResult> struct Job;
+
+        //! Complete a job once all of its chunks have been processed
+        template<class TChunk, class TResult> static void finishJob(const std::shared_ptr<Job<TChunk, TResult>>& pJob);
+
+    public:
+        //! Define the default size of the chunks the file is split into
+        static const size_t DEFAULT_CHUNK_SIZE = 16u * 1024u * 1024u;
+
+        //! Processing options
+        template<class TChunk, class TResult>
+        static bool process(Task<TResult>& pTask, const std::string& pPath,
+                            const std::function<TChunk(const char* pBegin, const char* pEnd)>& pProcess,
+                            const std::function<void(TResult& pResult, TChunk& pChunk)>& pMerge,
+                            char pDelimiter = '\n', size_t pChunkSize = DEFAULT_CHUNK_SIZE);
+    };
+    #pragma endregion
+
+    #pragma region Mapped File Processor Templated Definitions
+    /*
+     *      Name: Job
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state shared by the chunks of a single file
+    **/
+    template<class TChunk, class TResult>
+    struct MappedFileProcessor::Job {
+        //! Store the Task to add once the chunks are processed
+        Task<TResult> task;
+
+        //! Store the mapping of the file
+        std::shared_ptr<MappedFile> file;
+
+        //! Store the functions used to process chunks and merge the results
+        std::function<TChunk(const char*, const char*)> process;
+        std::function<void(TResult&, TChunk&)> merge;
+
+        //! Store the results of each chunk in file order
+        std::vector<TChunk> results;
+
+        //! Track the number of chunks that are yet to finish
+        std::atomic<unsigned int> remaining;
+
+        //! Store the first error raised while processing the chunks
+        std::mutex errorLock;
+        std::string error;
+    };
+
+    /*
+        MappedFileProcessor : finishJob - Add the Task of a job to merge the chunk results
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pJob - The job that has finished processing its chunks
+    */
+    template<class TChunk, class TResult>
+    inline void MappedFileProcessor::finishJob(const std::shared_ptr<Job<TChunk, TResult>>& pJob) {
+        //Take the Task from the job so the merge process doesn't keep the job alive
+        Task<TResult> task = std::move(pJob->task);
+
+        //Set the process to merge the results in order
+        std::shared_ptr<Job<TChunk, TResult>> job = pJob;
+        TaskManager::setProcess<TResult>(*task, [job]() -> TResult {
+            //Check for a failed chunk
+            if (job->error.size()) throw std::runtime_error(job->error);
+
+            //Merge the results
+            TResult result = TResult();
+            for (size_t i = 0; i < job->results.size(); i++)
+                job->merge(result, job->results[i]);
+
+            //Release the chunk results and the mapping
+            job->results.clear();
+            job->file.reset();
+            return result;
+        });
+
+        //Hand the Task to the Workers to merge the results
+        TaskManager::queueTask(task);
+    }
+
+    /*
+        MappedFileProcessor : process - Process a file in parallel chunks and merge the results
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Each chunk ends directly after a delimiter (or at the end of the file) so records are
+        never split between chunks. A chunk may be larger than pChunkSize if a record spans
+        the boundary. The chunks are processed with the priority of the Task.
+
+        param[in/out] pTask - A Task<TResult> object to receive the merged result. Once added
+                              the property values will be uneditable
+        param[in] pPath - The path of the file to process
+        param[in] pProcess - The function used to process a chunk of the file, called on a Worker
+        param[in] pMerge - The function used to merge a chunk result into the final result,
+                           called in file order
+        param[in] pDelimiter - The character that ends each record (Default '\n')
+        param[in] pChunkSize - The approximate number of bytes in each chunk (Default 16MB)
+
+        return bool - Returns a flag determining if the file was submitted successfully
+    */
+    template<class TChunk, class TResult>
+    inline bool MappedFileProcessor::process(Task<TResult>& pTask, const std::string& pPath,
+                                             const std::function<TChunk(const char*, const char*)>& pProcess,
+                                             const std::function<void(TResult&, TChunk&)>& pMerge,
+                                             char pDelimiter, size_t pChunkSize) {
+        //Ensure that the pointer is valid and the functions are set
+        if (!pTask || !pProcess || !pMerge || !pChunkSize || !TaskManager::lockTask(*pTask)) return false;
+
+        //Create the job
+        std::shared_ptr<Job<TChunk, TResult>> job = std::make_shared<Job<TChunk, TResult>>();
+        job->task = pTask;
+        job->process = pProcess;
+        job->merge = pMerge;
+
+        //Map the file
+        job->file = std::make_shared<MappedFile>(pPath);
+        if (!job->file->isOpen()) {
+            job->error = job->file->error();
+            finishJob(job);
+            return true;
+        }
+
+        //Split the file into chunks that end on a delimiter
+        const char* data = job->file->data();
+        const size_t size = job->file->size();
+        std::vector<std::pair<size_t, size_t>> chunks;
+        for (size_t start = 0; start < size;) {
+            //Find the delimiter at or after the approximate end of the chunk
+            size_t end = size;
+            if (size - start > pChunkSize) {
+                const char* delimiter = (const char*)memchr(data + start + pChunkSize - 1, pDelimiter, size - (start + pChunkSize - 1));
+                if (delimiter) end = (size_t)(delimiter - data) + 1;
+            }
+
+            //Add the chunk
+            chunks.push_back(std::make_pair(start, end));
+            start = end;
+        }
+
+        //Setup the chunk results
+        job->results.resize(chunks.size());
+        job->remaining = (unsigned int)chunks.size();
+
+        //Check if there is nothing to process
+        if (chunks.empty()) {
+            finishJob(job);
+            return true;
+        }
+
+        //Create a Task for each of the chunks
+        for (size_t i = 0; i < chunks.size(); i++) {
+            //Create the Task to process the chunk
+            Task<void> chunk = TaskManager::createTask<void>();
+            chunk->priority = pTask->priority.value();
+            const char* begin = data + chunks[i].first;
+            const char* end = data + chunks[i].second;
+            chunk->process = [job, i, begin, end]() {
+                job->results[i] = job->process(begin, end);
+            };
+
+            //Track the chunk once it has finished
+            Asynch_Task_Base* chunkTask = chunk.get();
+            TaskManager::setFinishHook(*chunk, [job, chunkTask]() {
+                //Store the first error that occurs
+                if (chunkTask->status == ETaskStatus::Error) {
+                    std::lock_guard<std::mutex> guard(job->errorLock);
+                    if (job->error.empty()) job->error = chunkTask->error.value();
+                }
+
+                //Merge the results once the final chunk has finished
+                if (--job->remaining == 0) finishJob(job);
+            });
+
+            //Add the chunk to the Task Manager
+            TaskManager::addTask(chunk);
+        }
+
+        //Return success
+        return true;
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+#pragma region Mapped File Function Definitions
+/*
+    MappedFile : Constructor - Map the contents of a file into memory for reading
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPath - The path of the file to map
+*/
+AsynchTasks::MappedFile::MappedFile(const std::string& pPath) :
+    mData(nullptr),
+    mSize(0),
+    #ifdef _WIN32
+    mFile(INVALID_HANDLE_VALUE),
+    mMapping(nullptr)
+    #else
+    mFile(-1)
+    #endif
+{
+    #ifdef _WIN32
+    //Open the file
+    mFile = CreateFileA(pPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE) {
+        mError = "Failed to open the file '" + pPath + "' for mapping";
+        return;
+    }
+
+    //Get the size of the file
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mFile, &size)) {
+        mError = "Failed to get the size of the file '" + pPath + "'";
+        return;
+    }
+    mSize = (size_t)size.QuadPart;
+
+    //Empty files can't be mapped
+    if (!mSize) return;
+
+    //Map the contents
+    mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping) mData = (const char*)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mData) mError = "Failed to map the file '" + pPath + "' into memory";
+    #else
+    //Open the file
+    mFile = open(pPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (mFile < 0) {
+        mError = "Failed to open the file '" + pPath + "' for mapping: " + strerror(errno);
+        return;
+    }
+
+    //Get the size of the file
+    struct stat info;
+    if (fstat(mFile, &info) < 0) {
+        mError = "Failed to get the size of the file '" + pPath + "': " + strerror(errno);
+        return;
+    }
+    mSize = (size_t)info.st_size;
+
+    //Empty files can't be mapped
+    if (!mSize) return;
+
+    //Map the contents
+    void* data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFile, 0);
+    if (data == MAP_FAILED) {
+        mError = "Failed to map the file '" + pPath + "' into memory: " + strerror(errno);
+        return;
+    }
+    mData = (const char*)data;
+
+    //Each chunk is read sequentially
+    madvise(data, mSize, MADV_SEQUENTIAL);
+    #endif
+}
+
+/*
+    MappedFile : Destructor - Unmap the contents and close the file
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::MappedFile::~MappedFile() {
+    #ifdef _WIN32
+    if (mData) UnmapViewOfFile(mData);
+    if (mMapping) CloseHandle(mMapping);
+    if (mFile != INVALID_HANDLE_VALUE) CloseHandle(mFile);
+    #else
+    if (mData) munmap((void*)mData, mSize);
+    if (mFile >= 0) close(mFile);
+    #endif
+}
+#pragma endregion
+#endif
@@ -0,0 +1,845 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <deque>
+#include <condition_variable>
+#include <type_traits>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a lightweight worker pool
+ *      assembled from policy classes at compile time, for workloads that
+ *      don't need the TaskManager and shouldn't pay for priorities,
+ *      callbacks on update, metrics or error messages they don't use.
+**/
+namespace AsynchTasks {
+    namespace Policies {
+        #pragma region Queue Policies
+        /*
+         *      Name: PriorityQueue
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Hand out the waiting Tasks highest priority first, and in the
+         *      order they were added within a priority, as the TaskManager does
+        **/
+        struct PriorityQueue {
+            template<class T>
+            class Container {
+                //! Store the waiting Tasks with their priorities, in the order they will be handed out
+                std::deque<std::pair<ETaskPriority, T>> mWaiting;
+
+            public:
+                //! Add a Task after the Tasks of the same or higher priority
+                inline void push(T pTask, ETaskPriority pPriority) {
+                    mWaiting.insert(std::upper_bound(mWaiting.begin(), mWaiting.end(), pPriority,
+                        [](ETaskPriority pFirst, const std::pair<ETaskPriority, T>& pSecond) { return pFirst > pSecond.first; }),
+                        std::make_pair(pPriority, std::move(pTask)));
+                }
+
+                //! Remove the next Task to hand out
+                inline T pop() { T task = std::move(mWaiting.front().second); mWaiting.pop_front(); return task; }
+
+                //! Check if there are Tasks waiting
+                inline bool empty() const { return mWaiting.empty(); }
+            };
+        };
+
+        /*
+         *      Name: FifoQueue
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Hand out the waiting Tasks in the order they were added,
+         *      ignoring their priorities
+        **/
+        struct FifoQueue {
+            template<class T>
+            class Container {
+                //! Store the waiting Tasks in the order they were added
+                std::deque<T> mWaiting;
+
+            public:
+                inline void push(T pTask, ETaskPriority) { mWaiting.push_back(std::move(pTask)); }
+                inline T pop() { T task = std::move(mWaiting.front()); mWaiting.pop_front(); return task; }
+                inline bool empty() const { return mWaiting.empty(); }
+            };
+        };
+        #pragma endregion
+
+        #pragma region Idle Policies
+        /*
+         *      Name: SleepWhenInactive
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Yield while there is no work until the Worker has been inactive
+         *      for InactiveTimeout milliseconds, then sleep for SleepLength
+         *      milliseconds between checks, as the TaskManager Workers do
+        **/
+        template<unsigned int InactiveTimeout = 2000u, unsigned int SleepLength = 100u>
+        struct SleepWhenInactive {
+            //! Flag that adding a Task doesn't need to wake the Workers
+            static constexpr bool wakes = false;
+
+            class Waiter {
+                //! Store the time the Worker ran out of work
+                std::chrono::steady_clock::time_point mIdleSince;
+                bool mIdle = false;
+
+            public:
+                //! Reset the inactive time once the Worker has work
+                inline void busy() { mIdle = false; }
+
+                //! Wait for work with the queue lock held
+                inline void wait(std::unique_lock<std::mutex>& pLock, std::condition_variable&) {
+                    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                    if (!mIdle) mIdle = true, mIdleSince = now;
+                    pLock.unlock();
+                    if (now - mIdleSince < std::chrono::milliseconds(InactiveTimeout)) std::this_thread::yield();
+                    else std::this_thread::sleep_for(std::chrono::milliseconds(SleepLength));
+                    pLock.lock();
+                }
+            };
+        };
+
+        /*
+         *      Name: SpinIdle
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Yield while there is no work, for the lowest latency at the cost
+         *      of keeping a processor busy for each Worker
+        **/
+        struct SpinIdle {
+            static constexpr bool wakes = false;
+
+            class Waiter {
+            public:
+                inline void busy() {}
+                inline void wait(std::unique_lock<std::mutex>& pLock, std::condition_variable&) {
+                    pLock.unlock();
+                    std::this_thread::yield();
+                    pLock.lock();
+                }
+            };
+        };
+
+        /*
+         *      Name: BlockingIdle
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Block on a condition variable while there is no work, woken
+         *      when a Task is added
+        **/
+        struct BlockingIdle {
+            static constexpr bool wakes = true;
+
+            class Waiter {
+            public:
+                inline void busy() {}
+                inline void wait(std::unique_lock<std::mutex>& pLock, std::condition_variable& pCondition) { pCondition.wait(pLock); }
+            };
+        };
+        #pragma endregion
+
+        #pragma region Callback Policies
+        /*
+         *      Name: SelectableCallbacks
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Let each Task choose to have its callback called on a Worker or
+         *      by the update function, as the TaskManager does
+        **/
+        struct SelectableCallbacks {
+            //! Flag that the update function has callbacks to call
+            static constexpr bool usesUpdate = true;
+
+            //! Store the choice on each Task
+            struct TaskState {
+                //! Flag if the callback should be called from the update function
+                bool callbackOnUpdate = false;
+            };
+
+            //! Check if a Task's callback is called by the update function
+            static inline bool onUpdate(const TaskState& pState) { return pState.callbackOnUpdate; }
+        };
+
+        /*
+         *      Name: WorkerCallbacks
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Call every callback on the Worker that processed the Task,
+         *      removing the update path
+        **/
+        struct WorkerCallbacks {
+            static constexpr bool usesUpdate = false;
+            struct TaskState {};
+            static inline bool onUpdate(const TaskState&) { return false; }
+        };
+
+        /*
+         *      Name: UpdateCallbacks
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Call every callback from the update function
+        **/
+        struct UpdateCallbacks {
+            static constexpr bool usesUpdate = true;
+            struct TaskState {};
+            static inline bool onUpdate(const TaskState&) { return true; }
+        };
+        #pragma endregion
+
+        #pragma region Instrumentation Policies
+        /*
+         *      Name: Instrumented
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Count the Tasks queued, completed and failed
+        **/
+        struct Instrumented {
+            class Counters {
+                std::atomic<unsigned long long> mQueued{ 0 };
+                std::atomic<unsigned long long> mCompleted{ 0 };
+                std::atomic<unsigned long long> mFailed{ 0 };
+
+            public:
+                inline void queued() { mQueued.fetch_add(1, std::memory_order_relaxed); }
+                inline void completed() { mCompleted.fetch_add(1, std::memory_order_relaxed); }
+                inline void failed() { mFailed.fetch_add(1, std::memory_order_relaxed); }
+                inline TaskMetrics metrics() const {
+                    TaskMetrics metrics = {};
+                    metrics.tasksQueued = mQueued.load();
+                    metrics.tasksCompleted = mCompleted.load();
+                    metrics.tasksFailed = mFailed.load();
+                    return metrics;
+                }
+            };
+        };
+
+        /*
+         *      Name: Uninstrumented
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Count nothing, the metrics are always zero
+        **/
+        struct Uninstrumented {
+            class Counters {
+            public:
+                inline void queued() {}
+                inline void completed() {}
+                inline void failed() {}
+                inline TaskMetrics metrics() const { return TaskMetrics(); }
+            };
+        };
+        #pragma endregion
+
+        #pragma region Exception Policies
+        /*
+         *      Name: CaptureErrors
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Catch the errors thrown by a Task and store their message on
+         *      it, as the TaskManager does
+        **/
+        struct CaptureErrors {
+            //! Store the message of the error on each Task
+            struct TaskState {
+                //! The message of the last error thrown by the Task
+                std::string error;
+            };
+
+            //! Run a function, returning false if it threw
+            template<class F>
+            static inline bool run(TaskState& pState, F&& pFunction) {
+                try {
+                    pFunction();
+                    return true;
+                } catch (const std::exception& pExc) {
+                    pState.error = pExc.what();
+                } catch (const std::string& pExc) {
+                    pState.error = pExc;
+                } catch (...) {
+                    pState.error = "An unknown error occurred while executing the Task. Error thrown did not provide any information as to the cause\n";
+                }
+                return false;
+            }
+        };
+
+        /*
+         *      Name: CatchErrors
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Catch the errors thrown by a Task, flagging it as failed without
+         *      keeping a message
+        **/
+        struct CatchErrors {
+            struct TaskState {};
+
+            template<class F>
+            static inline bool run(TaskState&, F&& pFunction) {
+                try {
+                    pFunction();
+                    return true;
+                } catch (...) {
+                    return false;
+                }
+            }
+        };
+
+        /*
+         *      Name: NoExceptions
+         *      Author: Mitchell Croft
+         *      Created: 18/10/2026
+         *      Modified: 18/10/2026
+         *
+         *      Purpose:
+         *      Don't catch errors. A Task that throws terminates the program,
+         *      so processes and callbacks must not throw
+        **/
+        struct NoExceptions {
+            struct TaskState {};
+
+            template<class F>
+            static inline bool run(TaskState&, F&& pFunction) {
+                pFunction();
+                return true;
+            }
+        };
+        #pragma endregion
+    }
+
+    //! Prototype the policy based worker pool
+    template<class Queue, class Idle, class Callbacks, class Instrumentation, class Exceptions>
+    class PolicyWorkerPool;
+
+    #pragma region Policy Task Objects
+    /*
+     *      Name: Policy_Task_Base
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      An abstract base class for the Tasks of a PolicyWorkerPool. The
+     *      values are plain members, inheriting the per Task values required
+     *      by the callback and exception policies, so disabled features
+     *      add nothing to the Task.
+     *
+     *      Requires:
+     *      The values must not be changed while the Task is pending
+    **/
+    template<class Callbacks, class Exceptions>
+    class Policy_Task_Base : public Callbacks::TaskState, public Exceptions::TaskState {
+        //! Set the policy worker pools as friends to allow for use
+        template<class, class, class, class, class> friend class PolicyWorkerPool;
+
+    protected:
+        //! Store the current state of the Task
+        std::atomic<ETaskStatus> mStatus;
+
+        /*----------Functions----------*/
+        Policy_Task_Base() : mStatus(ETaskStatus::Setup), priority(Low_Priority) {}
+        Policy_Task_Base(const Policy_Task_Base&) = delete;
+        Policy_Task_Base& operator=(const Policy_Task_Base&) = delete;
+
+        //! Provide main functions used to complete threaded jobs
+        virtual void completeProcess() = 0;
+        virtual void completeCallback() = 0;
+        virtual void cleanupData() = 0;
+
+    public:
+        virtual ~Policy_Task_Base() = default;
+
+        //! Store the priority of the Task, ignored by queues that don't use priorities
+        ETaskPriority priority;
+
+        //! Retrieve the current state of the Task
+        inline ETaskStatus status() const { return mStatus.load(std::memory_order_acquire); }
+    };
+
+    /*
+     *      Name: Policy_Task_Job (General)
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Provide a Task of a PolicyWorkerPool with a generic return type
+     *      from the process. The result is stored in place rather than
+     *      allocated
+    **/
+    template<class Callbacks, class Exceptions, class T>
+    class Policy_Task_Job : public Policy_Task_Base<Callbacks, Exceptions> {
+        //! Set the policy worker pools as friends to allow for construction
+        template<class, class, class, class, class> friend class PolicyWorkerPool;
+
+        //! Store the result of the process
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type mResult;
+        bool mHasResult;
+
+        /*----------Functions----------*/
+        //! Restrict Job creation to the pool
+        Policy_Task_Job() : mHasResult(false) {}
+
+        //! Override the base class abstract functions
+        void completeProcess() override {
+            new (&mResult) T(process());
+            mHasResult = true;
+        }
+        void completeCallback() override { if (callback) callback(*reinterpret_cast<T*>(&mResult)); }
+        void cleanupData() override {
+            if (mHasResult) reinterpret_cast<T*>(&mResult)->~T();
+            mHasResult = false;
+        }
+
+    public:
+        //! Expose the destructor to allow for the shared pointers to delete used jobs
+        ~Policy_Task_Job() override { cleanupData(); }
+
+        //! Store the functions to call
+        std::function<T()> process;
+        std::function<void(T&)> callback;
+    };
+
+    /*
+     *      Name: Policy_Task_Job (void)
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Provide a Task of a PolicyWorkerPool with a void return type
+     *      from the process
+    **/
+    template<class Callbacks, class Exceptions>
+    class Policy_Task_Job<Callbacks, Exceptions, void> : public Policy_Task_Base<Callbacks, Exceptions> {
+        //! Set the policy worker pools as friends to allow for construction
+        template<class, class, class, class, class> friend class PolicyWorkerPool;
+
+        /*----------Functions----------*/
+        //! Restrict Job creation to the pool
+        Policy_Task_Job() = default;
+
+        //! Override the base class abstract functions
+        void completeProcess() override { process(); }
+        void completeCallback() override { if (callback) callback(); }
+        void cleanupData() override {}
+
+    public:
+        //! Expose the destructor to allow for the shared pointers to delete used jobs
+        ~Policy_Task_Job() override = default;
+
+        //! Store the functions to call
+        std::function<void()> process;
+        std::function<void()> callback;
+    };
+    #pragma endregion
+
+    #pragma region Policy Worker Pool Decleration
+    /*
+     *      Name: PolicyWorkerPool
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      A standalone pool of Workers taking Tasks from a shared queue, with
+     *      the features chosen at compile time by policy classes from the
+     *      Policies namespace:
+     *          Queue - The order Tasks are handed out (PriorityQueue, FifoQueue)
+     *          Idle - How Workers wait for work (SleepWhenInactive, SpinIdle, BlockingIdle)
+     *          Callbacks - Where callbacks are called (SelectableCallbacks, WorkerCallbacks, UpdateCallbacks)
+     *          Instrumentation - If metrics are counted (Instrumented, Uninstrumented)
+     *          Exceptions - How errors are handled (CaptureErrors, CatchErrors, NoExceptions)
+     *
+     *      This is not the TaskManager with policies applied, it is a separate
+     *      and much smaller scheduler. The default policies match the Task
+     *      visible behaviour of the TaskManager (priority order, callbacks on
+     *      update, counted metrics and error messages) but none of its
+     *      pipeline: there is no organisation thread, and retry policies,
+     *      timers, batching, fire and forget jobs, scopes, the processed hook
+     *      and the TaskManager subsystems are not supported. Each set of
+     *      policies is a separate singleton, independent of the TaskManager.
+    **/
+    template<class Queue = Policies::PriorityQueue,
+             class Idle = Policies::SleepWhenInactive<>,
+             class Callbacks = Policies::SelectableCallbacks,
+             class Instrumentation = Policies::Instrumented,
+             class Exceptions = Policies::CaptureErrors>
+    class PolicyWorkerPool {
+    public:
+        //! Define the Task objects used by this pool
+        typedef Policy_Task_Base<Callbacks, Exceptions> TaskBase;
+        template<class T> using Task = std::shared_ptr<Policy_Task_Job<Callbacks, Exceptions, T>>;
+
+    private:
+        /*----------Singleton Values----------*/
+        static PolicyWorkerPool* mInstance;
+        PolicyWorkerPool(unsigned int pWorkers);
+        ~PolicyWorkerPool() = default;
+
+        PolicyWorkerPool() = delete;
+        PolicyWorkerPool(const PolicyWorkerPool&) = delete;
+        PolicyWorkerPool& operator=(const PolicyWorkerPool&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as a constant the number of workers in use
+        const unsigned int mWorkerCount;
+
+        //! Maintain the Worker threads
+        std::vector<std::thread> mWorkers;
+
+        //! Flag if the pool is operating
+        std::atomic_bool mRunning;
+
+        //! Store the Tasks waiting for a Worker
+        typename Queue::template Container<std::shared_ptr<TaskBase>> mQueue;
+
+        //! Create a lock to prevent thread clashes over the queue
+        std::mutex mQueueLock;
+
+        //! Signal the Workers that are blocked waiting for work
+        std::condition_variable mQueueCondition;
+
+        //! Store the maximum number of Tasks that can have their callbacks executed on update per call
+        unsigned int mMaxCallbacksOnUpdate;
+
+        //! Keep a vector of all the Tasks to have their callback called on an update call
+        std::vector<std::shared_ptr<TaskBase>> mToCallOnUpdate;
+
+        //! Create a lock to prevent thread clashes over the update callbacks
+        std::mutex mCallbackLock;
+
+        //! Store the metrics counters
+        typename Instrumentation::Counters mCounters;
+
+        /*----------Functions----------*/
+        //! Function run on the Worker threads
+        void runWorker();
+
+        //! Process a Task taken from the queue
+        void process(std::shared_ptr<TaskBase>& pTask);
+
+        //! Flag a Task as failed
+        void fail(TaskBase& pTask);
+
+    public:
+        //! Main operation functionality
+        static bool create(unsigned int pWorkers = 5u);
+        static void update();
+        static void destroy();
+
+        //! Task options
+        template<class T> static Task<T> createTask();
+        template<class T> static bool addTask(Task<T>& pTask);
+
+        /*----------Getters----------*/
+        static TaskMetrics metrics();
+
+        /*----------Setters----------*/
+        static inline void setMaxCallbacks(unsigned int pMax) { mInstance->mMaxCallbacksOnUpdate = pMax; }
+    };
+    #pragma endregion
+
+    #pragma region Policy Worker Pool Templated Definitions
+    //! Define static singleton instance
+    template<class Q, class I, class C, class M, class E>
+    PolicyWorkerPool<Q, I, C, M, E>* PolicyWorkerPool<Q, I, C, M, E>::mInstance = nullptr;
+
+    /*
+        PolicyWorkerPool : Custom Constructor - Set default pre-creation singleton values
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pWorkers - The number of workers that will be used by the pool
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline PolicyWorkerPool<Q, I, C, M, E>::PolicyWorkerPool(unsigned int pWorkers) :
+        mWorkerCount(pWorkers),
+        mRunning(true),
+        mMaxCallbacksOnUpdate(10)
+    {}
+
+    /*
+        PolicyWorkerPool : runWorker - Take Tasks from the queue and process them until the
+                                        pool is destroyed
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline void PolicyWorkerPool<Q, I, C, M, E>::runWorker() {
+        //Store the idle state of the Worker
+        typename I::Waiter waiter;
+
+        //Loop while the pool is running
+        std::unique_lock<std::mutex> lock(mQueueLock);
+        while (mRunning.load(std::memory_order_relaxed)) {
+            //Wait for work
+            if (mQueue.empty()) {
+                waiter.wait(lock, mQueueCondition);
+                continue;
+            }
+
+            //Take the next Task
+            waiter.busy();
+            std::shared_ptr<TaskBase> task = mQueue.pop();
+            lock.unlock();
+
+            //Process the Task
+            process(task);
+            task.reset();
+            lock.lock();
+        }
+    }
+
+    /*
+        PolicyWorkerPool : process - Run the process of a Task, and its callback if it is
+                                      called on the Worker
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in/out] pTask - The Task to process
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline void PolicyWorkerPool<Q, I, C, M, E>::process(std::shared_ptr<TaskBase>& pTask) {
+        //Run the process
+        TaskBase& task = *pTask;
+        task.mStatus.store(ETaskStatus::In_Progress, std::memory_order_relaxed);
+        if (!E::run(task, [&task]() { task.completeProcess(); })) return fail(task);
+
+        //Hand the callback to the update function if required
+        if (C::onUpdate(task)) {
+            task.mStatus.store(ETaskStatus::Callback_On_Update, std::memory_order_release);
+            std::lock_guard<std::mutex> lock(mCallbackLock);
+            mToCallOnUpdate.push_back(pTask);
+            return;
+        }
+
+        //Run the callback
+        if (!E::run(task, [&task]() { task.completeCallback(); })) return fail(task);
+
+        //Flag the Task as completed
+        task.cleanupData();
+        mCounters.completed();
+        task.mStatus.store(ETaskStatus::Completed, std::memory_order_release);
+    }
+
+    /*
+        PolicyWorkerPool : fail - Flag a Task as failed once it has thrown
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in/out] pTask - The Task that failed
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline void PolicyWorkerPool<Q, I, C, M, E>::fail(TaskBase& pTask) {
+        pTask.cleanupData();
+        mCounters.failed();
+        pTask.mStatus.store(ETaskStatus::Error, std::memory_order_release);
+    }
+
+    /*
+        PolicyWorkerPool : create - Initialise the pool and start the Workers
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pWorkers - The number of workers that the pool is to create and use
+                             (Default 5)
+
+        return bool - Returns true if the pool was created successfully
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline bool PolicyWorkerPool<Q, I, C, M, E>::create(unsigned int pWorkers) {
+        //Ensure that the singleton hasn't been created
+        assert(!mInstance);
+
+        //Create the singleton
+        mInstance = new PolicyWorkerPool(pWorkers ? pWorkers : 1u);
+
+        //Check the instance was created
+        if (!mInstance) {
+            printf("Unable to create the PolicyWorkerPool singleton instance.");
+            return false;
+        }
+
+        //Start the Workers
+        PolicyWorkerPool* instance = mInstance;
+        for (unsigned int i = 0; i < instance->mWorkerCount; i++)
+            instance->mWorkers.emplace_back([instance]() { instance->runWorker(); });
+
+        //Return success
+        return true;
+    }
+
+    /*
+        PolicyWorkerPool : update - Call the callbacks of the Tasks waiting for the update function
+
+        Requires:
+        Callbacks are called on the thread calling update, this should only be called from the
+        main thread. Does nothing when the callback policy doesn't use the update function
+
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline void PolicyWorkerPool<Q, I, C, M, E>::update() {
+        //Check the update function is used
+        if (!C::usesUpdate) return;
+
+        //Take the Tasks to call, up to the maximum
+        std::vector<std::shared_ptr<TaskBase>> toCall;
+        mInstance->mCallbackLock.lock();
+        const size_t count = std::min((size_t)mInstance->mMaxCallbacksOnUpdate, mInstance->mToCallOnUpdate.size());
+        toCall.assign(mInstance->mToCallOnUpdate.begin(), mInstance->mToCallOnUpdate.begin() + count);
+        mInstance->mToCallOnUpdate.erase(mInstance->mToCallOnUpdate.begin(), mInstance->mToCallOnUpdate.begin() + count);
+        mInstance->mCallbackLock.unlock();
+
+        //Call the callbacks in the order the Tasks finished
+        for (auto& pointer : toCall) {
+            TaskBase& task = *pointer;
+            if (!E::run(task, [&task]() { task.completeCallback(); })) mInstance->fail(task);
+            else {
+                task.cleanupData();
+                mInstance->mCounters.completed();
+                task.mStatus.store(ETaskStatus::Completed, std::memory_order_release);
+            }
+        }
+    }
+
+    /*
+        PolicyWorkerPool : destroy - Stop the Workers and delete the pool
+
+        Note:
+        Tasks that are still waiting are left in the Pending state
+
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline void PolicyWorkerPool<Q, I, C, M, E>::destroy() {
+        //Test if the singleton instance was created
+        if (mInstance) {
+            //Stop the Workers
+            mInstance->mQueueLock.lock();
+            mInstance->mRunning = false;
+            mInstance->mQueueCondition.notify_all();
+            mInstance->mQueueLock.unlock();
+            for (auto& worker : mInstance->mWorkers) worker.join();
+
+            //Delete the singleton instance
+            delete mInstance;
+            mInstance = nullptr;
+        }
+    }
+
+    /*
+        PolicyWorkerPool : createTask - Return a new Task object with a return type of T
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return Task<T> - Returns a shared pointer to the new Task object
+    */
+    template<class Q, class I, class C, class M, class E>
+    template<class T>
+    inline typename PolicyWorkerPool<Q, I, C, M, E>::template Task<T> PolicyWorkerPool<Q, I, C, M, E>::createTask() {
+        return Task<T>(new Policy_Task_Job<C, E, T>());
+    }
+
+    /*
+        PolicyWorkerPool : addTask - Add a Task to the pool for processing
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Tasks can be added again once they have completed or failed
+
+        param[in/out] pTask - A Task object that is to be added
+
+        return bool - Returns a flag determining if the Task was added successfully
+    */
+    template<class Q, class I, class C, class M, class E>
+    template<class T>
+    inline bool PolicyWorkerPool<Q, I, C, M, E>::addTask(Task<T>& pTask) {
+        //Ensure that the pointer is valid with at minimum a process function set
+        if (!pTask || !pTask->process) return false;
+
+        //Claim the Task, failing if it is already pending (so two threads can't both add it)
+        ETaskStatus status = pTask->mStatus.load(std::memory_order_acquire);
+        do {
+            if (status != ETaskStatus::Setup && status != ETaskStatus::Completed && status != ETaskStatus::Error) return false;
+        } while (!pTask->mStatus.compare_exchange_weak(status, ETaskStatus::Pending, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        //Add the Task to the queue
+        mInstance->mCounters.queued();
+        mInstance->mQueueLock.lock();
+        mInstance->mQueue.push(pTask, pTask->priority);
+        mInstance->mQueueLock.unlock();
+
+        //Wake a Worker if they block
+        if (I::wakes) mInstance->mQueueCondition.notify_one();
+        return true;
+    }
+
+    /*
+        PolicyWorkerPool : metrics - Retrieve the current counters of the pool
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return TaskMetrics - Returns a copy of the counters (zero when uninstrumented)
+    */
+    template<class Q, class I, class C, class M, class E>
+    inline TaskMetrics PolicyWorkerPool<Q, I, C, M, E>::metrics() {
+        return (mInstance ? mInstance->mCounters.metrics() : TaskMetrics());
+    }
+    #pragma endregion
+}
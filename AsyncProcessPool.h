@@ -0,0 +1,1136 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+#include "AsyncSerialisable.h"
+
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <new>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <spawn.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a pool of worker processes
+ *      that execute serialisable Tasks in isolation from the submitting
+ *      process.
+**/
+namespace AsynchTasks {
+    #pragma region Process Pool Decleration
+    /*
+     *      Name: ProcessPool
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Execute serialisable Tasks on a set of worker processes so that
+     *      a crashing Task doesn't take down the submitting process.
+     *
+     *      Worker processes are started with posix_spawn from the executable
+     *      of the submitting process and enter through runWorker, so no code
+     *      runs between fork and exec in the (multithreaded) pool process.
+     *
+     *      Each worker process shares a block of memory with the pool that
+     *      contains a request ring and a response ring. The pool keeps the
+     *      payload of each request (so it can be resubmitted) and copies it
+     *      once into the request ring, the worker processes it in place and
+     *      writes the result back through the response ring. A socket pair
+     *      is used to signal the rings and to detect a worker process exiting.
+     *
+     *      If a worker process dies, the Task it was processing finishes with
+     *      an error and the process is restarted. The other Tasks that were
+     *      queued on the process are resubmitted to the new process.
+     *
+     *      Requires:
+     *      POSIX only. runWorker must be called at the start of main, after
+     *      the kinds the pool executes have been registered with the
+     *      TaskRegistry, as the worker processes run the same executable and
+     *      only know the kinds registered there. The TaskManager must be
+     *      created before and destroyed after the ProcessPool. Registered
+     *      processes should not use the TaskManager or other subsystems, they
+     *      run in a separate process.
+    **/
+    class ProcessPool {
+        //! Prototype the internal shared memory and process objects
+        struct Message;
+        struct Channel;
+        struct Shared;
+        struct Request;
+        struct Process;
+
+        /*----------Singleton Values----------*/
+        static ProcessPool* mInstance;
+        ProcessPool(unsigned int pProcessCount, size_t pRingSize);
+
+        //! Label the argument and descriptors used to start a worker process
+        static const char* const WORKER_FLAG;
+        enum : int { WORKER_SOCKET = 3, WORKER_MEMORY = 4 };
+
+        //! Store the path of the executable the worker processes are started from
+        static std::string mExecutable;
+        ~ProcessPool() = default;
+
+        ProcessPool() = delete;
+        ProcessPool(const ProcessPool&) = delete;
+        ProcessPool& operator=(const ProcessPool&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as constants the number of processes and the size of their rings
+        const unsigned int mProcessCount;
+        const size_t mRingSize;
+
+        //! Flag if the pool is operating
+        std::atomic_bool mRunning;
+
+        //! Store the copy of the registered kinds that the processes can execute
+        std::unordered_map<taskKind, kindProcess> mKinds;
+
+        //! Maintain the worker processes
+        Process* mProcesses;
+
+        //! Maintain the thread that collects results and restarts processes
+        std::thread mMonitorThread;
+
+        //! Store the pipe used to wake the monitor thread
+        int mWakePipe[2];
+
+        //! Store the ID to give the next request
+        std::atomic<unsigned long long> mNextID;
+
+        //! Track the total number of times a process has been restarted
+        std::atomic<unsigned int> mRestarts;
+
+        /*----------Functions----------*/
+        //! Manage the worker processes
+        bool startProcess(Process& pProcess);
+        static void runProcess(Shared& pShared, char* pRequests, char* pResponses, size_t pRingSize, int pSocket);
+        void restartProcess(Process& pProcess, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady);
+
+        //! Function run on the monitor thread to collect results
+        void monitorProcesses();
+        void collectResults(Process& pProcess, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady);
+
+        //! Move requests into the request ring of a process
+        bool pushRequest(Process& pProcess, const std::shared_ptr<Request>& pRequest);
+        void pushBacklog(Process& pProcess);
+
+        //! Signal the other end of a socket
+        static void notify(int pSocket);
+
+        //! Move a descriptor above the ones reserved for a worker process
+        static int reserveDescriptor(int pFile);
+
+    public:
+        //! Enter a worker process, must be called at the start of main
+        static void runWorker(int pArgc, char** pArgv);
+
+        //! Main operation functionality
+        static bool create(unsigned int pProcessCount = 2u, size_t pRingSize = 4u * 1024u * 1024u);
+        static void destroy();
+
+        //! Submission options
+        static bool submit(Task<IOBuffer>& pTask, taskKind pKind, IOBuffer pPayload);
+
+        //! Retrieve the number of times a worker process has been restarted
+        static unsigned int restarts();
+    };
+    #pragma endregion
+
+    #pragma region Process Pool Definitions
+    /*
+     *      Name: Message
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe a single request or response in a ring. The payload
+     *      directly follows the message
+    **/
+    struct ProcessPool::Message {
+        //! Label the types a message can have
+        enum EType : unsigned int { Result, Error, Padding = 0xFFFFFFFFu };
+
+        //! Store the ID of the request
+        unsigned long long id;
+
+        //! Store the kind of a request or the type of a response
+        unsigned int type;
+
+        //! Store the number of bytes in the payload
+        unsigned int size;
+
+        //! Retrieve the number of bytes used by a message with a payload of pSize bytes
+        static inline size_t recordSize(size_t pSize) { return sizeof(Message) + ((pSize + 15) & ~(size_t)15); }
+    };
+
+    /*
+     *      Name: Channel
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Manage a single producer, single consumer ring of messages in
+     *      shared memory. The positions are byte counts that only increase
+    **/
+    struct ProcessPool::Channel {
+        //! Store the position of the next message to read
+        std::atomic<unsigned long long> head;
+
+        //! Store the position of the next message to write
+        std::atomic<unsigned long long> tail;
+
+        /*
+            Channel : write - Write a message to the ring
+            Author: Mitchell Croft
+            Created: 18/10/2026
+            Modified: 18/10/2026
+
+            param[in] pRing - A pointer to the ring memory
+            param[in] pRingSize - The number of bytes in the ring
+            param[in] pID - The ID of the request
+            param[in] pType - The kind or response type of the message
+            param[in] pData - A pointer to the payload
+            param[in] pSize - The number of bytes in the payload
+
+            return bool - Returns false if there isn't currently space in the ring
+        */
+        inline bool write(char* pRing, size_t pRingSize, unsigned long long pID, unsigned int pType, const char* pData, size_t pSize) {
+            //Get the space required, including the padding if the message would wrap
+            const size_t record = Message::recordSize(pSize);
+            unsigned long long position = tail.load(std::memory_order_relaxed);
+            size_t offset = (size_t)(position % pRingSize);
+            size_t contiguous = pRingSize - offset;
+            size_t required = record + (contiguous < record ? contiguous : 0);
+
+            //Check there is space for the message
+            if (pRingSize - (size_t)(position - head.load(std::memory_order_acquire)) < required) return false;
+
+            //Skip to the start of the ring if the message would wrap
+            if (contiguous < record) {
+                ((Message*)(pRing + offset))->type = Message::Padding;
+                position += contiguous;
+                offset = 0;
+            }
+
+            //Write the message
+            Message* message = (Message*)(pRing + offset);
+            message->id = pID;
+            message->type = pType;
+            message->size = (unsigned int)pSize;
+            if (pSize) memcpy(message + 1, pData, pSize);
+
+            //Publish the message
+            tail.store(position + record, std::memory_order_release);
+            return true;
+        }
+
+        /*
+            Channel : peek - Retrieve the next message in the ring without removing it
+            Author: Mitchell Croft
+            Created: 18/10/2026
+            Modified: 18/10/2026
+
+            param[in] pRing - A pointer to the ring memory
+            param[in] pRingSize - The number of bytes in the ring
+
+            return const Message* - Returns a pointer to the message or nullptr if the ring is empty
+        */
+        inline const Message* peek(char* pRing, size_t pRingSize) {
+            while (true) {
+                //Check if there is a message
+                unsigned long long position = head.load(std::memory_order_relaxed);
+                if (position == tail.load(std::memory_order_acquire)) return nullptr;
+
+                //Skip padding at the end of the ring
+                const Message* message = (const Message*)(pRing + position % pRingSize);
+                if (message->type == Message::Padding) {
+                    head.store(position + (pRingSize - position % pRingSize), std::memory_order_release);
+                    continue;
+                }
+                return message;
+            }
+        }
+
+        /*
+            Channel : pop - Remove the message returned by peek from the ring
+            Author: Mitchell Croft
+            Created: 18/10/2026
+            Modified: 18/10/2026
+
+            param[in] pMessage - The message to remove
+        */
+        inline void pop(const Message* pMessage) {
+            head.store(head.load(std::memory_order_relaxed) + Message::recordSize(pMessage->size), std::memory_order_release);
+        }
+
+        /*
+            Channel : reset - Empty the ring
+            Author: Mitchell Croft
+            Created: 18/10/2026
+            Modified: 18/10/2026
+        */
+        inline void reset() { head = 0; tail = 0; }
+    };
+
+    /*
+     *      Name: Shared
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the values at the start of the memory shared with a process,
+     *      the rings directly follow
+    **/
+    struct ProcessPool::Shared {
+        //! Store the rings that move requests to and responses from the process
+        Channel requests;
+        Channel responses;
+
+        //! Store the ID of the request being processed (0 if idle)
+        std::atomic<unsigned long long> current;
+
+        //! Retrieve the number of bytes reserved before the rings
+        static inline size_t reserved() { return (sizeof(Shared) + 63) & ~(size_t)63; }
+    };
+
+    /*
+     *      Name: Request
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single submitted Task until it has finished
+    **/
+    struct ProcessPool::Request {
+        //! Store the ID used to identify the request in the rings
+        unsigned long long id;
+
+        //! Store the kind and payload of the Task (kept for resubmission)
+        taskKind kind;
+        IOBuffer payload;
+
+        //! Store the result or error of the Task
+        IOBuffer result;
+        std::string error;
+
+        //! Store the Task to queue once the request has finished
+        std::shared_ptr<Asynch_Task_Base> task;
+    };
+
+    /*
+     *      Name: Process
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single worker process
+    **/
+    struct ProcessPool::Process {
+        //! Store the ID of the process and the pool's end of its socket
+        int pid;
+        int socket;
+
+        //! Store the memory shared with the process and its descriptor
+        int memoryFile;
+        void* memory;
+        size_t memorySize;
+        Shared* shared;
+        char* requests;
+        char* responses;
+
+        //! Create a lock to prevent thread clashes over the requests
+        std::mutex lock;
+
+        //! Store the requests that are in the request ring or being processed
+        std::unordered_map<unsigned long long, std::shared_ptr<Request>> inFlight;
+
+        //! Store the requests waiting for space in the request ring
+        std::deque<std::shared_ptr<Request>> backlog;
+
+        //! Initialise with default values
+        inline Process() : pid(-1), socket(-1), memoryFile(-1), memory(nullptr), memorySize(0), shared(nullptr), requests(nullptr), responses(nullptr) {}
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::ProcessPool* AsynchTasks::ProcessPool::mInstance = nullptr;
+
+//! Define the values used to start worker processes
+const char* const AsynchTasks::ProcessPool::WORKER_FLAG = "--asynch-tasks-worker";
+std::string AsynchTasks::ProcessPool::mExecutable;
+
+#ifndef _WIN32
+//! Declare the environment passed to the worker processes
+extern char** environ;
+#endif
+
+#pragma region Process Pool Function Definitions
+/*
+    ProcessPool : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pProcessCount - The number of worker processes to start
+    param[in] pRingSize - The number of bytes in each request and response ring
+*/
+AsynchTasks::ProcessPool::ProcessPool(unsigned int pProcessCount, size_t pRingSize) :
+    mProcessCount(pProcessCount),
+    mRingSize((pRingSize + 15) & ~(size_t)15),
+    mRunning(false),
+    mProcesses(nullptr),
+    mNextID(1),
+    mRestarts(0)
+{
+    mWakePipe[0] = mWakePipe[1] = -1;
+}
+
+/*
+    ProcessPool : notify - Send a signal byte to the other end of a socket
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If the socket buffer is full a signal is already waiting to be read, so the byte is dropped
+
+    param[in] pSocket - The socket to signal
+*/
+void AsynchTasks::ProcessPool::notify(int pSocket) {
+    #ifndef _WIN32
+    char signal = 0;
+    #ifdef MSG_NOSIGNAL
+    if (send(pSocket, &signal, 1, MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {}
+    #else
+    if (send(pSocket, &signal, 1, MSG_DONTWAIT) < 0) {}
+    #endif
+    #endif
+}
+
+/*
+    ProcessPool : reserveDescriptor - Move a descriptor above the ones reserved for a worker process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The returned descriptor is closed on exec. If the descriptor can't be moved it is closed
+
+    param[in] pFile - The descriptor to move
+
+    return int - Returns the descriptor to use in place of pFile or -1 if it couldn't be moved
+*/
+int AsynchTasks::ProcessPool::reserveDescriptor(int pFile) {
+    #ifndef _WIN32
+    //Leave descriptors that can't be overwritten by the worker's descriptors
+    if (pFile < 0 || pFile > WORKER_MEMORY) {
+        if (pFile >= 0) fcntl(pFile, F_SETFD, FD_CLOEXEC);
+        return pFile;
+    }
+
+    //Duplicate the descriptor above the reserved values
+    int moved = fcntl(pFile, F_DUPFD_CLOEXEC, WORKER_MEMORY + 1);
+    close(pFile);
+    return moved;
+    #else
+    return -1;
+    #endif
+}
+
+/*
+    ProcessPool : startProcess - Create the shared memory and spawn a worker process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pProcess - The process to start
+
+    return bool - Returns true if the process was started
+*/
+bool AsynchTasks::ProcessPool::startProcess(Process& pProcess) {
+    #ifndef _WIN32
+    //Create the shared memory once, restarted processes reuse it
+    if (!pProcess.memory) {
+        //Create an unnamed block of memory that can be passed to the worker process
+        pProcess.memorySize = Shared::reserved() + mRingSize * 2;
+        #if defined(__linux__) && defined(MFD_CLOEXEC)
+        int file = memfd_create("AsynchTasks.ProcessPool", MFD_CLOEXEC);
+        #else
+        const std::string name = "/AsynchTasks." + std::to_string(getpid()) + "." + std::to_string((size_t)&pProcess);
+        int file = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (file >= 0) shm_unlink(name.c_str());
+        #endif
+        file = reserveDescriptor(file);
+        if (file < 0) return false;
+        if (ftruncate(file, (off_t)pProcess.memorySize) < 0) {
+            close(file);
+            return false;
+        }
+
+        //Map the memory
+        void* memory = mmap(nullptr, pProcess.memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (memory == MAP_FAILED) {
+            close(file);
+            return false;
+        }
+        pProcess.memoryFile = file;
+        pProcess.memory = memory;
+        pProcess.shared = new (memory) Shared();
+        pProcess.requests = (char*)memory + Shared::reserved();
+        pProcess.responses = pProcess.requests + mRingSize;
+    }
+
+    //Empty the rings
+    pProcess.shared->requests.reset();
+    pProcess.shared->responses.reset();
+    pProcess.shared->current = 0;
+
+    //Create the socket used to signal the process, neither end may leak into other children
+    int sockets[2];
+    #ifdef SOCK_CLOEXEC
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) < 0) return false;
+    #else
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) < 0) return false;
+    #endif
+    sockets[0] = reserveDescriptor(sockets[0]);
+    sockets[1] = reserveDescriptor(sockets[1]);
+    if (sockets[0] < 0 || sockets[1] < 0) {
+        if (sockets[0] >= 0) close(sockets[0]);
+        if (sockets[1] >= 0) close(sockets[1]);
+        return false;
+    }
+    #if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+    int enable = 1;
+    setsockopt(sockets[0], SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+    setsockopt(sockets[1], SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+    #endif
+
+    //Give the worker process its end of the socket and the shared memory at the reserved descriptors
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, sockets[1], WORKER_SOCKET);
+    posix_spawn_file_actions_adddup2(&actions, pProcess.memoryFile, WORKER_MEMORY);
+
+    //Start the worker process with no signals blocked
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    sigset_t mask;
+    sigemptyset(&mask);
+    posix_spawnattr_setsigmask(&attributes, &mask);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGMASK);
+
+    //Spawn the worker process from the executable
+    const std::string ringSize = std::to_string(mRingSize);
+    char* arguments[] = { (char*)mExecutable.c_str(), (char*)WORKER_FLAG, (char*)ringSize.c_str(), nullptr };
+    pid_t pid = -1;
+    const int result = posix_spawn(&pid, mExecutable.c_str(), &actions, &attributes, arguments, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attributes);
+
+    //Close the worker's end of the socket
+    close(sockets[1]);
+    if (result) {
+        close(sockets[0]);
+        return false;
+    }
+
+    //Store the pool's end of the socket
+    fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+    pProcess.pid = (int)pid;
+    pProcess.socket = sockets[0];
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/*
+    ProcessPool : runProcess - Process requests in a worker process until the pool closes
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Only called in the worker process and never returns
+
+    param[in] pShared - The values shared with the pool
+    param[in] pRequests - A pointer to the request ring
+    param[in] pResponses - A pointer to the response ring
+    param[in] pRingSize - The number of bytes in each ring
+    param[in] pSocket - The worker process's end of the socket
+*/
+void AsynchTasks::ProcessPool::runProcess(Shared& pShared, char* pRequests, char* pResponses, size_t pRingSize, int pSocket) {
+    #ifndef _WIN32
+    //Store the received signals
+    char signals[64];
+
+    //Process requests until the pool closes its end of the socket
+    while (true) {
+        //Wait for a request
+        const Message* request = pShared.requests.peek(pRequests, pRingSize);
+        if (!request) {
+            ssize_t received = recv(pSocket, signals, sizeof(signals), 0);
+            if (received == 0 || (received < 0 && errno != EINTR)) _exit(0);
+            continue;
+        }
+
+        //Flag the request that is being processed
+        const unsigned long long id = request->id;
+        pShared.current = id;
+
+        //Process the payload in place
+        IOBuffer result;
+        unsigned int type = Message::Result;
+        try {
+            const TaskRegistry::Kind* kind = TaskRegistry::find(request->type);
+            if (!kind) throw std::runtime_error("The Task kind " + std::to_string(request->type) + " is not registered with the worker process");
+            result = kind->process((const char*)(request + 1), request->size);
+        }
+        catch (const std::exception& pException) {
+            type = Message::Error;
+            result.assign(pException.what(), pException.what() + strlen(pException.what()));
+        }
+        catch (...) {
+            type = Message::Error;
+            const char* description = "An unknown exception was raised by the Task";
+            result.assign(description, description + strlen(description));
+        }
+
+        //Release the request from the ring
+        pShared.requests.pop(request);
+
+        //Check the result fits in the response ring
+        if (Message::recordSize(result.size()) > pRingSize / 2) {
+            type = Message::Error;
+            const char* description = "The result of the Task is too large for the ProcessPool response ring";
+            result.assign(description, description + strlen(description));
+        }
+
+        //Write the response, waiting for the pool to make space
+        while (!pShared.responses.write(pResponses, pRingSize, id, type, result.data(), result.size())) {
+            notify(pSocket);
+            ssize_t received = recv(pSocket, signals, sizeof(signals), 0);
+            if (received == 0 || (received < 0 && errno != EINTR)) _exit(0);
+        }
+
+        //Signal the pool
+        pShared.current = 0;
+        notify(pSocket);
+    }
+    #endif
+}
+
+/*
+    ProcessPool : restartProcess - Fail the request being processed by a dead worker process and
+                                   start a replacement
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pProcess - The process that has died
+    param[out] pReady - A list of Tasks to be queued with the TaskManager
+*/
+void AsynchTasks::ProcessPool::restartProcess(Process& pProcess, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady) {
+    #ifndef _WIN32
+    //Collect the exit status of the process
+    int status = 0;
+    std::string reason = "exited unexpectedly";
+    if (waitpid(pProcess.pid, &status, 0) == pProcess.pid) {
+        if (WIFSIGNALED(status)) reason = "was terminated by signal " + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status)) + ")";
+        else if (WIFEXITED(status)) reason = "exited with code " + std::to_string(WEXITSTATUS(status));
+    }
+
+    //Lock the requests of the process
+    std::lock_guard<std::mutex> guard(pProcess.lock);
+
+    //Close the socket to the process
+    close(pProcess.socket);
+    pProcess.socket = -1;
+    pProcess.pid = -1;
+
+    //Order the requests that were in flight by submission
+    const unsigned long long current = pProcess.shared->current;
+    std::vector<std::shared_ptr<Request>> resubmit;
+    for (auto& pair : pProcess.inFlight) {
+        //Fail the request that was being processed
+        if (pair.first == current) {
+            pair.second->error = "The worker process " + reason + " while processing the Task";
+            pReady.push_back(std::move(pair.second->task));
+        }
+
+        //Resubmit the others
+        else resubmit.push_back(pair.second);
+    }
+    pProcess.inFlight.clear();
+    std::sort(resubmit.begin(), resubmit.end(), [](const std::shared_ptr<Request>& pFirst, const std::shared_ptr<Request>& pSecond) {
+        return pFirst->id < pSecond->id;
+    });
+    pProcess.backlog.insert(pProcess.backlog.begin(), resubmit.begin(), resubmit.end());
+
+    //Start the replacement process
+    ++mRestarts;
+    if (!startProcess(pProcess)) {
+        //Fail the remaining requests
+        for (auto& request : pProcess.backlog) {
+            request->error = "The worker process " + reason + " and could not be restarted";
+            pReady.push_back(std::move(request->task));
+        }
+        pProcess.backlog.clear();
+        return;
+    }
+
+    //Resubmit the requests to the new process
+    pushBacklog(pProcess);
+    #endif
+}
+
+/*
+    ProcessPool : monitorProcesses - Collect results from the worker processes and restart any
+                                     that have died
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::ProcessPool::monitorProcesses() {
+    #ifndef _WIN32
+    //Store the descriptors to wait on
+    std::vector<pollfd> files(mProcessCount + 1);
+
+    //Store the Tasks to add to the TaskManager
+    std::vector<std::shared_ptr<Asynch_Task_Base>> ready;
+
+    //Store the received signals
+    char signals[64];
+
+    //Loop so long as the pool is running
+    while (mRunning) {
+        //Set the descriptors to wait on
+        for (unsigned int i = 0; i < mProcessCount; i++)
+            files[i] = { mProcesses[i].socket, POLLIN, 0 };
+        files[mProcessCount] = { mWakePipe[0], POLLIN, 0 };
+
+        //Wait for a signal
+        if (poll(files.data(), (nfds_t)files.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        //Check if the pool is closing
+        if (!mRunning) break;
+
+        //Check each of the processes
+        for (unsigned int i = 0; i < mProcessCount; i++) {
+            //Skip processes without signals
+            if (!files[i].revents || files[i].fd < 0) continue;
+
+            //Read the signals, checking if the process has closed its socket
+            ssize_t received;
+            while ((received = recv(files[i].fd, signals, sizeof(signals), 0)) > 0);
+            bool died = (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR));
+
+            //Collect the responses
+            collectResults(mProcesses[i], ready);
+
+            //Restart dead processes
+            if (died) restartProcess(mProcesses[i], ready);
+        }
+
+        //Hand the finished Tasks to the Workers for the callback stage
+        for (auto& task : ready) {
+            if (task) TaskManager::queueTask(task);
+        }
+        ready.clear();
+    }
+    #endif
+}
+
+/*
+    ProcessPool : collectResults - Read the responses of a worker process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pProcess - The process to read the responses of
+    param[out] pReady - A list of Tasks to be queued with the TaskManager
+*/
+void AsynchTasks::ProcessPool::collectResults(Process& pProcess, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady) {
+    //Lock the requests of the process
+    std::lock_guard<std::mutex> guard(pProcess.lock);
+
+    //Read the responses
+    bool collected = false;
+    while (const Message* response = pProcess.shared->responses.peek(pProcess.responses, mRingSize)) {
+        //Find the request
+        auto found = pProcess.inFlight.find(response->id);
+        if (found != pProcess.inFlight.end()) {
+            //Store the result
+            Request& request = *found->second;
+            const char* data = (const char*)(response + 1);
+            if (response->type == Message::Error) request.error.assign(data, response->size);
+            else request.result.assign(data, data + response->size);
+
+            //Release the payload and take the Task
+            IOBuffer().swap(request.payload);
+            pReady.push_back(std::move(request.task));
+            pProcess.inFlight.erase(found);
+        }
+
+        //Remove the response
+        pProcess.shared->responses.pop(response);
+        collected = true;
+    }
+
+    //Fill the space left by processed requests
+    pushBacklog(pProcess);
+
+    //Signal the process that there is space for responses
+    if (collected) notify(pProcess.socket);
+}
+
+/*
+    ProcessPool : pushRequest - Write a request into the request ring of a process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The lock of the process must be held by the caller
+
+    param[in/out] pProcess - The process to give the request to
+    param[in] pRequest - The request to write
+
+    return bool - Returns false if there isn't currently space in the ring
+*/
+bool AsynchTasks::ProcessPool::pushRequest(Process& pProcess, const std::shared_ptr<Request>& pRequest) {
+    //Write the request
+    if (!pProcess.shared->requests.write(pProcess.requests, mRingSize, pRequest->id, pRequest->kind, pRequest->payload.data(), pRequest->payload.size()))
+        return false;
+
+    //Track the request until the response is received
+    pProcess.inFlight[pRequest->id] = pRequest;
+    return true;
+}
+
+/*
+    ProcessPool : pushBacklog - Write waiting requests into the request ring of a process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The lock of the process must be held by the caller
+
+    param[in/out] pProcess - The process to write the waiting requests of
+*/
+void AsynchTasks::ProcessPool::pushBacklog(Process& pProcess) {
+    //Write requests while there is space
+    bool pushed = false;
+    while (pProcess.backlog.size() && pushRequest(pProcess, pProcess.backlog.front())) {
+        pProcess.backlog.pop_front();
+        pushed = true;
+    }
+
+    //Signal the process
+    if (pushed) notify(pProcess.socket);
+}
+
+/*
+    ProcessPool : runWorker - Run as a worker process if the process was started by a pool
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Must be called at the start of main, after the kinds executed by the pool are registered. Returns
+    immediately in the submitting process (storing the executable to start workers from) and never
+    returns in a worker process
+
+    param[in] pArgc - The number of arguments passed to main
+    param[in] pArgv - The arguments passed to main
+*/
+void AsynchTasks::ProcessPool::runWorker(int pArgc, char** pArgv) {
+    #ifndef _WIN32
+    //Check if the process was started by a pool
+    if (pArgc < 3 || strcmp(pArgv[1], WORKER_FLAG)) {
+        //Store the executable to start the worker processes from
+        #ifdef __linux__
+        char path[4096];
+        ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+        if (length > 0) mExecutable.assign(path, (size_t)length);
+        #endif
+        if (mExecutable.empty() && pArgc > 0) mExecutable = pArgv[0];
+        return;
+    }
+
+    //Map the memory shared with the pool
+    const size_t ringSize = (size_t)strtoull(pArgv[2], nullptr, 10);
+    void* memory = mmap(nullptr, Shared::reserved() + ringSize * 2, PROT_READ | PROT_WRITE, MAP_SHARED, WORKER_MEMORY, 0);
+    if (memory == MAP_FAILED) _exit(EXIT_FAILURE);
+    close(WORKER_MEMORY);
+
+    //Process requests until the pool closes
+    char* requests = (char*)memory + Shared::reserved();
+    runProcess(*(Shared*)memory, requests, requests + ringSize, ringSize, WORKER_SOCKET);
+    _exit(EXIT_SUCCESS);
+    #endif
+}
+
+/*
+    ProcessPool : create - Initialise the pool and start the worker processes
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pProcessCount - The number of worker processes to start (Default 2)
+    param[in] pRingSize - The number of bytes in each request and response ring. Payloads and
+                          results are limited to half of this size (Default 4MB)
+
+    return bool - Returns true if the ProcessPool was created successfully
+*/
+bool AsynchTasks::ProcessPool::create(unsigned int pProcessCount, size_t pRingSize) {
+    //Assert that the pool doesn't already exist
+    assert(!mInstance);
+
+    //Assert that requests can be processed
+    assert(pProcessCount && pRingSize >= 4096);
+
+    #ifndef _WIN32
+    //Check the executable to start the worker processes from is known
+    if (mExecutable.empty()) {
+        printf("ProcessPool::runWorker must be called at the start of main before the ProcessPool is created");
+        return false;
+    }
+
+    //Create the new pool
+    mInstance = new ProcessPool(pProcessCount, pRingSize);
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the ProcessPool singleton instance.");
+        return false;
+    }
+
+    //Take a copy of the registered kinds for the processes
+    TaskRegistry::mKindLock.lock();
+    for (auto& pair : TaskRegistry::mKinds)
+        mInstance->mKinds[pair.first] = pair.second.process;
+    TaskRegistry::mKindLock.unlock();
+
+    //Create the pipe used to wake the monitor thread
+    if (pipe(mInstance->mWakePipe) < 0) {
+        printf("Unable to create the wake pipe for the ProcessPool");
+        destroy();
+        return false;
+    }
+    fcntl(mInstance->mWakePipe[0], F_SETFD, FD_CLOEXEC);
+    fcntl(mInstance->mWakePipe[1], F_SETFD, FD_CLOEXEC);
+
+    //Start the worker processes
+    mInstance->mProcesses = new Process[pProcessCount];
+    for (unsigned int i = 0; i < pProcessCount; i++) {
+        if (!mInstance->startProcess(mInstance->mProcesses[i])) {
+            printf("Unable to start the worker processes for the ProcessPool");
+            destroy();
+            return false;
+        }
+    }
+
+    //Set the operating flag
+    mInstance->mRunning = true;
+
+    //Start the monitor thread
+    mInstance->mMonitorThread = std::thread([&]() {
+        //Call the monitor function
+        mInstance->monitorProcesses();
+    });
+
+    //Return creation was completed successfully
+    return true;
+    #else
+    printf("The ProcessPool is not supported on this platform");
+    return false;
+    #endif
+}
+
+/*
+    ProcessPool : destroy - Close the worker processes, fail the unfinished Tasks and delete the
+                            ProcessPool
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::ProcessPool::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        #ifndef _WIN32
+        //Kill the monitor thread
+        mInstance->mRunning = false;
+        if (mInstance->mWakePipe[1] >= 0) {
+            char signal = 0;
+            if (::write(mInstance->mWakePipe[1], &signal, 1) < 0) {}
+        }
+
+        //Join the monitor thread
+        if (mInstance->mMonitorThread.get_id() != std::thread::id())
+            mInstance->mMonitorThread.join();
+
+        //Close the worker processes
+        std::vector<std::shared_ptr<Asynch_Task_Base>> ready;
+        for (unsigned int i = 0; mInstance->mProcesses && i < mInstance->mProcessCount; i++) {
+            Process& process = mInstance->mProcesses[i];
+
+            //Stop the process
+            if (process.socket >= 0) close(process.socket);
+            if (process.pid > 0) {
+                kill(process.pid, SIGKILL);
+                waitpid(process.pid, nullptr, 0);
+            }
+
+            //Fail the unfinished requests
+            for (auto& pair : process.inFlight) {
+                pair.second->error = "The ProcessPool was destroyed before the Task was processed";
+                ready.push_back(std::move(pair.second->task));
+            }
+            for (auto& request : process.backlog) {
+                request->error = "The ProcessPool was destroyed before the Task was processed";
+                ready.push_back(std::move(request->task));
+            }
+
+            //Release the shared memory
+            if (process.memory) munmap(process.memory, process.memorySize);
+            if (process.memoryFile >= 0) close(process.memoryFile);
+        }
+        for (auto& task : ready) {
+            if (task) TaskManager::queueTask(task);
+        }
+
+        //Delete the processes and wake pipe
+        delete[] mInstance->mProcesses;
+        if (mInstance->mWakePipe[0] >= 0) close(mInstance->mWakePipe[0]);
+        if (mInstance->mWakePipe[1] >= 0) close(mInstance->mWakePipe[1]);
+        #endif
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    ProcessPool : submit - Process a serialisable Task on a worker process
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The Task finishes with an error if the worker process dies while processing it, or if no
+    worker process is running (all of them died and could not be restarted)
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the result. Once added the property
+                          values will be uneditable
+    param[in] pKind - The kind of the Task. Must have been registered before the pool was created
+    param[in] pPayload - The payload to process. Limited to half of the ring size
+
+    return bool - Returns a flag determining if the Task was submitted successfully
+*/
+bool AsynchTasks::ProcessPool::submit(Task<IOBuffer>& pTask, taskKind pKind, IOBuffer pPayload) {
+    //Ensure the pool is running, the kind is known and the payload fits
+    if (!mInstance || !mInstance->mRunning || !pTask || mInstance->mKinds.find(pKind) == mInstance->mKinds.end() ||
+        Message::recordSize(pPayload.size()) > mInstance->mRingSize / 2 || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the request
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    request->id = mInstance->mNextID++;
+    request->kind = pKind;
+    request->payload = std::move(pPayload);
+    request->task = pTask;
+
+    //Set the process to return the result once received
+    TaskManager::setProcess<IOBuffer>(*pTask, [request]() -> IOBuffer {
+        if (request->error.size()) throw std::runtime_error(request->error);
+        return std::move(request->result);
+    });
+
+    //Loop until the request is given to a running process
+    while (true) {
+        //Find the running process with the least work
+        Process* process = nullptr;
+        size_t least = 0;
+        for (unsigned int i = 0; i < mInstance->mProcessCount; i++) {
+            std::lock_guard<std::mutex> guard(mInstance->mProcesses[i].lock);
+            if (mInstance->mProcesses[i].pid < 0) continue;
+            size_t work = mInstance->mProcesses[i].inFlight.size() + mInstance->mProcesses[i].backlog.size();
+            if (!process || work < least) {
+                process = &mInstance->mProcesses[i];
+                least = work;
+            }
+        }
+
+        //Fail the Task if every process has died
+        if (!process) {
+            request->error = "No worker process is running to process the Task";
+            std::shared_ptr<Asynch_Task_Base> task = std::move(request->task);
+            TaskManager::queueTask(task);
+            return true;
+        }
+
+        //Give the request to the process, unless it died since it was checked
+        std::lock_guard<std::mutex> guard(process->lock);
+        if (process->pid < 0) continue;
+        if (process->backlog.size() || !mInstance->pushRequest(*process, request)) process->backlog.push_back(request);
+        else notify(process->socket);
+        return true;
+    }
+}
+
+/*
+    ProcessPool : restarts - Retrieve the number of times a worker process has been restarted
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return unsigned int - Returns the total number of restarts since the pool was created
+*/
+unsigned int AsynchTasks::ProcessPool::restarts() {
+    return (mInstance ? mInstance->mRestarts.load() : 0u);
+}
+#pragma endregion
+#endif
@@ -0,0 +1,441 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with rate limits on the number of
+ *      Tasks of a class that are dispatched to the Workers per second.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the value used to identify a class of rate limited Tasks
+    typedef unsigned int taskClass;
+    #pragma endregion
+
+    #pragma region Rate Limiter Decleration
+    /*
+     *      Name: RateLimiter
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Limit the rate that Tasks of a class are handed to the Workers
+     *      using a token bucket for each class. The bucket refills at the
+     *      rate of the class up to its burst size and each Task dispatched
+     *      uses a token.
+     *
+     *      Tasks that arrive while the bucket is empty are held (pending) by
+     *      the limiter in the order they were added, without being given to
+     *      a Worker. A TaskManager timer is started for the moment the next
+     *      token is available and the held Tasks are released from it.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      RateLimiter. Classes without a limit are not limited.
+    **/
+    class RateLimiter {
+        //! Prototype the internal bucket object
+        struct Bucket;
+
+        /*----------Singleton Values----------*/
+        static RateLimiter* mInstance;
+
+        //! Create a lock to prevent the timers using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        RateLimiter() = default;
+        ~RateLimiter() = default;
+
+        RateLimiter(const RateLimiter&) = delete;
+        RateLimiter& operator=(const RateLimiter&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the buckets of the limited classes
+        std::unordered_map<taskClass, Bucket> mBuckets;
+
+        //! Create a lock to prevent thread clashes over the buckets
+        std::mutex mBucketLock;
+
+        /*----------Functions----------*/
+        //! Dispatch a locked Task, or hold it until its class has a token
+        bool admit(const std::shared_ptr<Asynch_Task_Base>& pTask, taskClass pClass);
+
+        //! Release the held Tasks of a class that have tokens
+        void release(taskClass pClass);
+
+        //! Function raised by the timer of a class
+        static void raiseTimer(taskClass pClass);
+
+    public:
+        //! Main operation functionality
+        static bool create();
+        static void destroy();
+
+        //! Limit options
+        static void setLimit(taskClass pClass, double pRate, double pBurst = 1.0);
+        static void removeLimit(taskClass pClass);
+
+        //! Task options
+        template<class T> static bool addTask(Task<T>& pTask, taskClass pClass);
+
+        //! Retrieve the number of Tasks of a class that are being held
+        static size_t held(taskClass pClass);
+    };
+    #pragma endregion
+
+    #pragma region Bucket Definition
+    /*
+     *      Name: Bucket
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the token bucket and held Tasks of a single class
+    **/
+    struct RateLimiter::Bucket {
+        //! Store the number of tokens added per second and the maximum tokens
+        double rate;
+        double burst;
+
+        //! Store the tokens available at the last refill
+        double tokens;
+        std::chrono::steady_clock::time_point refilled;
+
+        //! Store the Tasks waiting for a token, oldest first
+        std::deque<std::shared_ptr<Asynch_Task_Base>> held;
+
+        //! Store the timer started to release the held Tasks (0 if none)
+        timerID timer;
+
+        //! Add the tokens earned since the last refill
+        inline void refill(const std::chrono::steady_clock::time_point& pNow) {
+            tokens = std::min(burst, tokens + std::chrono::duration<double>(pNow - refilled).count() * rate);
+            refilled = pNow;
+        }
+
+        //! Retrieve the time the next token is available, rounded up so the token has been earned
+        inline std::chrono::steady_clock::time_point nextToken() const {
+            return refilled + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::max(0.0, 1.0 - tokens) / rate)) + std::chrono::steady_clock::duration(1);
+        }
+    };
+    #pragma endregion
+
+    #pragma region Template Definitions
+    /*
+        RateLimiter : addTask - Add a Task to the TaskManager once its class has a token
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Held Tasks report the Pending status until they are given to the TaskManager
+
+        param[in/out] pTask - A Task object that is to be added. Once added the property values
+                              will be uneditable
+        param[in] pClass - The class of the Task
+
+        return bool - Returns a flag determining if the Task was added successfully
+    */
+    template<class T>
+    inline bool RateLimiter::addTask(Task<T>& pTask, taskClass pClass) {
+        //Ensure that the limiter exists and the pointer is valid
+        if (!mInstance || !pTask) return false;
+
+        //Ensure that the task has at minimum a process functions set
+        if (!pTask->process.value()) return false;
+
+        //Ensure the task is in the setup or complete state and lock down its values
+        if (!TaskManager::lockTask(*pTask)) return false;
+
+        //Dispatch or hold the Task
+        return mInstance->admit(pTask, pClass);
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::RateLimiter* AsynchTasks::RateLimiter::mInstance = nullptr;
+std::mutex AsynchTasks::RateLimiter::mInstanceLock;
+
+#pragma region Rate Limiter Function Definitions
+/*
+    RateLimiter : admit - Give a locked Task to the TaskManager if its class has a token,
+                          otherwise hold it until one is available
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pTask - The locked Task to admit
+    param[in] pClass - The class of the Task
+
+    return bool - Returns true once the Task has been dispatched or held
+*/
+bool AsynchTasks::RateLimiter::admit(const std::shared_ptr<Asynch_Task_Base>& pTask, taskClass pClass) {
+    //Lock the buckets
+    std::unique_lock<std::mutex> buckets(mBucketLock);
+
+    //Dispatch Tasks of classes without a limit
+    auto found = mBuckets.find(pClass);
+    if (found == mBuckets.end()) {
+        buckets.unlock();
+        TaskManager::queueTask(pTask);
+        return true;
+    }
+
+    //Dispatch the Task if there is a token and no Tasks are held ahead of it
+    Bucket& bucket = found->second;
+    bucket.refill(std::chrono::steady_clock::now());
+    if (bucket.held.empty() && bucket.tokens >= 1.0) {
+        bucket.tokens -= 1.0;
+        buckets.unlock();
+        TaskManager::queueTask(pTask);
+        return true;
+    }
+
+    //Hold the Task until a token is available
+    bucket.held.push_back(pTask);
+    if (!bucket.timer) {
+        bucket.timer = TaskManager::startTimer(bucket.nextToken(), [pClass]() { raiseTimer(pClass); });
+    }
+    return true;
+}
+
+/*
+    RateLimiter : release - Dispatch the held Tasks of a class that there are tokens for
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Raised on the organisation thread by the timer of the class
+
+    param[in] pClass - The class to release the Tasks of
+*/
+void AsynchTasks::RateLimiter::release(taskClass pClass) {
+    //Store the Tasks that can be dispatched
+    std::vector<std::shared_ptr<Asynch_Task_Base>> ready;
+
+    //Lock the buckets
+    std::unique_lock<std::mutex> buckets(mBucketLock);
+
+    //Check the class is still limited
+    auto found = mBuckets.find(pClass);
+    if (found == mBuckets.end()) return;
+    Bucket& bucket = found->second;
+    bucket.timer = 0;
+
+    //Take the Tasks there are tokens for
+    bucket.refill(std::chrono::steady_clock::now());
+    while (bucket.held.size() && bucket.tokens >= 1.0) {
+        bucket.tokens -= 1.0;
+        ready.push_back(std::move(bucket.held.front()));
+        bucket.held.pop_front();
+    }
+
+    //Start a timer for the next token if Tasks are still held
+    if (bucket.held.size()) {
+        bucket.timer = TaskManager::startTimer(bucket.nextToken(), [pClass]() { raiseTimer(pClass); });
+    }
+    buckets.unlock();
+
+    //Give the Tasks to the TaskManager
+    for (auto& task : ready) TaskManager::queueTask(task);
+}
+
+/*
+    RateLimiter : raiseTimer - Release the held Tasks of a class if the limiter still exists
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Raised on the organisation thread once the timer of the class is due. The instance lock is
+    held while releasing, so destroy waits for a timer that is already being raised
+
+    param[in] pClass - The class to release the Tasks of
+*/
+void AsynchTasks::RateLimiter::raiseTimer(taskClass pClass) {
+    std::lock_guard<std::mutex> guard(mInstanceLock);
+    if (mInstance) mInstance->release(pClass);
+}
+
+/*
+    RateLimiter : create - Initialise the rate limiter
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return bool - Returns true if the RateLimiter was created successfully
+*/
+bool AsynchTasks::RateLimiter::create() {
+    //Assert that the limiter doesn't already exist
+    assert(!mInstance);
+
+    //Create the new limiter
+    RateLimiter* instance = new RateLimiter();
+
+    //Test to ensure the instance were created
+    if (!instance) {
+        printf("Unable to create the RateLimiter singleton instance.");
+        return false;
+    }
+
+    //Publish the instance for the timers
+    mInstanceLock.lock();
+    mInstance = instance;
+    mInstanceLock.unlock();
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    RateLimiter : destroy - Return the held Tasks to the setup state and delete the RateLimiter
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Must be called while the TaskManager exists, as the timers of the classes are stopped
+*/
+void AsynchTasks::RateLimiter::destroy() {
+    //Take the singleton instance, waiting for a timer that is being raised
+    mInstanceLock.lock();
+    RateLimiter* instance = mInstance;
+    mInstance = nullptr;
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Stop the timers and release the held Tasks
+        instance->mBucketLock.lock();
+        for (auto& pair : instance->mBuckets) {
+            if (pair.second.timer) TaskManager::stopTimer(pair.second.timer);
+            for (auto& task : pair.second.held) TaskManager::releaseTask(*task);
+        }
+        instance->mBuckets.clear();
+        instance->mBucketLock.unlock();
+
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    RateLimiter : setLimit - Set the rate that Tasks of a class can be dispatched
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A new class starts with a full bucket. Changing the limit of a class keeps its tokens
+    (up to the new burst) and the Tasks it is holding
+
+    param[in] pClass - The class to limit
+    param[in] pRate - The number of Tasks that can be dispatched per second
+    param[in] pBurst - The number of Tasks that can be dispatched at once after being idle
+                       (Default 1)
+*/
+void AsynchTasks::RateLimiter::setLimit(taskClass pClass, double pRate, double pBurst) {
+    //Assert the limit is valid
+    assert(pRate > 0.0 && pBurst >= 1.0);
+
+    //Check the limiter exists
+    if (!mInstance) return;
+
+    //Lock the buckets
+    std::lock_guard<std::mutex> guard(mInstance->mBucketLock);
+
+    //Create or update the bucket
+    auto now = std::chrono::steady_clock::now();
+    auto found = mInstance->mBuckets.find(pClass);
+    if (found == mInstance->mBuckets.end()) {
+        Bucket& bucket = mInstance->mBuckets[pClass];
+        bucket.tokens = pBurst;
+        bucket.refilled = now;
+        bucket.timer = 0;
+        found = mInstance->mBuckets.find(pClass);
+    }
+    else found->second.refill(now);
+    found->second.rate = pRate;
+    found->second.burst = pBurst;
+    found->second.tokens = std::min(found->second.tokens, pBurst);
+
+    //Restart the timer for the new rate
+    if (found->second.timer) {
+        TaskManager::stopTimer(found->second.timer);
+        found->second.timer = TaskManager::startTimer(found->second.nextToken(), [pClass]() { raiseTimer(pClass); });
+    }
+}
+
+/*
+    RateLimiter : removeLimit - Remove the limit of a class, dispatching its held Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pClass - The class to stop limiting
+*/
+void AsynchTasks::RateLimiter::removeLimit(taskClass pClass) {
+    //Check the limiter exists
+    if (!mInstance) return;
+
+    //Take the bucket of the class
+    std::deque<std::shared_ptr<Asynch_Task_Base>> held;
+    mInstance->mBucketLock.lock();
+    auto found = mInstance->mBuckets.find(pClass);
+    if (found != mInstance->mBuckets.end()) {
+        if (found->second.timer) TaskManager::stopTimer(found->second.timer);
+        held.swap(found->second.held);
+        mInstance->mBuckets.erase(found);
+    }
+    mInstance->mBucketLock.unlock();
+
+    //Dispatch the held Tasks
+    for (auto& task : held) TaskManager::queueTask(task);
+}
+
+/*
+    RateLimiter : held - Retrieve the number of Tasks of a class waiting for a token
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pClass - The class to check
+
+    return size_t - Returns the number of held Tasks
+*/
+size_t AsynchTasks::RateLimiter::held(taskClass pClass) {
+    //Check the limiter exists
+    if (!mInstance) return 0;
+
+    //Find the bucket
+    std::lock_guard<std::mutex> guard(mInstance->mBucketLock);
+    auto found = mInstance->mBuckets.find(pClass);
+    return (found != mInstance->mBuckets.end() ? found->second.held.size() : 0);
+}
+#pragma endregion
+#endif
@@ -0,0 +1,618 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <unordered_map>
+
+#include <stdio.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a reactor that adds
+ *      Tasks to the TaskManager when a file descriptor becomes
+ *      readable or writable.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Label the readiness conditions a Task can wait on
+    enum class EReadiness : char {
+        //! The file descriptor has data available to read
+        Readable = 1,
+
+        //! The file descriptor can accept data to write
+        Writable = 2,
+
+        //! The file descriptor is readable or writable
+        Read_Write = 3
+    };
+
+    //! Label the different modes a readiness condition is triggered with
+    enum class ETriggerMode : char {
+        //! The Task is added every time it finishes while the condition is still met
+        Level,
+
+        //! The Task is added once for each time the condition becomes met
+        Edge
+    };
+    #pragma endregion
+
+    #pragma region Reactor Decleration
+    /*
+     *      Name: Reactor
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Watch file descriptors (pipes, sockets, etc.) on a single reactor
+     *      thread and add the associated Task to the TaskManager, with its
+     *      priority, when the descriptor is ready. No Worker is blocked while
+     *      waiting on the descriptor.
+     *
+     *      While watched a Task remains Pending. A Task is never added again
+     *      while it is being processed, readiness that occurs in the meantime
+     *      is handled once the Task has finished:
+     *          Level - The descriptor is checked again once the Task finishes
+     *          Edge - The Task is added again if an edge occurred while it was
+     *                 being processed
+     *      One-shot watches are disarmed after the Task has been added and
+     *      must be re-armed with Reactor::rearm. Watches whose Task finishes
+     *      with an error are also disarmed until re-armed.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      Reactor. Only supported on Linux (epoll).
+    **/
+    class Reactor {
+        //! Prototype the internal watch object
+        struct Watch;
+
+        /*----------Singleton Values----------*/
+        static Reactor* mInstance;
+        Reactor();
+        ~Reactor() = default;
+
+        Reactor(const Reactor&) = delete;
+        Reactor& operator=(const Reactor&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the epoll and wake up descriptors
+        int mPollFile;
+        int mWakeFile;
+
+        //! Flag if the Reactor is operating
+        std::atomic_flag mRunning;
+
+        //! Maintain the thread that waits on the descriptors
+        std::thread mReactorThread;
+
+        //! Create a lock to prevent thread clashes over the watches
+        std::mutex mWatchLock;
+
+        //! Store the watches by their file descriptor
+        std::unordered_map<int, Watch> mWatches;
+
+        /*----------Functions----------*/
+        //! Wait for readiness on the reactor thread
+        void waitForEvents();
+
+        //! Manage the state of the watches
+        static bool addWatch(const std::shared_ptr<Asynch_Task_Base>& pTask, int pFile, EReadiness pEvents, ETriggerMode pMode, bool pOneShot);
+        static bool armWatch(Watch& pWatch, bool pAdd);
+        static void disarmWatch(Watch& pWatch);
+        static void taskFinished(int pFile, Asynch_Task_Base* pTask);
+
+    public:
+        //! Main operation functionality
+        static bool create();
+        static void destroy();
+
+        //! Watch options
+        template<class T> static bool watch(Task<T>& pTask, int pFile, EReadiness pEvents, ETriggerMode pMode = ETriggerMode::Level, bool pOneShot = false);
+        static bool rearm(int pFile);
+        static bool unwatch(int pFile);
+    };
+    #pragma endregion
+
+    #pragma region Watch Definition
+    /*
+     *      Name: Watch
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single watched file descriptor
+    **/
+    struct Reactor::Watch {
+        //! Store the Task to add when the descriptor is ready
+        std::shared_ptr<Asynch_Task_Base> task;
+
+        //! Store the file descriptor that is watched
+        int file;
+
+        //! Store the conditions to wait for
+        EReadiness events;
+        ETriggerMode mode;
+        bool oneShot;
+
+        //! Flag if the descriptor is armed with the reactor
+        bool armed;
+
+        //! Flag if the Task has been added to the TaskManager and is not finished
+        bool busy;
+
+        //! Flag if an edge occurred while the Task was busy
+        bool missed;
+    };
+    #pragma endregion
+
+    #pragma region Reactor Templated Definitions
+    /*
+        Reactor : watch - Add a Task to the TaskManager whenever a file descriptor is ready
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in/out] pTask - A Task<T> object to be added when the descriptor is ready. While
+                              watched the property values will be uneditable
+        param[in] pFile - The file descriptor to watch. Must remain open while watched
+        param[in] pEvents - The readiness conditions to wait for
+        param[in] pMode - The mode used to trigger the Task (Default Level)
+        param[in] pOneShot - Flags if the watch is disarmed after the Task has been added (Default false)
+
+        return bool - Returns a flag determining if the watch was added successfully
+    */
+    template<class T>
+    inline bool Reactor::watch(Task<T>& pTask, int pFile, EReadiness pEvents, ETriggerMode pMode, bool pOneShot) {
+        //Ensure that the pointer is valid and a process has been set
+        if (!pTask || !pTask->process.value()) return false;
+
+        //Add the watch
+        return addWatch(pTask, pFile, pEvents, pMode, pOneShot);
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::Reactor* AsynchTasks::Reactor::mInstance = nullptr;
+
+#pragma region Reactor Function Definitions
+/*
+    Reactor : Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::Reactor::Reactor() :
+    mPollFile(-1),
+    mWakeFile(-1)
+{}
+
+/*
+    Reactor : waitForEvents - Add the Tasks of ready file descriptors to the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::Reactor::waitForEvents() {
+    #ifdef __linux__
+    //Store the events that are received
+    epoll_event events[64];
+
+    //Store the Tasks to add to the TaskManager
+    std::vector<std::shared_ptr<Asynch_Task_Base>> ready;
+
+    //Loop so long as the Reactor is running
+    while (mRunning.test_and_set()) {
+        //Wait for descriptors to be ready
+        int count = epoll_wait(mPollFile, events, 64, -1);
+
+        //Check for errors
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        //Lock the watches
+        mWatchLock.lock();
+
+        //Loop through the ready descriptors
+        for (int i = 0; i < count; i++) {
+            //Ignore the wake up descriptor
+            if (events[i].data.fd == mWakeFile) continue;
+
+            //Find the watch for the descriptor
+            auto iter = mWatches.find(events[i].data.fd);
+            if (iter == mWatches.end()) continue;
+            Watch& watch = iter->second;
+
+            //Ignore events that were queued before the watch was disarmed
+            if (!watch.armed) continue;
+
+            //Level watches are disarmed by the event
+            if (watch.mode == ETriggerMode::Level || watch.oneShot) watch.armed = false;
+
+            //Remember edges that occur while the Task is busy
+            if (watch.busy) watch.missed = true;
+
+            //Otherwise add the Task
+            else {
+                watch.busy = true;
+                ready.push_back(watch.task);
+            }
+        }
+
+        //Unlock the watches
+        mWatchLock.unlock();
+
+        //Add the ready Tasks to the TaskManager
+        for (size_t i = 0; i < ready.size(); i++)
+            TaskManager::queueTask(ready[i]);
+        ready.clear();
+    }
+    #endif
+}
+
+/*
+    Reactor : addWatch - Register a Task and file descriptor with the reactor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pTask - The Task to add when the descriptor is ready
+    param[in] pFile - The file descriptor to watch
+    param[in] pEvents - The readiness conditions to wait for
+    param[in] pMode - The mode used to trigger the Task
+    param[in] pOneShot - Flags if the watch is disarmed after the Task has been added
+
+    return bool - Returns a flag determining if the watch was added successfully
+*/
+bool AsynchTasks::Reactor::addWatch(const std::shared_ptr<Asynch_Task_Base>& pTask, int pFile, EReadiness pEvents, ETriggerMode pMode, bool pOneShot) {
+    //Ensure the reactor is available
+    if (!mInstance || pFile < 0) return false;
+
+    //Lock the watches
+    std::lock_guard<std::mutex> guard(mInstance->mWatchLock);
+
+    //Ensure the descriptor is not already watched
+    if (mInstance->mWatches.count(pFile)) return false;
+
+    //Lock the Task while it is watched
+    if (!TaskManager::lockTask(*pTask)) return false;
+
+    //Create the watch
+    Watch& watch = mInstance->mWatches[pFile];
+    watch.task = pTask;
+    watch.file = pFile;
+    watch.events = pEvents;
+    watch.mode = pMode;
+    watch.oneShot = pOneShot;
+    watch.armed = watch.busy = watch.missed = false;
+
+    //Register the descriptor
+    if (!armWatch(watch, true)) {
+        TaskManager::releaseTask(*pTask);
+        mInstance->mWatches.erase(pFile);
+        return false;
+    }
+
+    //Set the hook to manage the watch once the Task has finished
+    Asynch_Task_Base* task = pTask.get();
+    TaskManager::setFinishHook(*pTask, [pFile, task]() { taskFinished(pFile, task); });
+    return true;
+}
+
+/*
+    Reactor : armWatch - Register or re-arm a watch with epoll
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The watch lock must be held when arming watches
+
+    param[in/out] pWatch - The watch to arm
+    param[in] pAdd - Flags if the descriptor is being registered for the first time
+
+    return bool - Returns true if the watch was armed
+*/
+bool AsynchTasks::Reactor::armWatch(Watch& pWatch, bool pAdd) {
+    #ifdef __linux__
+    //Setup the conditions to wait for
+    epoll_event event;
+    event.data.u64 = 0;
+    event.data.fd = pWatch.file;
+    event.events = 0;
+    if ((char)pWatch.events & (char)EReadiness::Readable) event.events |= EPOLLIN | EPOLLRDHUP;
+    if ((char)pWatch.events & (char)EReadiness::Writable) event.events |= EPOLLOUT;
+
+    //Level watches are disarmed while the Task is processed and checked again once it finishes
+    if (pWatch.mode == ETriggerMode::Level || pWatch.oneShot) event.events |= EPOLLONESHOT;
+    if (pWatch.mode == ETriggerMode::Edge) event.events |= EPOLLET;
+
+    //Register the descriptor
+    if (epoll_ctl(mInstance->mPollFile, (pAdd ? EPOLL_CTL_ADD : EPOLL_CTL_MOD), pWatch.file, &event) < 0)
+        return false;
+
+    //Flag the watch as armed
+    pWatch.armed = true;
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+/*
+    Reactor : disarmWatch - Stop epoll reporting the readiness of a watch until it is re-armed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The watch lock must be held when disarming watches
+
+    param[in/out] pWatch - The watch to disarm
+*/
+void AsynchTasks::Reactor::disarmWatch(Watch& pWatch) {
+    #ifdef __linux__
+    //Keep the descriptor registered but wait for no conditions
+    epoll_event event;
+    event.data.u64 = 0;
+    event.data.fd = pWatch.file;
+    event.events = 0;
+    epoll_ctl(mInstance->mPollFile, EPOLL_CTL_MOD, pWatch.file, &event);
+    #endif
+
+    //Flag the watch as disarmed
+    pWatch.armed = false;
+}
+
+/*
+    Reactor : taskFinished - Update a watch once its Task has finished processing
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFile - The file descriptor of the watch
+    param[in] pTask - The Task that has finished
+*/
+void AsynchTasks::Reactor::taskFinished(int pFile, Asynch_Task_Base* pTask) {
+    //Ensure the reactor is available
+    if (!mInstance) return;
+
+    //Lock the watches
+    std::unique_lock<std::mutex> guard(mInstance->mWatchLock);
+
+    //Find the watch for the Task
+    auto iter = mInstance->mWatches.find(pFile);
+    if (iter == mInstance->mWatches.end() || iter->second.task.get() != pTask) return;
+    Watch& watch = iter->second;
+
+    //Flag the Task as no longer busy
+    watch.busy = false;
+
+    //Disarm watches whose Task failed until re-armed by the user
+    if (pTask->status == ETaskStatus::Error) {
+        watch.missed = false;
+        disarmWatch(watch);
+        return;
+    }
+
+    //Leave one-shot watches for the user to re-arm
+    if (watch.oneShot) return;
+
+    //Lock the Task again while it is watched
+    TaskManager::lockTask(*pTask);
+
+    //Check the level of the descriptor again
+    if (watch.mode == ETriggerMode::Level) armWatch(watch, false);
+
+    //Add the Task again if an edge occurred while it was busy
+    else if (watch.missed) {
+        watch.missed = false;
+        watch.busy = true;
+        std::shared_ptr<Asynch_Task_Base> task = watch.task;
+        guard.unlock();
+        TaskManager::queueTask(task);
+    }
+}
+
+/*
+    Reactor : create - Initialise and setup the reactor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return bool - Returns true if the Reactor was created successfully
+*/
+bool AsynchTasks::Reactor::create() {
+    //Assert that the Reactor doesn't already exist
+    assert(!mInstance);
+
+    #ifdef __linux__
+    //Create the new Reactor
+    mInstance = new Reactor();
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the Reactor singleton instance.");
+        return false;
+    }
+
+    //Create the descriptors used to wait for events
+    mInstance->mPollFile = epoll_create1(EPOLL_CLOEXEC);
+    mInstance->mWakeFile = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    //Register the wake up descriptor
+    epoll_event event;
+    event.data.u64 = 0;
+    event.data.fd = mInstance->mWakeFile;
+    event.events = EPOLLIN;
+    if (mInstance->mPollFile < 0 || mInstance->mWakeFile < 0 ||
+        epoll_ctl(mInstance->mPollFile, EPOLL_CTL_ADD, mInstance->mWakeFile, &event) < 0) {
+        printf("Unable to create the epoll instance for the Reactor");
+        destroy();
+        return false;
+    }
+
+    //Set the operating flag
+    mInstance->mRunning.test_and_set();
+
+    //Start the reactor thread
+    mInstance->mReactorThread = std::thread([&]() {
+        //Call the event function
+        mInstance->waitForEvents();
+    });
+
+    //Return creation was completed successfully
+    return true;
+    #else
+    printf("The Reactor is not supported on this platform");
+    return false;
+    #endif
+}
+
+/*
+    Reactor : destroy - Close the reactor thread, release watched Tasks and delete the Reactor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::Reactor::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        #ifdef __linux__
+        //Kill the reactor thread
+        mInstance->mRunning.clear();
+        if (mInstance->mWakeFile >= 0) {
+            unsigned long long value = 1;
+            if (::write(mInstance->mWakeFile, &value, sizeof(value)) < 0) {}
+        }
+
+        //Join the reactor thread
+        if (mInstance->mReactorThread.get_id() != std::thread::id())
+            mInstance->mReactorThread.join();
+
+        //Remove the watches
+        mInstance->mWatchLock.lock();
+        for (auto& pair : mInstance->mWatches) {
+            //Release Tasks that are waiting on the descriptor (busy Tasks finish normally)
+            if (!pair.second.busy && pair.second.task->status == ETaskStatus::Pending) {
+                TaskManager::setFinishHook(*pair.second.task, nullptr);
+                TaskManager::releaseTask(*pair.second.task);
+            }
+        }
+        mInstance->mWatches.clear();
+        mInstance->mWatchLock.unlock();
+
+        //Close the descriptors
+        if (mInstance->mWakeFile >= 0) close(mInstance->mWakeFile);
+        if (mInstance->mPollFile >= 0) close(mInstance->mPollFile);
+        #endif
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    Reactor : rearm - Re-arm a one-shot watch, or a watch whose Task finished with an error
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFile - The file descriptor of the watch to re-arm
+
+    return bool - Returns true if the watch was re-armed
+*/
+bool AsynchTasks::Reactor::rearm(int pFile) {
+    //Ensure the reactor is available
+    if (!mInstance) return false;
+
+    //Lock the watches
+    std::lock_guard<std::mutex> guard(mInstance->mWatchLock);
+
+    //Find the watch
+    auto iter = mInstance->mWatches.find(pFile);
+    if (iter == mInstance->mWatches.end()) return false;
+    Watch& watch = iter->second;
+
+    //Ensure the Task is not being processed
+    if (watch.busy) return false;
+
+    //Lock the Task while it is watched (Tasks that failed are reset first)
+    if (watch.task->status == ETaskStatus::Error) TaskManager::releaseTask(*watch.task);
+    if (watch.task->status != ETaskStatus::Pending && !TaskManager::lockTask(*watch.task)) return false;
+
+    //Arm the descriptor again
+    return armWatch(watch, false);
+}
+
+/*
+    Reactor : unwatch - Stop watching a file descriptor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If the Task is currently being processed it will finish normally (without being
+    watched again), otherwise it is returned to the setup state.
+
+    param[in] pFile - The file descriptor to stop watching
+
+    return bool - Returns true if the descriptor was being watched
+*/
+bool AsynchTasks::Reactor::unwatch(int pFile) {
+    //Ensure the reactor is available
+    if (!mInstance) return false;
+
+    //Lock the watches
+    std::lock_guard<std::mutex> guard(mInstance->mWatchLock);
+
+    //Find the watch
+    auto iter = mInstance->mWatches.find(pFile);
+    if (iter == mInstance->mWatches.end()) return false;
+    Watch& watch = iter->second;
+
+    #ifdef __linux__
+    //Remove the descriptor from epoll
+    epoll_event event;
+    epoll_ctl(mInstance->mPollFile, EPOLL_CTL_DEL, pFile, &event);
+    #endif
+
+    //Stop the Task returning to the reactor once it finishes
+    TaskManager::setFinishHook(*watch.task, nullptr);
+
+    //Release the Task if it is waiting on the descriptor (busy Tasks finish normally)
+    if (!watch.busy && watch.task->status == ETaskStatus::Pending)
+        TaskManager::releaseTask(*watch.task);
+
+    //Remove the watch
+    mInstance->mWatches.erase(iter);
+    return true;
+}
+#pragma endregion
+#endif
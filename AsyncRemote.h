@@ -0,0 +1,1343 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+#include "AsyncSerialisable.h"
+
+#include <deque>
+#include <unordered_map>
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a protocol for executing
+ *      serialisable Tasks on a remote node, along with the executor that
+ *      submits Tasks and the node that processes them.
+**/
+namespace AsynchTasks {
+    #pragma region Remote Protocol Decleration
+    /*
+     *      Name: RemoteProtocol
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Define the binary protocol used between a RemoteExecutor and a
+     *      RemoteNode, along with the socket helpers used by both ends.
+     *
+     *      All values are little endian. Every frame starts with an 8 byte
+     *      header:
+     *          u32 length  - The number of bytes in the frame after the header
+     *          u8  type    - The EFrame value of the frame
+     *          u8  version - The VERSION of the protocol
+     *          u16 count   - The number of records in the frame
+     *
+     *      Hello (node to executor, once on connection):
+     *          u32 credits - The number of Tasks the executor can have outstanding
+     *          u32 maxFrame - The largest frame the node will accept
+     *
+     *      Submit (executor to node), count records of:
+     *          u64 id, u32 kind, u32 size, size bytes of payload
+     *
+     *      Results (node to executor), count records of:
+     *          u64 id, u8 status, u32 size, size bytes of result (or error message)
+     *
+     *      Flow control is credit based. Each submitted Task uses one of the
+     *      credits given in the Hello frame and each result returns one.
+    **/
+    struct RemoteProtocol {
+        //! Label the types of frame
+        enum EFrame : unsigned char { Hello = 1, Submit, Results };
+
+        //! Label the status of a result
+        enum EStatus : unsigned char { Success, Failure };
+
+        //! Define the constant values of the protocol
+        static const unsigned char VERSION = 1;
+        static const size_t HEADER_SIZE = 8;
+        static const size_t TASK_RECORD_SIZE = 16;
+        static const size_t RESULT_RECORD_SIZE = 13;
+        static const size_t MAX_FRAME_SIZE = 16u * 1024u * 1024u;
+
+        //! Append little endian values to a buffer
+        static void putU8(IOBuffer& pBuffer, unsigned char pValue);
+        static void putU16(IOBuffer& pBuffer, unsigned short pValue);
+        static void putU32(IOBuffer& pBuffer, unsigned int pValue);
+        static void putU64(IOBuffer& pBuffer, unsigned long long pValue);
+
+        //! Read little endian values from memory
+        static unsigned short getU16(const char* pData);
+        static unsigned int getU32(const char* pData);
+        static unsigned long long getU64(const char* pData);
+
+        //! Write and read frames
+        static size_t beginFrame(IOBuffer& pBuffer, EFrame pType);
+        static void endFrame(IOBuffer& pBuffer, size_t pStart, unsigned short pCount);
+        static int readFrame(const IOBuffer& pBuffer, size_t& pOffset, EFrame& pType, unsigned short& pCount, const char*& pBody, size_t& pLength);
+
+        //! Open sockets for addresses in the form "tcp:host:port" or "unix:path"
+        static int connectTo(const std::string& pAddress, std::string& pError);
+        static int listenOn(const std::string& pAddress, std::string& pError);
+    };
+    #pragma endregion
+
+    #pragma region Remote Executor Decleration
+    /*
+     *      Name: RemoteStats
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Report the traffic sent by the RemoteExecutor
+    **/
+    struct RemoteStats {
+        //! Store the number of Tasks and frames sent to the node
+        unsigned long long tasksSent;
+        unsigned long long framesSent;
+
+        //! Store the number of results received from the node
+        unsigned long long resultsReceived;
+
+        //! Store the number of credits currently available
+        unsigned int credits;
+
+        //! Store the number of Tasks waiting for a credit
+        unsigned int queued;
+    };
+
+    /*
+     *      Name: RemoteExecutor
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Submit serialisable Tasks to a RemoteNode over a socket and hand
+     *      the Task to the TaskManager once its result has been received.
+     *
+     *      A connection thread batches the queued Tasks into Submit frames,
+     *      limited by the credits the node has made available and the
+     *      maximum batch size. While a frame is being sent, new Tasks build
+     *      up for the next frame, so small Tasks are batched under load.
+     *
+     *      If the connection is lost, the outstanding Tasks finish with an
+     *      error and no further Tasks are accepted.
+     *
+     *      Requires:
+     *      POSIX only. The TaskManager must be created before and destroyed
+     *      after the RemoteExecutor. The node must have the kinds of the
+     *      submitted Tasks registered.
+    **/
+    class RemoteExecutor {
+        //! Prototype the internal request object
+        struct Request;
+
+        /*----------Singleton Values----------*/
+        static RemoteExecutor* mInstance;
+        RemoteExecutor(unsigned int pMaxBatch);
+        ~RemoteExecutor() = default;
+
+        RemoteExecutor() = delete;
+        RemoteExecutor(const RemoteExecutor&) = delete;
+        RemoteExecutor& operator=(const RemoteExecutor&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as a constant the number of Tasks that can be sent in a frame
+        const unsigned int mMaxBatch;
+
+        //! Store the socket connected to the node
+        int mSocket;
+
+        //! Store the pipe used to wake the connection thread
+        int mWakePipe[2];
+
+        //! Flag if the executor is operating and connected
+        std::atomic_bool mRunning;
+        std::atomic_bool mConnected;
+
+        //! Maintain the thread that sends Tasks and receives results
+        std::thread mConnectionThread;
+
+        //! Create a lock to prevent thread clashes over the requests
+        std::mutex mRequestLock;
+
+        //! Store the requests waiting to be sent
+        std::deque<std::shared_ptr<Request>> mQueued;
+
+        //! Store the requests that have been sent, by ID
+        std::unordered_map<unsigned long long, std::shared_ptr<Request>> mSent;
+
+        //! Store the flow control values received from the node
+        unsigned int mCredits;
+        size_t mMaxFrame;
+
+        //! Store the ID to give the next request
+        unsigned long long mNextID;
+
+        //! Store the values used to create the stats
+        RemoteStats mStats;
+
+        /*----------Functions----------*/
+        //! Function run on the connection thread to exchange frames
+        void runConnection();
+
+        //! Encode the queued requests into a Submit frame
+        bool fillFrame(IOBuffer& pBuffer);
+
+        //! Decode a Results frame
+        void readResults(const char* pBody, size_t pLength, unsigned short pCount, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady);
+
+        //! Fail all of the requests that haven't received a result
+        void failRequests(const std::string& pError, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady);
+
+    public:
+        //! Main operation functionality
+        static bool create(const std::string& pAddress, unsigned int pMaxBatch = 64u, unsigned int pTimeout = 5000u);
+        static void destroy();
+
+        //! Submission options
+        static bool submit(Task<IOBuffer>& pTask, taskKind pKind, const IOBuffer& pPayload);
+
+        //! Retrieve the current stats of the executor
+        static RemoteStats stats();
+    };
+    #pragma endregion
+
+    #pragma region Remote Node Decleration
+    /*
+     *      Name: RemoteNode
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Accept connections from RemoteExecutors and process the Tasks they
+     *      submit on the Workers of the local TaskManager. The results of the
+     *      Tasks that finish while the connections are serviced are returned
+     *      together in a single Results frame for each connection.
+     *
+     *      Requires:
+     *      POSIX only. The TaskManager must be created before serving and the
+     *      kinds that executors submit must be registered with the
+     *      TaskRegistry.
+    **/
+    class RemoteNode {
+        //! Prototype the internal connection and result objects
+        struct Connection;
+        struct Result;
+
+    public:
+        //! Main operation functionality
+        static bool serve(const std::string& pAddress, unsigned int pCredits = 256u, const std::atomic_bool* pStop = nullptr);
+    };
+    #pragma endregion
+
+    #pragma region Remote Definitions
+    /*
+     *      Name: Request
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single Task submitted to the RemoteExecutor
+    **/
+    struct RemoteExecutor::Request {
+        //! Store the ID used to identify the request on the connection
+        unsigned long long id;
+
+        //! Store the kind and payload of the Task
+        taskKind kind;
+        IOBuffer payload;
+
+        //! Store the result or error of the Task
+        IOBuffer result;
+        std::string error;
+
+        //! Store the Task to queue once the result has been received
+        std::shared_ptr<Asynch_Task_Base> task;
+    };
+
+    /*
+     *      Name: Connection
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single executor connected to a RemoteNode
+    **/
+    struct RemoteNode::Connection {
+        //! Store the socket of the connection
+        int socket;
+
+        //! Store the data that has been received but not decoded
+        IOBuffer received;
+
+        //! Store the data waiting to be sent
+        IOBuffer sending;
+        size_t sent;
+
+        //! Track the number of Tasks that are being processed
+        unsigned int outstanding;
+
+        //! Initialise with default values
+        inline Connection(int pSocket) : socket(pSocket), sent(0), outstanding(0) {}
+    };
+
+    /*
+     *      Name: Result
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the result of a Task processed by a RemoteNode until it is sent
+    **/
+    struct RemoteNode::Result {
+        //! Store the connection and ID of the request
+        unsigned long long connection;
+        unsigned long long id;
+
+        //! Store the Task while it is being processed
+        Task<IOBuffer> task;
+
+        //! Store the result or error message
+        RemoteProtocol::EStatus status;
+        IOBuffer data;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::RemoteExecutor* AsynchTasks::RemoteExecutor::mInstance = nullptr;
+
+#pragma region Remote Protocol Function Definitions
+/*
+    RemoteProtocol : putU8 - Append a byte to a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pValue - The value to append
+*/
+void AsynchTasks::RemoteProtocol::putU8(IOBuffer& pBuffer, unsigned char pValue) {
+    pBuffer.push_back((char)pValue);
+}
+
+/*
+    RemoteProtocol : putU16 - Append a little endian 16 bit value to a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pValue - The value to append
+*/
+void AsynchTasks::RemoteProtocol::putU16(IOBuffer& pBuffer, unsigned short pValue) {
+    for (unsigned int i = 0; i < 2; i++) pBuffer.push_back((char)(pValue >> (i * 8)));
+}
+
+/*
+    RemoteProtocol : putU32 - Append a little endian 32 bit value to a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pValue - The value to append
+*/
+void AsynchTasks::RemoteProtocol::putU32(IOBuffer& pBuffer, unsigned int pValue) {
+    for (unsigned int i = 0; i < 4; i++) pBuffer.push_back((char)(pValue >> (i * 8)));
+}
+
+/*
+    RemoteProtocol : putU64 - Append a little endian 64 bit value to a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pValue - The value to append
+*/
+void AsynchTasks::RemoteProtocol::putU64(IOBuffer& pBuffer, unsigned long long pValue) {
+    for (unsigned int i = 0; i < 8; i++) pBuffer.push_back((char)(pValue >> (i * 8)));
+}
+
+/*
+    RemoteProtocol : getU16 - Read a little endian 16 bit value
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pData - A pointer to the value
+
+    return unsigned short - Returns the value that was read
+*/
+unsigned short AsynchTasks::RemoteProtocol::getU16(const char* pData) {
+    return (unsigned short)((unsigned char)pData[0] | ((unsigned char)pData[1] << 8));
+}
+
+/*
+    RemoteProtocol : getU32 - Read a little endian 32 bit value
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pData - A pointer to the value
+
+    return unsigned int - Returns the value that was read
+*/
+unsigned int AsynchTasks::RemoteProtocol::getU32(const char* pData) {
+    unsigned int value = 0;
+    for (unsigned int i = 0; i < 4; i++) value |= (unsigned int)(unsigned char)pData[i] << (i * 8);
+    return value;
+}
+
+/*
+    RemoteProtocol : getU64 - Read a little endian 64 bit value
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pData - A pointer to the value
+
+    return unsigned long long - Returns the value that was read
+*/
+unsigned long long AsynchTasks::RemoteProtocol::getU64(const char* pData) {
+    unsigned long long value = 0;
+    for (unsigned int i = 0; i < 8; i++) value |= (unsigned long long)(unsigned char)pData[i] << (i * 8);
+    return value;
+}
+
+/*
+    RemoteProtocol : beginFrame - Append the header of a frame to a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pType - The type of the frame
+
+    return size_t - Returns the position of the header, to be passed to endFrame
+*/
+size_t AsynchTasks::RemoteProtocol::beginFrame(IOBuffer& pBuffer, EFrame pType) {
+    size_t start = pBuffer.size();
+    putU32(pBuffer, 0);
+    putU8(pBuffer, pType);
+    putU8(pBuffer, VERSION);
+    putU16(pBuffer, 0);
+    return start;
+}
+
+/*
+    RemoteProtocol : endFrame - Fill in the length and record count of a frame
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer containing the frame
+    param[in] pStart - The position of the header returned by beginFrame
+    param[in] pCount - The number of records in the frame
+*/
+void AsynchTasks::RemoteProtocol::endFrame(IOBuffer& pBuffer, size_t pStart, unsigned short pCount) {
+    unsigned int length = (unsigned int)(pBuffer.size() - pStart - HEADER_SIZE);
+    for (unsigned int i = 0; i < 4; i++) pBuffer[pStart + i] = (char)(length >> (i * 8));
+    for (unsigned int i = 0; i < 2; i++) pBuffer[pStart + 6 + i] = (char)(pCount >> (i * 8));
+}
+
+/*
+    RemoteProtocol : readFrame - Retrieve the next complete frame from a buffer
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBuffer - The buffer of received data
+    param[in/out] pOffset - The position of the next frame, moved past the frame when read
+    param[out] pType - The type of the frame
+    param[out] pCount - The number of records in the frame
+    param[out] pBody - A pointer to the data after the header
+    param[out] pLength - The number of bytes after the header
+
+    return int - Returns 1 if a frame was read, 0 if the frame is incomplete or -1 if the
+                 data is not a valid frame
+*/
+int AsynchTasks::RemoteProtocol::readFrame(const IOBuffer& pBuffer, size_t& pOffset, EFrame& pType, unsigned short& pCount, const char*& pBody, size_t& pLength) {
+    //Check the header has been received
+    if (pBuffer.size() - pOffset < HEADER_SIZE) return 0;
+
+    //Read the header
+    const char* header = pBuffer.data() + pOffset;
+    pLength = getU32(header);
+    pType = (EFrame)(unsigned char)header[4];
+    pCount = getU16(header + 6);
+
+    //Check the header is valid
+    if ((unsigned char)header[5] != VERSION || pLength > MAX_FRAME_SIZE) return -1;
+
+    //Check the body has been received
+    if (pBuffer.size() - pOffset - HEADER_SIZE < pLength) return 0;
+
+    //Move past the frame
+    pBody = header + HEADER_SIZE;
+    pOffset += HEADER_SIZE + pLength;
+    return 1;
+}
+
+/*
+    RemoteProtocol : connectTo - Open a socket connected to an address
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pAddress - The address to connect to, in the form "tcp:host:port" or "unix:path"
+    param[out] pError - A description of the error if the connection failed
+
+    return int - Returns the connected socket or -1 on failure
+*/
+int AsynchTasks::RemoteProtocol::connectTo(const std::string& pAddress, std::string& pError) {
+    #ifndef _WIN32
+    int file = -1;
+
+    //Check for a unix socket
+    if (!pAddress.compare(0, 5, "unix:")) {
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, pAddress.c_str() + 5, sizeof(address.sun_path) - 1);
+        file = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (file >= 0 && connect(file, (sockaddr*)&address, sizeof(address)) < 0) { close(file); file = -1; }
+    }
+
+    //Check for a TCP socket
+    else if (!pAddress.compare(0, 4, "tcp:") && pAddress.rfind(':') > 3) {
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons((unsigned short)atoi(pAddress.c_str() + pAddress.rfind(':') + 1));
+        std::string host = pAddress.substr(4, pAddress.rfind(':') - 4);
+        if (inet_pton(AF_INET, (host == "localhost" ? "127.0.0.1" : host.c_str()), &address.sin_addr) != 1) {
+            pError = "Invalid IPv4 address '" + host + "'";
+            return -1;
+        }
+        file = socket(AF_INET, SOCK_STREAM, 0);
+        if (file >= 0 && connect(file, (sockaddr*)&address, sizeof(address)) < 0) { close(file); file = -1; }
+
+        //Small frames are sent without delay
+        int enable = 1;
+        if (file >= 0) setsockopt(file, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    }
+
+    //Otherwise the address is invalid
+    else {
+        pError = "Invalid address '" + pAddress + "', expected tcp:host:port or unix:path";
+        return -1;
+    }
+
+    //Check the socket was connected
+    if (file < 0) pError = "Failed to connect to '" + pAddress + "': " + strerror(errno);
+    else fcntl(file, F_SETFD, FD_CLOEXEC);
+    return file;
+    #else
+    pError = "Remote execution is not supported on this platform";
+    return -1;
+    #endif
+}
+
+/*
+    RemoteProtocol : listenOn - Open a socket listening on an address
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pAddress - The address to listen on, in the form "tcp:host:port" or "unix:path"
+    param[out] pError - A description of the error if the socket couldn't be opened
+
+    return int - Returns the listening socket or -1 on failure
+*/
+int AsynchTasks::RemoteProtocol::listenOn(const std::string& pAddress, std::string& pError) {
+    #ifndef _WIN32
+    int file = -1;
+    bool bound = false;
+
+    //Check for a unix socket
+    if (!pAddress.compare(0, 5, "unix:")) {
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, pAddress.c_str() + 5, sizeof(address.sun_path) - 1);
+        unlink(address.sun_path);
+        file = socket(AF_UNIX, SOCK_STREAM, 0);
+        bound = (file >= 0 && bind(file, (sockaddr*)&address, sizeof(address)) == 0);
+    }
+
+    //Check for a TCP socket
+    else if (!pAddress.compare(0, 4, "tcp:") && pAddress.rfind(':') > 3) {
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons((unsigned short)atoi(pAddress.c_str() + pAddress.rfind(':') + 1));
+        std::string host = pAddress.substr(4, pAddress.rfind(':') - 4);
+        if (inet_pton(AF_INET, (host == "localhost" ? "127.0.0.1" : host.c_str()), &address.sin_addr) != 1) {
+            pError = "Invalid IPv4 address '" + host + "'";
+            return -1;
+        }
+        file = socket(AF_INET, SOCK_STREAM, 0);
+        int enable = 1;
+        if (file >= 0) setsockopt(file, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        bound = (file >= 0 && bind(file, (sockaddr*)&address, sizeof(address)) == 0);
+    }
+
+    //Otherwise the address is invalid
+    else {
+        pError = "Invalid address '" + pAddress + "', expected tcp:host:port or unix:path";
+        return -1;
+    }
+
+    //Start listening
+    if (!bound || listen(file, 16) < 0) {
+        pError = "Failed to listen on '" + pAddress + "': " + strerror(errno);
+        if (file >= 0) close(file);
+        return -1;
+    }
+    fcntl(file, F_SETFD, FD_CLOEXEC);
+    return file;
+    #else
+    pError = "Remote execution is not supported on this platform";
+    return -1;
+    #endif
+}
+#pragma endregion
+
+#pragma region Remote Executor Function Definitions
+/*
+    RemoteExecutor : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pMaxBatch - The number of Tasks that can be sent in a single frame
+*/
+AsynchTasks::RemoteExecutor::RemoteExecutor(unsigned int pMaxBatch) :
+    mMaxBatch(pMaxBatch),
+    mSocket(-1),
+    mRunning(false),
+    mConnected(false),
+    mCredits(0),
+    mMaxFrame(0),
+    mNextID(1),
+    mStats()
+{
+    mWakePipe[0] = mWakePipe[1] = -1;
+}
+
+/*
+    RemoteExecutor : runConnection - Send the queued Tasks and receive the results until the
+                                     executor closes or the connection is lost
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::RemoteExecutor::runConnection() {
+    #ifndef _WIN32
+    //Store the data being sent and received
+    IOBuffer sending, received;
+    size_t sent = 0;
+
+    //Store the Tasks to add to the TaskManager
+    std::vector<std::shared_ptr<Asynch_Task_Base>> ready;
+
+    //Store the reason the connection was closed
+    std::string error = "The RemoteExecutor was destroyed before the Task was processed";
+
+    //Loop so long as the executor is running
+    char buffer[64 * 1024];
+    while (mRunning) {
+        //Build the next frame once the previous has been sent
+        if (sent == sending.size()) {
+            sending.clear();
+            sent = 0;
+            fillFrame(sending);
+        }
+
+        //Wait for the socket to be ready
+        pollfd files[2] = { { mSocket, (short)(POLLIN | (sent < sending.size() ? POLLOUT : 0)), 0 }, { mWakePipe[0], POLLIN, 0 } };
+        if (poll(files, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            error = std::string("Failed to wait on the connection: ") + strerror(errno);
+            break;
+        }
+
+        //Clear the wake signals
+        if (files[1].revents) while (::read(mWakePipe[0], buffer, sizeof(buffer)) == (ssize_t)sizeof(buffer));
+
+        //Send the pending frame
+        if (files[0].revents & POLLOUT) {
+            #ifdef MSG_NOSIGNAL
+            ssize_t count = send(mSocket, sending.data() + sent, sending.size() - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+            #else
+            ssize_t count = send(mSocket, sending.data() + sent, sending.size() - sent, MSG_DONTWAIT);
+            #endif
+            if (count > 0) sent += (size_t)count;
+            else if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                error = std::string("The connection to the RemoteNode was lost: ") + strerror(errno);
+                break;
+            }
+        }
+
+        //Receive the results
+        if (files[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            ssize_t count = recv(mSocket, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (count == 0 || (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                error = "The connection to the RemoteNode was lost";
+                break;
+            }
+            if (count > 0) received.insert(received.end(), buffer, buffer + count);
+
+            //Decode the complete frames
+            size_t offset = 0;
+            RemoteProtocol::EFrame type;
+            unsigned short records;
+            const char* body;
+            size_t length;
+            int result;
+            while ((result = RemoteProtocol::readFrame(received, offset, type, records, body, length)) > 0) {
+                if (type == RemoteProtocol::Results) readResults(body, length, records, ready);
+            }
+            received.erase(received.begin(), received.begin() + offset);
+            if (result < 0) {
+                error = "An invalid frame was received from the RemoteNode";
+                break;
+            }
+        }
+
+        //Hand the finished Tasks to the Workers for the callback stage
+        for (auto& task : ready) TaskManager::queueTask(task);
+        ready.clear();
+    }
+
+    //Fail the unfinished requests
+    failRequests(error, ready);
+    for (auto& task : ready) TaskManager::queueTask(task);
+    #endif
+}
+
+/*
+    RemoteExecutor : fillFrame - Encode the queued requests that have credit into a Submit frame
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to write the frame to
+
+    return bool - Returns true if a frame was written
+*/
+bool AsynchTasks::RemoteExecutor::fillFrame(IOBuffer& pBuffer) {
+    //Lock the requests
+    std::lock_guard<std::mutex> guard(mRequestLock);
+
+    //Check there is something to send
+    if (mQueued.empty() || !mCredits) return false;
+
+    //Add the requests to the frame
+    size_t start = RemoteProtocol::beginFrame(pBuffer, RemoteProtocol::Submit);
+    unsigned short count = 0;
+    while (mQueued.size() && mCredits && count < mMaxBatch) {
+        //Check the request fits in the frame
+        std::shared_ptr<Request>& request = mQueued.front();
+        if (count && pBuffer.size() - start + RemoteProtocol::TASK_RECORD_SIZE + request->payload.size() > mMaxFrame) break;
+
+        //Encode the request
+        RemoteProtocol::putU64(pBuffer, request->id);
+        RemoteProtocol::putU32(pBuffer, request->kind);
+        RemoteProtocol::putU32(pBuffer, (unsigned int)request->payload.size());
+        pBuffer.insert(pBuffer.end(), request->payload.begin(), request->payload.end());
+        IOBuffer().swap(request->payload);
+
+        //Move the request to the sent requests
+        mSent[request->id] = request;
+        mQueued.pop_front();
+        --mCredits;
+        ++count;
+    }
+    RemoteProtocol::endFrame(pBuffer, start, count);
+
+    //Update the stats
+    mStats.tasksSent += count;
+    ++mStats.framesSent;
+    return true;
+}
+
+/*
+    RemoteExecutor : readResults - Store the results of a Results frame
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBody - A pointer to the frame body
+    param[in] pLength - The number of bytes in the body
+    param[in] pCount - The number of records in the frame
+    param[out] pReady - A list of Tasks to be queued with the TaskManager
+*/
+void AsynchTasks::RemoteExecutor::readResults(const char* pBody, size_t pLength, unsigned short pCount, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady) {
+    //Lock the requests
+    std::lock_guard<std::mutex> guard(mRequestLock);
+
+    //Read the records
+    const char* end = pBody + pLength;
+    for (unsigned short i = 0; i < pCount && (size_t)(end - pBody) >= RemoteProtocol::RESULT_RECORD_SIZE; i++) {
+        //Read the record header
+        unsigned long long id = RemoteProtocol::getU64(pBody);
+        unsigned char status = (unsigned char)pBody[8];
+        unsigned int size = RemoteProtocol::getU32(pBody + 9);
+        pBody += RemoteProtocol::RESULT_RECORD_SIZE;
+        if ((size_t)(end - pBody) < size) break;
+
+        //Find the request
+        auto found = mSent.find(id);
+        if (found != mSent.end()) {
+            //Store the result
+            Request& request = *found->second;
+            if (status == RemoteProtocol::Success) request.result.assign(pBody, pBody + size);
+            else request.error.assign(pBody, size);
+
+            //Take the Task
+            pReady.push_back(std::move(request.task));
+            mSent.erase(found);
+        }
+
+        //Return the credit
+        pBody += size;
+        ++mCredits;
+        ++mStats.resultsReceived;
+    }
+}
+
+/*
+    RemoteExecutor : failRequests - Flag the executor as disconnected and finish all unfinished
+                                    requests with an error
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pError - The error message to give the Tasks
+    param[out] pReady - A list of Tasks to be queued with the TaskManager
+*/
+void AsynchTasks::RemoteExecutor::failRequests(const std::string& pError, std::vector<std::shared_ptr<Asynch_Task_Base>>& pReady) {
+    //Lock the requests
+    std::lock_guard<std::mutex> guard(mRequestLock);
+
+    //Stop requests being queued, submit checks the flag under the same lock
+    mConnected = false;
+
+    //Fail the sent requests
+    for (auto& pair : mSent) {
+        pair.second->error = pError;
+        pReady.push_back(std::move(pair.second->task));
+    }
+    mSent.clear();
+
+    //Fail the queued requests
+    for (auto& request : mQueued) {
+        request->error = pError;
+        pReady.push_back(std::move(request->task));
+    }
+    mQueued.clear();
+}
+
+/*
+    RemoteExecutor : create - Connect to a RemoteNode and start the connection thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pAddress - The address of the node, in the form "tcp:host:port" or "unix:path"
+    param[in] pMaxBatch - The number of Tasks that can be sent in a single frame (Default 64)
+    param[in] pTimeout - The number of milliseconds to wait for the node to send its Hello frame
+                         (Default 5000)
+
+    return bool - Returns true if the RemoteExecutor was created and connected successfully
+*/
+bool AsynchTasks::RemoteExecutor::create(const std::string& pAddress, unsigned int pMaxBatch, unsigned int pTimeout) {
+    //Assert that the executor doesn't already exist
+    assert(!mInstance);
+
+    //Assert that Tasks can be sent
+    assert(pMaxBatch && pMaxBatch <= 0xFFFF);
+
+    #ifndef _WIN32
+    //Create the new executor
+    mInstance = new RemoteExecutor(pMaxBatch);
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the RemoteExecutor singleton instance.");
+        return false;
+    }
+
+    //Connect to the node
+    std::string error;
+    mInstance->mSocket = RemoteProtocol::connectTo(pAddress, error);
+    if (mInstance->mSocket < 0) {
+        printf("%s\n", error.c_str());
+        destroy();
+        return false;
+    }
+
+    //Receive the Hello frame, giving up once the timeout has passed
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(pTimeout);
+    IOBuffer received;
+    size_t offset = 0;
+    RemoteProtocol::EFrame type;
+    unsigned short count;
+    const char* body;
+    size_t length;
+    int result;
+    while (!(result = RemoteProtocol::readFrame(received, offset, type, count, body, length))) {
+        const long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        pollfd file = { mInstance->mSocket, POLLIN, 0 };
+        if (remaining <= 0) break;
+        const int ready = poll(&file, 1, (int)remaining);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0) break;
+        char buffer[256];
+        ssize_t read = recv(mInstance->mSocket, buffer, sizeof(buffer), 0);
+        if (read <= 0) break;
+        received.insert(received.end(), buffer, buffer + read);
+    }
+    if (result <= 0 || type != RemoteProtocol::Hello || length < 8) {
+        printf("Failed to receive the Hello frame from the RemoteNode at '%s'\n", pAddress.c_str());
+        destroy();
+        return false;
+    }
+    mInstance->mCredits = RemoteProtocol::getU32(body);
+    mInstance->mMaxFrame = RemoteProtocol::getU32(body + 4);
+
+    //Create the pipe used to wake the connection thread
+    if (pipe(mInstance->mWakePipe) < 0) {
+        printf("Unable to create the wake pipe for the RemoteExecutor");
+        destroy();
+        return false;
+    }
+    fcntl(mInstance->mWakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(mInstance->mWakePipe[1], F_SETFL, O_NONBLOCK);
+
+    //Set the operating flags
+    mInstance->mRunning = true;
+    mInstance->mConnected = true;
+
+    //Start the connection thread
+    mInstance->mConnectionThread = std::thread([&]() {
+        //Call the connection function
+        mInstance->runConnection();
+    });
+
+    //Return creation was completed successfully
+    return true;
+    #else
+    printf("The RemoteExecutor is not supported on this platform");
+    return false;
+    #endif
+}
+
+/*
+    RemoteExecutor : destroy - Close the connection, fail the unfinished Tasks and delete the
+                               RemoteExecutor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::RemoteExecutor::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        #ifndef _WIN32
+        //Kill the connection thread
+        mInstance->mRunning = false;
+        if (mInstance->mWakePipe[1] >= 0) {
+            char signal = 0;
+            if (::write(mInstance->mWakePipe[1], &signal, 1) < 0) {}
+        }
+
+        //Join the connection thread
+        if (mInstance->mConnectionThread.get_id() != std::thread::id())
+            mInstance->mConnectionThread.join();
+
+        //Close the descriptors
+        if (mInstance->mSocket >= 0) close(mInstance->mSocket);
+        if (mInstance->mWakePipe[0] >= 0) close(mInstance->mWakePipe[0]);
+        if (mInstance->mWakePipe[1] >= 0) close(mInstance->mWakePipe[1]);
+        #endif
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    RemoteExecutor : submit - Process a serialisable Task on the RemoteNode
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The Task finishes with an error if the connection is lost before the result is received
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the result. Once added the property
+                          values will be uneditable
+    param[in] pKind - The kind of the Task. Must be registered with the node
+    param[in] pPayload - The payload to process. Limited by the maximum frame size of the node
+
+    return bool - Returns a flag determining if the Task was submitted successfully
+*/
+bool AsynchTasks::RemoteExecutor::submit(Task<IOBuffer>& pTask, taskKind pKind, const IOBuffer& pPayload) {
+    //Ensure the executor is connected and the payload fits in a frame
+    if (!mInstance || !mInstance->mConnected || !pTask ||
+        RemoteProtocol::HEADER_SIZE + RemoteProtocol::TASK_RECORD_SIZE + pPayload.size() > mInstance->mMaxFrame ||
+        !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the request
+    std::shared_ptr<Request> request = std::make_shared<Request>();
+    request->kind = pKind;
+    request->payload = pPayload;
+    request->task = pTask;
+
+    //Set the process to return the result once received
+    TaskManager::setProcess<IOBuffer>(*pTask, [request]() -> IOBuffer {
+        if (request->error.size()) throw std::runtime_error(request->error);
+        return std::move(request->result);
+    });
+
+    //Queue the request, unless the connection was lost since it was checked
+    mInstance->mRequestLock.lock();
+    if (!mInstance->mConnected) {
+        mInstance->mRequestLock.unlock();
+        TaskManager::releaseTask(*pTask);
+        return false;
+    }
+    request->id = mInstance->mNextID++;
+    mInstance->mQueued.push_back(request);
+    mInstance->mRequestLock.unlock();
+
+    //Wake the connection thread
+    #ifndef _WIN32
+    char signal = 0;
+    if (::write(mInstance->mWakePipe[1], &signal, 1) < 0) {}
+    #endif
+    return true;
+}
+
+/*
+    RemoteExecutor : stats - Retrieve the current traffic stats of the executor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return RemoteStats - Returns a copy of the stats
+*/
+AsynchTasks::RemoteStats AsynchTasks::RemoteExecutor::stats() {
+    //Check the executor exists
+    if (!mInstance) return RemoteStats();
+
+    //Copy the stats
+    std::lock_guard<std::mutex> guard(mInstance->mRequestLock);
+    RemoteStats stats = mInstance->mStats;
+    stats.credits = mInstance->mCredits;
+    stats.queued = (unsigned int)mInstance->mQueued.size();
+    return stats;
+}
+#pragma endregion
+
+#pragma region Remote Node Function Definitions
+/*
+    RemoteNode : serve - Process the Tasks submitted by RemoteExecutors until stopped
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Blocks the calling thread. The stop flag is checked at least every 100 milliseconds
+
+    param[in] pAddress - The address to listen on, in the form "tcp:host:port" or "unix:path"
+    param[in] pCredits - The number of Tasks each executor can have outstanding (Default 256)
+    param[in] pStop - An optional flag that stops the node when set (Default nullptr)
+
+    return bool - Returns false if the node couldn't listen on the address
+*/
+bool AsynchTasks::RemoteNode::serve(const std::string& pAddress, unsigned int pCredits, const std::atomic_bool* pStop) {
+    #ifndef _WIN32
+    //Open the listening socket
+    std::string error;
+    int listener = RemoteProtocol::listenOn(pAddress, error);
+    if (listener < 0) {
+        printf("%s\n", error.c_str());
+        return false;
+    }
+
+    //Create the pipe used to wake the node when Tasks finish
+    int wakePipe[2];
+    if (pipe(wakePipe) < 0) {
+        close(listener);
+        return false;
+    }
+    fcntl(wakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakePipe[1], F_SETFL, O_NONBLOCK);
+
+    //Store the connections by a unique key
+    std::unordered_map<unsigned long long, Connection> connections;
+    unsigned long long nextConnection = 1;
+
+    //Create a lock to prevent thread clashes over the finished Tasks
+    std::shared_ptr<std::mutex> resultLock = std::make_shared<std::mutex>();
+    std::shared_ptr<std::vector<std::shared_ptr<Result>>> results = std::make_shared<std::vector<std::shared_ptr<Result>>>();
+
+    //Store the wake descriptor for Tasks that outlive the node
+    std::shared_ptr<int> wake = std::make_shared<int>(wakePipe[1]);
+
+    //Loop until stopped
+    std::vector<pollfd> files;
+    std::vector<unsigned long long> keys;
+    std::vector<std::shared_ptr<Result>> finished;
+    char buffer[64 * 1024];
+    while (!pStop || !*pStop) {
+        //Set the descriptors to wait on
+        files.clear();
+        keys.clear();
+        files.push_back({ listener, POLLIN, 0 });
+        files.push_back({ wakePipe[0], POLLIN, 0 });
+        for (auto& pair : connections) {
+            files.push_back({ pair.second.socket, (short)(POLLIN | (pair.second.sent < pair.second.sending.size() ? POLLOUT : 0)), 0 });
+            keys.push_back(pair.first);
+        }
+
+        //Wait for activity
+        if (poll(files.data(), (nfds_t)files.size(), 100) < 0 && errno != EINTR) break;
+
+        //Accept new connections
+        if (files[0].revents & POLLIN) {
+            int file = accept(listener, nullptr, nullptr);
+            if (file >= 0) {
+                //Set up the connection
+                fcntl(file, F_SETFD, FD_CLOEXEC);
+                fcntl(file, F_SETFL, fcntl(file, F_GETFL) | O_NONBLOCK);
+                int enable = 1;
+                setsockopt(file, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                Connection& connection = connections.emplace(nextConnection++, Connection(file)).first->second;
+
+                //Send the Hello frame
+                size_t start = RemoteProtocol::beginFrame(connection.sending, RemoteProtocol::Hello);
+                RemoteProtocol::putU32(connection.sending, pCredits);
+                RemoteProtocol::putU32(connection.sending, (unsigned int)RemoteProtocol::MAX_FRAME_SIZE);
+                RemoteProtocol::endFrame(connection.sending, start, 0);
+            }
+        }
+
+        //Clear the wake signals
+        if (files[1].revents) while (::read(wakePipe[0], buffer, sizeof(buffer)) == (ssize_t)sizeof(buffer));
+
+        //Service the connections
+        for (size_t i = 0; i < keys.size(); i++) {
+            Connection& connection = connections.at(keys[i]);
+            short events = files[i + 2].revents;
+            bool closed = false;
+
+            //Send the pending data
+            if (events & POLLOUT) {
+                #ifdef MSG_NOSIGNAL
+                ssize_t count = send(connection.socket, connection.sending.data() + connection.sent, connection.sending.size() - connection.sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+                #else
+                ssize_t count = send(connection.socket, connection.sending.data() + connection.sent, connection.sending.size() - connection.sent, MSG_DONTWAIT);
+                #endif
+                if (count > 0) connection.sent += (size_t)count;
+                else if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) closed = true;
+                if (connection.sent == connection.sending.size()) {
+                    connection.sending.clear();
+                    connection.sent = 0;
+                }
+            }
+
+            //Receive the submitted Tasks
+            if (!closed && (events & (POLLIN | POLLHUP | POLLERR))) {
+                ssize_t count = recv(connection.socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (count == 0 || (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) closed = true;
+                else if (count > 0) connection.received.insert(connection.received.end(), buffer, buffer + count);
+
+                //Decode the complete frames
+                size_t offset = 0;
+                RemoteProtocol::EFrame type;
+                unsigned short records;
+                const char* body;
+                size_t length;
+                int result = 0;
+                while (!closed && (result = RemoteProtocol::readFrame(connection.received, offset, type, records, body, length)) > 0) {
+                    //Ignore frames other than submissions
+                    if (type != RemoteProtocol::Submit) continue;
+
+                    //Read the records
+                    const char* end = body + length;
+                    for (unsigned short r = 0; r < records && (size_t)(end - body) >= RemoteProtocol::TASK_RECORD_SIZE; r++) {
+                        //Read the record header
+                        std::shared_ptr<Result> finish = std::make_shared<Result>();
+                        finish->connection = keys[i];
+                        finish->id = RemoteProtocol::getU64(body);
+                        taskKind kind = RemoteProtocol::getU32(body + 8);
+                        unsigned int size = RemoteProtocol::getU32(body + 12);
+                        body += RemoteProtocol::TASK_RECORD_SIZE;
+                        if ((size_t)(end - body) < size) break;
+                        IOBuffer payload(body, body + size);
+                        body += size;
+
+                        //Check the executor has credit for the Task
+                        if (connection.outstanding >= pCredits) {
+                            const char* description = "The RemoteExecutor exceeded its credits";
+                            finish->status = RemoteProtocol::Failure;
+                            finish->data.assign(description, description + strlen(description));
+                            finished.push_back(finish);
+                            continue;
+                        }
+
+                        //Create the Task, storing the result once processed
+                        finish->task = TaskManager::createTask<IOBuffer>();
+                        Result* target = finish.get();
+                        finish->task->callback = [target](IOBuffer& pResult) { target->data = std::move(pResult); };
+
+                        //Collect the Task once it has finished
+                        TaskManager::setFinishHook(*finish->task, [finish, resultLock, results, wake]() {
+                            //Store the status of the Task
+                            if (finish->task->status == ETaskStatus::Error) {
+                                finish->status = RemoteProtocol::Failure;
+                                finish->data.assign(finish->task->error.value().begin(), finish->task->error.value().end());
+                            }
+                            else finish->status = RemoteProtocol::Success;
+
+                            //Release the hook, as it keeps the result alive
+                            TaskManager::setFinishHook(*finish->task, nullptr);
+
+                            //Add the result and wake the node
+                            std::lock_guard<std::mutex> guard(*resultLock);
+                            results->push_back(finish);
+                            char signal = 0;
+                            if (*wake >= 0 && ::write(*wake, &signal, 1) < 0) {}
+                        });
+
+                        //Process the Task on the Workers
+                        ++connection.outstanding;
+                        if (!TaskRegistry::addTask(finish->task, kind, std::move(payload))) {
+                            //Report the kind isn't registered
+                            --connection.outstanding;
+                            TaskManager::setFinishHook(*finish->task, nullptr);
+                            std::string description = "The Task kind " + std::to_string(kind) + " is not registered with the RemoteNode";
+                            finish->status = RemoteProtocol::Failure;
+                            finish->data.assign(description.begin(), description.end());
+                            finish->task.reset();
+                            finished.push_back(finish);
+                        }
+                    }
+                }
+                connection.received.erase(connection.received.begin(), connection.received.begin() + offset);
+                if (result < 0) closed = true;
+            }
+
+            //Remove closed connections, their outstanding results are dropped
+            if (closed) {
+                close(connection.socket);
+                connections.erase(keys[i]);
+            }
+        }
+
+        //Collect the finished Tasks
+        resultLock->lock();
+        finished.insert(finished.end(), results->begin(), results->end());
+        results->clear();
+        resultLock->unlock();
+
+        //Batch the results of each connection into frames
+        std::unordered_map<unsigned long long, std::pair<size_t, unsigned short>> frames;
+        for (auto& result : finished) {
+            //Find the connection, skipping results for closed connections
+            auto found = connections.find(result->connection);
+            if (found == connections.end()) continue;
+            Connection& connection = found->second;
+            if (result->task) --connection.outstanding;
+
+            //Fail results too large for a frame, the executor would reject the frame and drop the connection
+            if (RemoteProtocol::HEADER_SIZE + RemoteProtocol::RESULT_RECORD_SIZE + result->data.size() > RemoteProtocol::MAX_FRAME_SIZE) {
+                std::string description = "The result of the Task (" + std::to_string(result->data.size()) + " bytes) exceeds the maximum frame size of the RemoteNode";
+                result->status = RemoteProtocol::Failure;
+                result->data.assign(description.begin(), description.end());
+            }
+
+            //Start a new frame when required
+            auto frame = frames.find(result->connection);
+            if (frame == frames.end() || frame->second.second == 0xFFFF ||
+                connection.sending.size() - frame->second.first + RemoteProtocol::RESULT_RECORD_SIZE + result->data.size() > RemoteProtocol::MAX_FRAME_SIZE) {
+                if (frame != frames.end()) RemoteProtocol::endFrame(connection.sending, frame->second.first, frame->second.second);
+                frames[result->connection] = std::make_pair(RemoteProtocol::beginFrame(connection.sending, RemoteProtocol::Results), (unsigned short)0);
+                frame = frames.find(result->connection);
+            }
+
+            //Encode the result
+            RemoteProtocol::putU64(connection.sending, result->id);
+            RemoteProtocol::putU8(connection.sending, result->status);
+            RemoteProtocol::putU32(connection.sending, (unsigned int)result->data.size());
+            connection.sending.insert(connection.sending.end(), result->data.begin(), result->data.end());
+            ++frame->second.second;
+        }
+        for (auto& frame : frames)
+            RemoteProtocol::endFrame(connections.at(frame.first).sending, frame.second.first, frame.second.second);
+        finished.clear();
+    }
+
+    //Close the connections
+    for (auto& pair : connections) close(pair.second.socket);
+    close(listener);
+    if (!pAddress.compare(0, 5, "unix:")) unlink(pAddress.c_str() + 5);
+
+    //Close the wake pipe once the outstanding Tasks can no longer use it
+    resultLock->lock();
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    *wake = -1;
+    resultLock->unlock();
+    return true;
+    #else
+    printf("The RemoteNode is not supported on this platform");
+    return false;
+    #endif
+}
+#pragma endregion
+#endif
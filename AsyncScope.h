@@ -0,0 +1,430 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <condition_variable>
+#include <type_traits>
+#include <cstddef>
+#include <new>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with structured scopes, that own
+ *      the short lived Tasks spawned into them and wait for all of them
+ *      before the scope is left.
+**/
+namespace AsynchTasks {
+    #pragma region Task Scope Decleration
+    /*
+     *      Name: TaskScope
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Fan out work from within a function without heap allocating a
+     *      Task for each piece. Spawned Tasks, and the reference counts the
+     *      Task Manager uses to hold them, are placed in storage provided to
+     *      the scope (E.g. a buffer on the stack), falling back to the heap
+     *      once the storage is full.
+     *
+     *      Waiting on the scope processes its Tasks that haven't been given
+     *      to a Worker on the waiting thread, so scopes can be nested inside
+     *      of Tasks without running out of Workers. The first exception
+     *      thrown by a Task of the scope is rethrown by wait.
+     *
+     *      Requires:
+     *      The TaskManager must be created before the scope and destroyed
+     *      after it. The destructor waits for the Tasks but discards their
+     *      errors, call wait to receive them.
+    **/
+    class TaskScope {
+        //! Set the scoped Tasks as friends to report their errors
+        template<class> friend class Asynch_Scoped_Task_Job;
+
+        //! Prototype the allocator used for the reference counts of the Tasks
+        template<class T> struct Allocator;
+
+        /*----------Variables----------*/
+        //! Store the memory the Tasks are placed in
+        char* mStorage;
+        size_t mCapacity;
+        size_t mUsed;
+
+        //! Count the Tasks that are still referenced by the Task Manager
+        size_t mPending;
+
+        //! Store the first error thrown by a Task
+        std::exception_ptr mError;
+
+        //! Create a lock to prevent thread clashes over the storage, count and error
+        std::mutex mLock;
+
+        //! Signal the waiting thread when a Task has been released
+        std::condition_variable mReleased;
+
+        /*----------Functions----------*/
+        //! Place an object in the storage, or on the heap once full
+        void* allocate(size_t pBytes, size_t pAlignment);
+
+        //! Release the memory of an object placed by allocate
+        void free(void* pMemory);
+
+        //! Count a Task as released once its memory is no longer used
+        void release();
+
+        //! Store an error thrown by a Task
+        void fail(const std::exception_ptr& pError);
+
+    public:
+        //! Create a scope placing its Tasks in the provided storage
+        TaskScope(void* pStorage = nullptr, size_t pBytes = 0);
+
+        //! Wait for the Tasks of the scope
+        ~TaskScope();
+
+        TaskScope(const TaskScope&) = delete;
+        TaskScope& operator=(const TaskScope&) = delete;
+
+        //! Task options
+        template<class F> bool spawn(F&& pFunction, ETaskPriority pPriority = Low_Priority);
+        void wait();
+
+        //! Retrieve the number of Tasks that haven't been released
+        size_t pending();
+    };
+
+    /*
+     *      Name: InlineTaskScope
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Provide a TaskScope with its storage inside of the object, so a
+     *      scope declared as a local variable places its Tasks on the stack.
+     *
+     *      Requires:
+     *      Each Task is a complete Asynch_Task_Job<void> (576 bytes on 64-bit
+     *      GCC) plus its function and reference count, so allow roughly 700
+     *      bytes per Task that is expected to be pending at once. Most of
+     *      that is the state every Task carries for the properties, finish
+     *      hooks, retries and batches, not the work itself. A scope removes
+     *      the heap allocation from a fan-out, but not that per-Task cost, so
+     *      the innermost fan-outs should still give each Task enough work to
+     *      cover it.
+    **/
+    template<size_t Bytes>
+    class InlineTaskScope : public TaskScope {
+        //! Store the Tasks of the scope
+        alignas(std::max_align_t) char mBuffer[Bytes];
+
+    public:
+        //! Create the scope using the internal storage
+        InlineTaskScope() : TaskScope(mBuffer, Bytes) {}
+
+        //! Wait for the Tasks before the storage is destroyed
+        ~InlineTaskScope() { try { wait(); } catch (...) {} }
+    };
+    #pragma endregion
+
+    #pragma region Scoped Task Definition
+    /*
+     *      Name: Asynch_Scoped_Task_Job
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Extend a Task with the function it processes and the scope it was
+     *      spawned into. Errors thrown by the function are given to the scope
+     *      and then flagged on the Task, so the metrics and traces count it as
+     *      failed.
+    **/
+    template<class F>
+    class Asynch_Scoped_Task_Job : public Asynch_Task_Job<void> {
+        //! Set as a friend of the scope to allow for construction
+        friend class TaskScope;
+
+        //! Store the scope the Task was spawned into
+        TaskScope& mOwner;
+
+        //! Store the function to process
+        F mFunction;
+
+        /*----------Functions----------*/
+        //! Restrict Job creation to the scope
+        template<class Function>
+        Asynch_Scoped_Task_Job(TaskScope& pOwner, Function&& pFunction) :
+            mOwner(pOwner),
+            mFunction(std::forward<Function>(pFunction))
+        {
+            mScope = &pOwner;
+            mProcess = [this]() { run(); };
+        }
+
+        //! Process the function, giving errors to the scope
+        inline void run() {
+            try { mFunction(); }
+            catch (...) {
+                mOwner.fail(std::current_exception());
+                throw;
+            }
+        }
+
+        //! Identify the function rather than the function calling it
+        const std::type_info& processType() const override { return typeid(F); }
+    };
+    #pragma endregion
+
+    #pragma region Allocator Definition
+    /*
+     *      Name: Allocator
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Place the reference counts of the Tasks in the storage of the
+     *      scope. Deallocating the reference count is the last use of a Task,
+     *      so it is where the Task is counted as released.
+    **/
+    template<class T>
+    struct TaskScope::Allocator {
+        typedef T value_type;
+
+        //! Store the scope to allocate from
+        TaskScope* scope;
+
+        //! Create the allocator for a scope
+        Allocator(TaskScope* pScope) : scope(pScope) {}
+        template<class U> Allocator(const Allocator<U>& pOther) : scope(pOther.scope) {}
+
+        //! Allocate and deallocate memory from the scope
+        inline T* allocate(size_t pCount) { return (T*)scope->allocate(pCount * sizeof(T), alignof(T)); }
+        inline void deallocate(T* pMemory, size_t) {
+            TaskScope* owner = scope;
+            owner->free(pMemory);
+            owner->release();
+        }
+
+        //! Compare allocators by their scope
+        template<class U> inline bool operator==(const Allocator<U>& pOther) const { return scope == pOther.scope; }
+        template<class U> inline bool operator!=(const Allocator<U>& pOther) const { return scope != pOther.scope; }
+    };
+    #pragma endregion
+
+    #pragma region Template Definitions
+    /*
+        TaskScope : spawn - Add a function to the TaskManager as a Task of the scope
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The Task is placed in the storage of the scope with the function, and is processed
+        without a callback. The function is stored in a std::function that only captures the
+        Task, so it doesn't allocate
+
+        param[in] pFunction - The function to process
+        param[in] pPriority - The priority of the Task (Default Low_Priority)
+
+        return bool - Returns true if the Task was added to the TaskManager
+    */
+    template<class F>
+    inline bool TaskScope::spawn(F&& pFunction, ETaskPriority pPriority) {
+        typedef Asynch_Scoped_Task_Job<typename std::decay<F>::type> Job;
+
+        //Ensure the Task Manager exists
+        if (!TaskManager::mInstance) return false;
+
+        //Construct the Task in the storage
+        void* memory = allocate(sizeof(Job), alignof(Job));
+        Job* job;
+        try { job = new (memory) Job(*this, std::forward<F>(pFunction)); }
+        catch (...) { free(memory); throw; }
+
+        //Count the Task before its reference count exists, as releasing the count releases the Task
+        mLock.lock();
+        ++mPending;
+        mLock.unlock();
+
+        //Share the Task with the Task Manager, destroying it in place once released
+        std::shared_ptr<Asynch_Task_Job<void>> task;
+        try { task = std::shared_ptr<Asynch_Task_Job<void>>(job, [this](Job* pJob) { pJob->~Job(); free(pJob); }, Allocator<char>(this)); }
+        catch (...) {
+            release();
+            throw;
+        }
+
+        //Add the Task to the list for processing
+        TaskManager::setPriority(*task, pPriority);
+        TaskManager::lockTask(*task);
+        TaskManager::queueTask(task);
+        return true;
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+#pragma region Task Scope Function Definitions
+/*
+    TaskScope : Constructor - Initialise the scope with the storage for its Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pStorage - The memory to place the Tasks in, which must outlive the scope
+                         (Default nullptr places the Tasks on the heap)
+    param[in] pBytes - The size of the storage in bytes
+*/
+AsynchTasks::TaskScope::TaskScope(void* pStorage, size_t pBytes) :
+    mStorage((char*)pStorage),
+    mCapacity(pStorage ? pBytes : 0),
+    mUsed(0),
+    mPending(0)
+{}
+
+/*
+    TaskScope : Destructor - Wait for the Tasks of the scope, discarding their errors
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::TaskScope::~TaskScope() {
+    try { wait(); }
+    catch (...) {}
+}
+
+/*
+    TaskScope : allocate - Place an object in the storage of the scope
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBytes - The size of the object
+    param[in] pAlignment - The alignment of the object
+
+    return void* - Returns the memory for the object, from the heap if the storage is full
+*/
+void* AsynchTasks::TaskScope::allocate(size_t pBytes, size_t pAlignment) {
+    //Take the next aligned memory from the storage
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        const size_t start = (mUsed + pAlignment - 1) / pAlignment * pAlignment;
+        if (start + pBytes <= mCapacity) {
+            mUsed = start + pBytes;
+            return mStorage + start;
+        }
+    }
+
+    //Fall back to the heap
+    return ::operator new(pBytes);
+}
+
+/*
+    TaskScope : free - Release the memory of an object placed by allocate
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Memory in the storage is reused once all of the Tasks have been released
+
+    param[in] pMemory - The memory to release
+*/
+void AsynchTasks::TaskScope::free(void* pMemory) {
+    if ((char*)pMemory < mStorage || (char*)pMemory >= mStorage + mCapacity)
+        ::operator delete(pMemory);
+}
+
+/*
+    TaskScope : release - Count a Task of the scope as no longer being used
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TaskScope::release() {
+    std::lock_guard<std::mutex> guard(mLock);
+    if (!--mPending) mReleased.notify_all();
+}
+
+/*
+    TaskScope : fail - Store the error thrown by a Task, keeping the first
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pError - The error thrown
+*/
+void AsynchTasks::TaskScope::fail(const std::exception_ptr& pError) {
+    std::lock_guard<std::mutex> guard(mLock);
+    if (!mError) mError = pError;
+}
+
+/*
+    TaskScope : wait - Wait for all of the Tasks of the scope, helping to process them
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Tasks that haven't been given to a Worker are processed on the calling thread, including
+    Tasks spawned by the Tasks of the scope while waiting. The scope can be used again once
+    this returns
+
+    Requires:
+    Must not be called from a Task of the scope
+*/
+void AsynchTasks::TaskScope::wait() {
+    //Loop until every Task has been released
+    std::unique_lock<std::mutex> lock(mLock);
+    while (mPending) {
+        //Process a Task of the scope that is waiting for a Worker
+        lock.unlock();
+        const bool helped = TaskManager::runScoped(this);
+        lock.lock();
+
+        //Wait for the Workers to finish the remaining Tasks
+        if (!helped && mPending) mReleased.wait_for(lock, std::chrono::milliseconds(1));
+    }
+
+    //Reuse the storage and take the error
+    mUsed = 0;
+    std::exception_ptr error = std::move(mError);
+    mError = nullptr;
+    lock.unlock();
+
+    //Pass the error on
+    if (error) std::rethrow_exception(error);
+}
+
+/*
+    TaskScope : pending - Retrieve the number of Tasks that are still held by the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of Tasks not yet released
+*/
+size_t AsynchTasks::TaskScope::pending() {
+    std::lock_guard<std::mutex> guard(mLock);
+    return mPending;
+}
+#pragma endregion
+#endif
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+
+#include <unordered_map>
+
+#include <stdexcept>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with serialisable Tasks, which
+ *      are described entirely by a registered kind and a byte payload so
+ *      that they can be executed outside of the submitting process.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the value used to identify the kind of a serialisable Task
+    typedef unsigned int taskKind;
+
+    //! Define the function used to process the payload of a serialisable Task
+    typedef std::function<IOBuffer(const char* pData, size_t pSize)> kindProcess;
+    #pragma endregion
+
+    #pragma region Task Registry Decleration
+    /*
+     *      Name: TaskRegistry
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the process functions of the serialisable Task kinds. A
+     *      serialisable Task is a Task<IOBuffer> whose result is produced by
+     *      the process registered for its kind from its payload alone.
+     *
+     *      Requires:
+     *      Kinds must be registered before any subsystem that executes them
+     *      is created (worker processes register their own kinds before
+     *      entering ProcessPool::runWorker). Registered processes must not
+     *      rely on state outside of their payload, as they may run in another
+     *      process.
+    **/
+    class TaskRegistry {
+        //! Set the process pool as a friend to allow for a copy of the kinds to be taken
+        friend class ProcessPool;
+
+        //! Prototype the internal kind object
+        struct Kind;
+
+        /*----------Variables----------*/
+        //! Store the registered kinds
+        static std::unordered_map<taskKind, Kind> mKinds;
+
+        //! Create a lock to prevent thread clashes over the kinds
+        static std::mutex mKindLock;
+
+        /*----------Functions----------*/
+        //! Retrieve a registered kind
+        static const Kind* find(taskKind pKind);
+
+    public:
+        //! Registration options
+        static bool registerKind(taskKind pKind, const std::string& pName, const kindProcess& pProcess);
+        static bool isRegistered(taskKind pKind);
+        static std::string nameOf(taskKind pKind);
+
+        //! Execution options
+        static IOBuffer execute(taskKind pKind, const char* pData, size_t pSize);
+        static bool addTask(Task<IOBuffer>& pTask, taskKind pKind, IOBuffer pPayload);
+    };
+    #pragma endregion
+
+    #pragma region Kind Definition
+    /*
+     *      Name: Kind
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the details of a single registered kind
+    **/
+    struct TaskRegistry::Kind {
+        //! Store the name used to describe the kind
+        std::string name;
+
+        //! Store the function used to process payloads of the kind
+        kindProcess process;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define the static registry values
+std::unordered_map<AsynchTasks::taskKind, AsynchTasks::TaskRegistry::Kind> AsynchTasks::TaskRegistry::mKinds;
+std::mutex AsynchTasks::TaskRegistry::mKindLock;
+
+#pragma region Task Registry Function Definitions
+/*
+    TaskRegistry : find - Retrieve the details of a registered kind
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pKind - The kind to retrieve
+
+    return const Kind* - Returns a pointer to the kind or nullptr if it isn't registered
+*/
+const AsynchTasks::TaskRegistry::Kind* AsynchTasks::TaskRegistry::find(taskKind pKind) {
+    //Kinds are never removed so the pointer remains valid after unlocking
+    std::lock_guard<std::mutex> guard(mKindLock);
+    auto found = mKinds.find(pKind);
+    return (found != mKinds.end() ? &found->second : nullptr);
+}
+
+/*
+    TaskRegistry : registerKind - Register the process function of a serialisable Task kind
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pKind - The value used to identify the kind
+    param[in] pName - The name used to describe the kind
+    param[in] pProcess - The function used to create the result from a payload
+
+    return bool - Returns false if the kind is already registered or the process is empty
+*/
+bool AsynchTasks::TaskRegistry::registerKind(taskKind pKind, const std::string& pName, const kindProcess& pProcess) {
+    //Ensure the process is valid
+    if (!pProcess) return false;
+
+    //Add the kind
+    std::lock_guard<std::mutex> guard(mKindLock);
+    if (mKinds.find(pKind) != mKinds.end()) return false;
+    Kind& kind = mKinds[pKind];
+    kind.name = pName;
+    kind.process = pProcess;
+    return true;
+}
+
+/*
+    TaskRegistry : isRegistered - Check if a kind has been registered
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pKind - The kind to check
+
+    return bool - Returns true if the kind is registered
+*/
+bool AsynchTasks::TaskRegistry::isRegistered(taskKind pKind) {
+    return (find(pKind) != nullptr);
+}
+
+/*
+    TaskRegistry : nameOf - Retrieve the name of a registered kind
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pKind - The kind to retrieve the name of
+
+    return std::string - Returns the name of the kind or an empty string if it isn't registered
+*/
+std::string AsynchTasks::TaskRegistry::nameOf(taskKind pKind) {
+    const Kind* kind = find(pKind);
+    return (kind ? kind->name : std::string());
+}
+
+/*
+    TaskRegistry : execute - Process a payload with the function registered for its kind
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Throws a std::runtime_error if the kind is not registered. Exceptions raised by the
+    process are passed on to the caller
+
+    param[in] pKind - The kind of the Task
+    param[in] pData - A pointer to the payload
+    param[in] pSize - The number of bytes in the payload
+
+    return IOBuffer - Returns the result created by the process
+*/
+AsynchTasks::IOBuffer AsynchTasks::TaskRegistry::execute(taskKind pKind, const char* pData, size_t pSize) {
+    //Find the kind
+    const Kind* kind = find(pKind);
+    if (!kind) throw std::runtime_error("The Task kind " + std::to_string(pKind) + " is not registered");
+
+    //Process the payload
+    return kind->process(pData, pSize);
+}
+
+/*
+    TaskRegistry : addTask - Process a serialisable Task on the Workers of the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - A Task<IOBuffer> object to receive the result. Once added the property
+                          values will be uneditable
+    param[in] pKind - The kind of the Task
+    param[in] pPayload - The payload to process
+
+    return bool - Returns a flag determining if the Task was added successfully
+*/
+bool AsynchTasks::TaskRegistry::addTask(Task<IOBuffer>& pTask, taskKind pKind, IOBuffer pPayload) {
+    //Ensure that the pointer is valid and the kind is registered
+    if (!pTask || !isRegistered(pKind)) return false;
+
+    //Set the process to execute the payload
+    std::shared_ptr<IOBuffer> payload = std::make_shared<IOBuffer>(std::move(pPayload));
+    pTask->process = [pKind, payload]() -> IOBuffer {
+        return execute(pKind, payload->data(), payload->size());
+    };
+
+    //Add the Task to the Task Manager
+    return TaskManager::addTask(pTask);
+}
+#pragma endregion
+#endif
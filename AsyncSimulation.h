@@ -0,0 +1,638 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <deque>
+#include <map>
+#include <queue>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a discrete event simulator
+ *      of the TaskManager scheduling, used to predict queue latency before
+ *      changing the number of Workers or the priorities of Tasks.
+**/
+namespace AsynchTasks {
+    #pragma region Distribution Decleration
+    /*
+     *      Name: Distribution
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe a random distribution of durations (in seconds) used to
+     *      generate synthetic workloads
+    **/
+    struct Distribution {
+        //! Label the shapes of distribution that can be sampled
+        enum EShape : char {
+            //! Always the first value
+            Fixed,
+
+            //! Evenly spread between the first and second values
+            Uniform,
+
+            //! Exponentially distributed with a mean of the first value
+            Exponential,
+
+            //! The first value, or the second value with a probability of the third value
+            Bimodal,
+
+            //! Heavy tailed Pareto distribution with a minimum of the first value and a shape of the second
+            Pareto
+        };
+
+        //! Store the shape and the values describing it
+        EShape shape;
+        double values[3];
+
+        //! Create the different distributions
+        static Distribution fixed(double pValue);
+        static Distribution uniform(double pMin, double pMax);
+        static Distribution exponential(double pMean);
+        static Distribution bimodal(double pShort, double pLong, double pLongChance);
+        static Distribution pareto(double pMin, double pShape);
+
+        //! Take a random value from the distribution
+        double sample(std::mt19937_64& pGenerator) const;
+
+        //! Calculate the average value of the distribution
+        double mean() const;
+    };
+    #pragma endregion
+
+    #pragma region Scheduler Simulator Decleration
+    /*
+     *      Name: SimulatedWorkload
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe a synthetic workload of Tasks arriving at the TaskManager
+    **/
+    struct SimulatedWorkload {
+        //! Store the number of Workers processing the Tasks
+        unsigned int workers = 4;
+
+        //! Store the number of Tasks that arrive
+        unsigned int taskCount = 10000;
+
+        //! Store the average number of Tasks arriving per second
+        double arrivalRate = 500.0;
+
+        //! Flag if arrivals are random (Poisson) or evenly spaced
+        bool poissonArrivals = true;
+
+        //! Store the distribution of the time taken to process a Task
+        Distribution serviceTime = Distribution::exponential(0.005);
+
+        //! Store the priorities given to the Tasks and their relative weights (empty for all Medium)
+        std::vector<std::pair<ETaskPriority, double>> priorityMix;
+
+        //! Store the time (in seconds) between a Worker becoming free and being handed a Task
+        double dispatchLatency = 0.0;
+
+        //! Store the seed used to generate the workload
+        unsigned long long seed = 1;
+    };
+
+    /*
+     *      Name: LatencySummary
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Summarise a set of latencies (in seconds)
+    **/
+    struct LatencySummary {
+        double mean;
+        double p50;
+        double p90;
+        double p99;
+        double max;
+    };
+
+    /*
+     *      Name: SimulationReport
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Report the behaviour of a workload, either predicted by the
+     *      simulator or measured from the TaskManager
+    **/
+    struct SimulationReport {
+        //! Store the number of Workers and Tasks
+        unsigned int workers;
+        unsigned int tasks;
+
+        //! Store the time (in seconds) from the first arrival to the last Task finishing
+        double duration;
+
+        //! Store the number of Tasks finished per second
+        double throughput;
+
+        //! Store the fraction of the Workers time spent processing Tasks
+        double utilisation;
+
+        //! Store the time Tasks waited for a Worker, and the time until they finished
+        LatencySummary wait;
+        LatencySummary response;
+
+        //! Store the time Tasks took to process, used to compare the measured and simulated service times
+        LatencySummary service;
+
+        //! Store the time Tasks waited for a Worker for each priority
+        std::map<unsigned int, LatencySummary, std::greater<unsigned int>> waitByPriority;
+    };
+
+    /*
+     *      Name: SchedulerSimulator
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Predict the latency of a workload by running the TaskManager
+     *      scheduling in virtual time. Waiting Tasks are ordered with the same
+     *      function the TaskManager uses (TaskManager::runsBefore) and handed
+     *      to the lowest numbered free Worker, as the organisation thread does.
+     *
+     *      The same workload can be run on the real TaskManager with measure,
+     *      where each Task sleeps for its service time, so the prediction can
+     *      be validated against a real run.
+     *
+     *      Requires:
+     *      Callbacks on update are not simulated, the latencies reported are
+     *      until the process of each Task has finished.
+    **/
+    class SchedulerSimulator {
+        //! Set the trace replayer as a friend to summarise replayed traces
+        friend class TraceReplayer;
+
+        //! Prototype the internal arrival and record objects
+        struct Arrival;
+        struct Record;
+
+        /*----------Functions----------*/
+        //! Generate the arrivals of a workload
+        static std::vector<Arrival> generate(const SimulatedWorkload& pWorkload);
+
+        //! Summarise the records of the Tasks
+        static SimulationReport summarise(const std::vector<Record>& pRecords, unsigned int pWorkers);
+        static LatencySummary summarise(std::vector<double>& pLatencies);
+
+    public:
+        //! Prevent construction, the simulator is used through static functions
+        SchedulerSimulator() = delete;
+
+        //! Predict the behaviour of a workload in virtual time
+        static SimulationReport simulate(const SimulatedWorkload& pWorkload);
+
+        //! Measure the behaviour of a workload on the TaskManager
+        static SimulationReport measure(const SimulatedWorkload& pWorkload);
+
+        //! Format a report for output
+        static std::string toText(const SimulationReport& pReport);
+    };
+    #pragma endregion
+
+    #pragma region Scheduler Simulator Definitions
+    /*
+     *      Name: Arrival
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a single Task arriving in a workload
+    **/
+    struct SchedulerSimulator::Arrival {
+        //! Store the time the Task arrives (in seconds from the start)
+        double time;
+
+        //! Store the time taken to process the Task (in seconds)
+        double service;
+
+        //! Store the priority of the Task
+        ETaskPriority priority;
+    };
+
+    /*
+     *      Name: Record
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the times (in seconds from the start) a Task was queued,
+     *      started and finished
+    **/
+    struct SchedulerSimulator::Record {
+        double queued;
+        double started;
+        double finished;
+        ETaskPriority priority;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+#pragma region Distribution Function Definitions
+/*
+    Distribution : fixed - Create a distribution that is always the same value
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pValue - The value
+
+    return Distribution - Returns the distribution
+*/
+AsynchTasks::Distribution AsynchTasks::Distribution::fixed(double pValue) {
+    return { Fixed, { pValue, 0.0, 0.0 } };
+}
+
+/*
+    Distribution : uniform - Create a distribution evenly spread over a range
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pMin - The smallest value
+    param[in] pMax - The largest value
+
+    return Distribution - Returns the distribution
+*/
+AsynchTasks::Distribution AsynchTasks::Distribution::uniform(double pMin, double pMax) {
+    return { Uniform, { pMin, pMax, 0.0 } };
+}
+
+/*
+    Distribution : exponential - Create an exponential distribution
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pMean - The average value
+
+    return Distribution - Returns the distribution
+*/
+AsynchTasks::Distribution AsynchTasks::Distribution::exponential(double pMean) {
+    return { Exponential, { pMean, 0.0, 0.0 } };
+}
+
+/*
+    Distribution : bimodal - Create a distribution of mostly short values with occasional long values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pShort - The common short value
+    param[in] pLong - The occasional long value
+    param[in] pLongChance - The probability (0 - 1) of the long value
+
+    return Distribution - Returns the distribution
+*/
+AsynchTasks::Distribution AsynchTasks::Distribution::bimodal(double pShort, double pLong, double pLongChance) {
+    return { Bimodal, { pShort, pLong, pLongChance } };
+}
+
+/*
+    Distribution : pareto - Create a heavy tailed Pareto distribution
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Smaller shapes give heavier tails, the mean is infinite for shapes of 1 or less
+
+    param[in] pMin - The smallest value
+    param[in] pShape - The shape (alpha) of the tail
+
+    return Distribution - Returns the distribution
+*/
+AsynchTasks::Distribution AsynchTasks::Distribution::pareto(double pMin, double pShape) {
+    return { Pareto, { pMin, pShape, 0.0 } };
+}
+
+/*
+    Distribution : sample - Take a random value from the distribution
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pGenerator - The random generator to use
+
+    return double - Returns the value
+*/
+double AsynchTasks::Distribution::sample(std::mt19937_64& pGenerator) const {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    switch (shape) {
+    case Uniform: return values[0] + (values[1] - values[0]) * unit(pGenerator);
+    case Exponential: return std::exponential_distribution<double>(1.0 / values[0])(pGenerator);
+    case Bimodal: return (unit(pGenerator) < values[2] ? values[1] : values[0]);
+    case Pareto: return values[0] / std::pow(1.0 - unit(pGenerator), 1.0 / values[1]);
+    default: return values[0];
+    }
+}
+
+/*
+    Distribution : mean - Calculate the average value of the distribution
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return double - Returns the average value
+*/
+double AsynchTasks::Distribution::mean() const {
+    switch (shape) {
+    case Uniform: return (values[0] + values[1]) * 0.5;
+    case Bimodal: return values[0] + (values[1] - values[0]) * values[2];
+    case Pareto: return (values[1] > 1.0 ? values[1] * values[0] / (values[1] - 1.0) : HUGE_VAL);
+    default: return values[0];
+    }
+}
+#pragma endregion
+
+#pragma region Scheduler Simulator Function Definitions
+/*
+    SchedulerSimulator : generate - Generate the arrivals of a workload
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pWorkload - The workload to generate
+
+    return std::vector<Arrival> - Returns the arrivals in the order they occur
+*/
+std::vector<AsynchTasks::SchedulerSimulator::Arrival> AsynchTasks::SchedulerSimulator::generate(const SimulatedWorkload& pWorkload) {
+    //Create the generator from the seed so simulated and measured runs match
+    std::mt19937_64 generator(pWorkload.seed);
+    std::exponential_distribution<double> gap(pWorkload.arrivalRate);
+
+    //Create the distribution of priorities
+    std::vector<double> weights;
+    for (auto& priority : pWorkload.priorityMix) weights.push_back(priority.second);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+
+    //Generate the arrivals
+    std::vector<Arrival> arrivals(pWorkload.taskCount);
+    double time = 0.0;
+    for (auto& arrival : arrivals) {
+        arrival.time = time;
+        arrival.service = std::max(0.0, pWorkload.serviceTime.sample(generator));
+        arrival.priority = (pWorkload.priorityMix.size() ? pWorkload.priorityMix[pick(generator)].first : Medium_Priority);
+        time += (pWorkload.poissonArrivals ? gap(generator) : 1.0 / pWorkload.arrivalRate);
+    }
+    return arrivals;
+}
+
+/*
+    SchedulerSimulator : summarise - Summarise a set of latencies
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pLatencies - The latencies to summarise. The values are sorted
+
+    return LatencySummary - Returns the summary
+*/
+AsynchTasks::LatencySummary AsynchTasks::SchedulerSimulator::summarise(std::vector<double>& pLatencies) {
+    //Check there are latencies
+    LatencySummary summary = {};
+    if (pLatencies.empty()) return summary;
+
+    //Sort the latencies to find the percentiles by rank
+    std::sort(pLatencies.begin(), pLatencies.end());
+    auto percentile = [&](double pFraction) { return pLatencies[std::min(pLatencies.size() - 1, (size_t)(pFraction * (double)pLatencies.size()))]; };
+    double total = 0.0;
+    for (double latency : pLatencies) total += latency;
+    summary.mean = total / (double)pLatencies.size();
+    summary.p50 = percentile(0.5);
+    summary.p90 = percentile(0.9);
+    summary.p99 = percentile(0.99);
+    summary.max = pLatencies.back();
+    return summary;
+}
+
+/*
+    SchedulerSimulator : summarise - Summarise the records of the Tasks of a workload
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pRecords - The records of the Tasks
+    param[in] pWorkers - The number of Workers that processed the Tasks
+
+    return SimulationReport - Returns the report
+*/
+AsynchTasks::SimulationReport AsynchTasks::SchedulerSimulator::summarise(const std::vector<Record>& pRecords, unsigned int pWorkers) {
+    //Store the report
+    SimulationReport report = {};
+    report.workers = pWorkers;
+    report.tasks = (unsigned int)pRecords.size();
+    if (pRecords.empty()) return report;
+
+    //Gather the latencies
+    std::vector<double> waits, responses, services;
+    std::map<unsigned int, std::vector<double>> priorityWaits;
+    double first = pRecords[0].queued, last = 0.0, busy = 0.0;
+    for (auto& record : pRecords) {
+        waits.push_back(record.started - record.queued);
+        responses.push_back(record.finished - record.queued);
+        services.push_back(record.finished - record.started);
+        priorityWaits[record.priority].push_back(record.started - record.queued);
+        first = std::min(first, record.queued);
+        last = std::max(last, record.finished);
+        busy += record.finished - record.started;
+    }
+
+    //Summarise the workload
+    report.duration = last - first;
+    report.throughput = (report.duration > 0.0 ? (double)report.tasks / report.duration : 0.0);
+    report.utilisation = (report.duration > 0.0 ? busy / (report.duration * (double)pWorkers) : 0.0);
+    report.wait = summarise(waits);
+    report.response = summarise(responses);
+    report.service = summarise(services);
+    for (auto& priority : priorityWaits) report.waitByPriority[priority.first] = summarise(priority.second);
+    return report;
+}
+
+/*
+    SchedulerSimulator : simulate - Predict the behaviour of a workload in virtual time
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pWorkload - The workload to simulate
+
+    return SimulationReport - Returns the predicted behaviour
+*/
+AsynchTasks::SimulationReport AsynchTasks::SchedulerSimulator::simulate(const SimulatedWorkload& pWorkload) {
+    //Generate the arrivals
+    const std::vector<Arrival> arrivals = generate(pWorkload);
+    std::vector<Record> records(arrivals.size());
+
+    //Store the Tasks waiting for a Worker, in the order they will be handed out
+    std::deque<size_t> waiting;
+
+    //Store the Workers that are free and the times the busy Workers finish
+    const unsigned int workers = std::max(pWorkload.workers, 1u);
+    std::vector<bool> free(workers, true);
+    std::priority_queue<std::pair<double, unsigned int>, std::vector<std::pair<double, unsigned int>>, std::greater<std::pair<double, unsigned int>>> finishing;
+
+    //Process the events in time order
+    size_t next = 0;
+    while (next < arrivals.size() || finishing.size()) {
+        //Finish a Task before a Task arrives at the same time
+        double now;
+        if (finishing.size() && (next == arrivals.size() || finishing.top().first <= arrivals[next].time)) {
+            now = finishing.top().first;
+            free[finishing.top().second] = true;
+            finishing.pop();
+        }
+
+        //Queue the arriving Task after the Tasks that run before it
+        else {
+            now = arrivals[next].time;
+            records[next].queued = now;
+            records[next].priority = arrivals[next].priority;
+            waiting.insert(std::upper_bound(waiting.begin(), waiting.end(), next, [&](size_t pFirst, size_t pSecond) {
+                return TaskManager::runsBefore(arrivals[pFirst].priority, arrivals[pSecond].priority);
+            }), next);
+            ++next;
+        }
+
+        //Hand the waiting Tasks to the free Workers, lowest numbered first
+        for (unsigned int i = 0; i < workers && waiting.size(); i++) {
+            if (!free[i]) continue;
+            const size_t task = waiting.front();
+            waiting.pop_front();
+            free[i] = false;
+            records[task].started = now + pWorkload.dispatchLatency;
+            records[task].finished = records[task].started + arrivals[task].service;
+            finishing.push({ records[task].finished, i });
+        }
+    }
+
+    //Summarise the simulation
+    return summarise(records, workers);
+}
+
+/*
+    SchedulerSimulator : measure - Run a workload on the TaskManager and measure its behaviour
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Blocks the calling thread until the workload has finished. Each Task sleeps for its service
+    time so the Workers behave as they are simulated regardless of the number of processors
+
+    Requires:
+    The TaskManager must be created, the number of Workers in the workload is ignored in favour
+    of the Workers of the TaskManager
+
+    param[in] pWorkload - The workload to run
+
+    return SimulationReport - Returns the measured behaviour
+*/
+AsynchTasks::SimulationReport AsynchTasks::SchedulerSimulator::measure(const SimulatedWorkload& pWorkload) {
+    //Check the Task Manager exists
+    if (!TaskManager::mInstance) return SimulationReport();
+
+    //Generate the arrivals
+    const std::vector<Arrival> arrivals = generate(pWorkload);
+    std::vector<Record> records(arrivals.size());
+
+    //Create the Tasks ahead of time so that creation isn't measured
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    auto elapsed = [start]() { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); };
+    std::vector<Task<void>> tasks(arrivals.size());
+    for (size_t i = 0; i < arrivals.size(); i++) {
+        tasks[i] = TaskManager::createTask<void>();
+        tasks[i]->priority = arrivals[i].priority;
+        tasks[i]->process = [&, i]() {
+            records[i].started = elapsed();
+            std::this_thread::sleep_for(std::chrono::duration<double>(arrivals[i].service));
+            records[i].finished = elapsed();
+        };
+    }
+
+    //Add the Tasks at their arrival times
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < arrivals.size(); i++) {
+        std::this_thread::sleep_until(begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(arrivals[i].time)));
+        records[i].queued = elapsed();
+        records[i].priority = arrivals[i].priority;
+        TaskManager::addTask(tasks[i]);
+    }
+
+    //Wait for the Tasks to finish
+    for (auto& task : tasks) {
+        while (task->status == ETaskStatus::Pending || task->status == ETaskStatus::In_Progress)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    //Summarise the run
+    return summarise(records, TaskManager::mInstance->mWorkerCount);
+}
+
+/*
+    SchedulerSimulator : toText - Format a report as human readable text
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pReport - The report to format
+
+    return std::string - Returns the formatted report
+*/
+std::string AsynchTasks::SchedulerSimulator::toText(const SimulationReport& pReport) {
+    //Store the output
+    std::string text;
+    char line[256];
+
+    //Output the summary
+    snprintf(line, sizeof(line), "%u Tasks on %u Workers over %.3fs: %.1f Tasks per second, %.1f%% utilisation\n",
+             pReport.tasks, pReport.workers, pReport.duration, pReport.throughput, pReport.utilisation * 100.0);
+    text += line;
+
+    //Output the latencies in milliseconds
+    auto latency = [&](const char* pName, const LatencySummary& pSummary) {
+        snprintf(line, sizeof(line), "  %-20s mean %8.3fms  p50 %8.3fms  p90 %8.3fms  p99 %8.3fms  max %8.3fms\n", pName,
+                 pSummary.mean * 1000.0, pSummary.p50 * 1000.0, pSummary.p90 * 1000.0, pSummary.p99 * 1000.0, pSummary.max * 1000.0);
+        text += line;
+    };
+    latency("Wait", pReport.wait);
+    latency("Response", pReport.response);
+    latency("Service", pReport.service);
+    for (auto& priority : pReport.waitByPriority) {
+        char name[32];
+        snprintf(name, sizeof(name), "Wait (%u)", priority.first);
+        latency(name, priority.second);
+    }
+    return text;
+}
+#pragma endregion
+#endif
@@ -0,0 +1,518 @@
+#pragma once
+
+#include "AsyncTasks.h"
+
+#include <condition_variable>
+#include <unordered_map>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with lazy sources of work, which
+ *      generate the next Task on demand instead of every Task being created
+ *      and added to the TaskManager up front.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the value used to identify a source of Tasks
+    typedef unsigned long long sourceID;
+
+    //! Define the function used to generate the next job of a source. Sets the process
+    //! and returns true, or returns false once there are no more jobs
+    typedef std::function<bool(std::function<void()>& pProcess)> taskGenerator;
+    #pragma endregion
+
+    #pragma region Source Progress Decleration
+    /*
+     *      Name: SourceProgress
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Report the progress of a source of Tasks
+    **/
+    struct SourceProgress {
+        //! Store the number of jobs generated
+        unsigned long long produced;
+
+        //! Store the number of generated jobs that threw an exception
+        unsigned long long failed;
+
+        //! Store the number of generated jobs that haven't finished
+        unsigned int inFlight;
+
+        //! Flag if the source has run out of jobs (or was cancelled) and they have all finished
+        bool finished;
+    };
+    #pragma endregion
+
+    #pragma region Task Source Decleration
+    /*
+     *      Name: TaskSource
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Feed the TaskManager from generators that produce the next job of
+     *      a (possibly huge) iteration space on demand. Each source keeps its
+     *      look-ahead of jobs queued or being processed, generating the next
+     *      job as soon as one of them finishes, so the Workers are kept busy
+     *      while the memory used stays constant.
+     *
+     *      The jobs are processed by internal Tasks owned by the source, that
+     *      are reused once they have finished. Generators are called on the
+     *      thread adding the source and then on the organisation thread, so
+     *      they should be quick and are never called at the same time.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      TaskSource.
+    **/
+    class TaskSource {
+        //! Prototype the internal source object
+        struct Source;
+
+        /*----------Singleton Values----------*/
+        static TaskSource* mInstance;
+
+        //! Create a lock to prevent the finish hooks using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        TaskSource();
+        ~TaskSource() = default;
+
+        TaskSource(const TaskSource&) = delete;
+        TaskSource& operator=(const TaskSource&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the sources that haven't been waited on
+        std::unordered_map<sourceID, std::shared_ptr<Source>> mSources;
+
+        //! Store the ID to give the next source
+        sourceID mNextID;
+
+        /*----------Functions----------*/
+        //! Find a source by its ID
+        static std::shared_ptr<Source> find(sourceID pID);
+
+        //! Generate jobs until the look-ahead of a source is full
+        static void fill(const std::shared_ptr<Source>& pSource);
+
+        //! Return a finished job to its source
+        static void finish(const std::shared_ptr<Source>& pSource, const Task<void>& pJob);
+
+    public:
+        //! Main operation functionality
+        static bool create();
+        static void destroy();
+
+        //! Source options
+        static sourceID add(const taskGenerator& pGenerator, unsigned int pLookAhead = 0, ETaskPriority pPriority = Low_Priority);
+        static sourceID range(unsigned long long pCount, const std::function<void(unsigned long long)>& pProcess, unsigned int pLookAhead = 0, ETaskPriority pPriority = Low_Priority);
+        static void cancel(sourceID pID);
+
+        //! Progress options
+        static SourceProgress progress(sourceID pID);
+        static SourceProgress wait(sourceID pID);
+    };
+    #pragma endregion
+
+    #pragma region Source Definition
+    /*
+     *      Name: Source
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the generator and the internal Tasks of a single source
+    **/
+    struct TaskSource::Source {
+        //! Store the ID of the source
+        sourceID id;
+
+        //! Store the function generating the jobs
+        taskGenerator generator;
+
+        //! Store the number of jobs kept queued or being processed
+        unsigned int lookAhead;
+
+        //! Store the priority of the jobs
+        ETaskPriority priority;
+
+        //! Store the internal Tasks that aren't processing a job
+        std::vector<Task<void>> idle;
+
+        //! Store the progress of the source
+        SourceProgress progress;
+
+        //! Flag if the generator has run out of jobs or the source was cancelled
+        bool exhausted;
+
+        //! Create a lock to prevent thread clashes over the source and the generator
+        std::mutex lock;
+
+        //! Signal the threads waiting for the source to finish
+        std::condition_variable done;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::TaskSource* AsynchTasks::TaskSource::mInstance = nullptr;
+std::mutex AsynchTasks::TaskSource::mInstanceLock;
+
+#pragma region Task Source Function Definitions
+/*
+    TaskSource : Constructor - Initialise with default values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+AsynchTasks::TaskSource::TaskSource() : mNextID(1) {}
+
+/*
+    TaskSource : find - Retrieve a source by its ID
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pID - The ID of the source
+
+    return std::shared_ptr<Source> - Returns the source or nullptr if it doesn't exist
+*/
+std::shared_ptr<AsynchTasks::TaskSource::Source> AsynchTasks::TaskSource::find(sourceID pID) {
+    std::lock_guard<std::mutex> guard(mInstanceLock);
+    if (!mInstance) return nullptr;
+    auto found = mInstance->mSources.find(pID);
+    return (found != mInstance->mSources.end() ? found->second : nullptr);
+}
+
+/*
+    TaskSource : fill - Generate jobs for a source until its look-ahead is full or it runs out
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A generator that throws an exception ends the source
+
+    param[in] pSource - The source to generate the jobs of
+*/
+void AsynchTasks::TaskSource::fill(const std::shared_ptr<Source>& pSource) {
+    //Lock the source, serialising the calls to the generator
+    std::unique_lock<std::mutex> lock(pSource->lock);
+
+    //Generate jobs until the look-ahead is full
+    while (!pSource->exhausted && pSource->progress.inFlight < pSource->lookAhead) {
+        //Generate the next job
+        std::function<void()> process;
+        bool generated = false;
+        try { generated = pSource->generator(process); }
+        catch (...) { generated = false; }
+
+        //Check the source has run out
+        if (!generated || !process) {
+            pSource->exhausted = true;
+            break;
+        }
+
+        //Take an idle Task, or create one that returns itself to the source when finished
+        Task<void> job;
+        if (pSource->idle.size()) {
+            job = std::move(pSource->idle.back());
+            pSource->idle.pop_back();
+        } else {
+            job = TaskManager::createTask<void>();
+            std::weak_ptr<Source> weakSource = pSource;
+            std::weak_ptr<Asynch_Task_Job<void>> weakJob = job;
+            TaskManager::setFinishHook(*job, [weakSource, weakJob]() { finish(weakSource.lock(), weakJob.lock()); });
+        }
+
+        //Set the job values without the property validation
+        TaskManager::setProcess(*job, std::move(process));
+        TaskManager::setPriority(*job, pSource->priority);
+        if (!TaskManager::lockTask(*job)) {
+            pSource->exhausted = true;
+            break;
+        }
+
+        //Add the job to the TaskManager
+        ++pSource->progress.inFlight;
+        ++pSource->progress.produced;
+        TaskManager::queueTask(job);
+    }
+
+    //Check if the source has finished
+    if (!pSource->exhausted || pSource->progress.inFlight) return;
+    pSource->progress.finished = true;
+    pSource->generator = nullptr;
+    pSource->idle.clear();
+    lock.unlock();
+
+    //Wake the threads waiting for the source
+    pSource->done.notify_all();
+}
+
+/*
+    TaskSource : finish - Return a job that has finished processing to its source
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Raised on the organisation thread by the finish hook of the job
+
+    param[in] pSource - The source the job belongs to
+    param[in] pJob - The job that has finished
+*/
+void AsynchTasks::TaskSource::finish(const std::shared_ptr<Source>& pSource, const Task<void>& pJob) {
+    //Check the source and job still exist
+    if (!pSource || !pJob) return;
+
+    //Return the job to the idle Tasks
+    pSource->lock.lock();
+    if (pJob->status == ETaskStatus::Error) ++pSource->progress.failed;
+    TaskManager::setProcess<void>(*pJob, nullptr);
+    TaskManager::releaseTask(*pJob);
+    pSource->idle.push_back(pJob);
+    --pSource->progress.inFlight;
+    pSource->lock.unlock();
+
+    //Generate the next job
+    fill(pSource);
+}
+
+/*
+    TaskSource : create - Initialise the Task source
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return bool - Returns true if the TaskSource was created successfully
+*/
+bool AsynchTasks::TaskSource::create() {
+    //Assert that the source doesn't already exist
+    assert(!mInstance);
+
+    //Create the new source
+    TaskSource* instance = new TaskSource();
+
+    //Test to ensure the instance were created
+    if (!instance) {
+        printf("Unable to create the TaskSource singleton instance.");
+        return false;
+    }
+
+    //Publish the instance
+    mInstanceLock.lock();
+    mInstance = instance;
+    mInstanceLock.unlock();
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    TaskSource : destroy - Cancel the sources and delete the TaskSource
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Jobs already in the TaskManager are still processed, but no more are generated
+
+    Requires:
+    No other thread can be waiting on a source
+*/
+void AsynchTasks::TaskSource::destroy() {
+    //Take the singleton instance so no more sources can be found
+    mInstanceLock.lock();
+    TaskSource* instance = mInstance;
+    mInstance = nullptr;
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Cancel the sources
+        for (auto& pair : instance->mSources) {
+            pair.second->lock.lock();
+            pair.second->exhausted = true;
+            pair.second->lock.unlock();
+            fill(pair.second);
+        }
+
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    TaskSource : add - Add a generator of jobs to be processed by the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The first jobs are generated before returning. The jobs are processed without callbacks,
+    errors thrown by a job are counted in the progress of the source
+
+    param[in] pGenerator - The function generating the jobs
+    param[in] pLookAhead - The number of jobs to keep queued or being processed (Default 0
+                           keeps twice the number of Workers)
+    param[in] pPriority - The priority of the jobs (Default Low_Priority)
+
+    return sourceID - Returns the ID of the source or 0 if it couldn't be added
+*/
+AsynchTasks::sourceID AsynchTasks::TaskSource::add(const taskGenerator& pGenerator, unsigned int pLookAhead, ETaskPriority pPriority) {
+    //Ensure the managers exist and the generator is valid
+    if (!mInstance || !TaskManager::mInstance || !pGenerator) return 0;
+
+    //Create the source
+    std::shared_ptr<Source> source = std::make_shared<Source>();
+    source->generator = pGenerator;
+    source->lookAhead = (pLookAhead ? pLookAhead : TaskManager::mInstance->mWorkerCount * 2);
+    source->priority = pPriority;
+    source->progress = SourceProgress{ 0, 0, 0, false };
+    source->exhausted = false;
+
+    //Register the source
+    mInstanceLock.lock();
+    if (!mInstance) {
+        mInstanceLock.unlock();
+        return 0;
+    }
+    source->id = mInstance->mNextID++;
+    mInstance->mSources[source->id] = source;
+    mInstanceLock.unlock();
+
+    //Generate the first jobs
+    fill(source);
+    return source->id;
+}
+
+/*
+    TaskSource : range - Add a source processing each index of a range [0, pCount)
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pCount - The number of indices to process
+    param[in] pProcess - The function to process an index with
+    param[in] pLookAhead - The number of jobs to keep queued or being processed (Default 0
+                           keeps twice the number of Workers)
+    param[in] pPriority - The priority of the jobs (Default Low_Priority)
+
+    return sourceID - Returns the ID of the source or 0 if it couldn't be added
+*/
+AsynchTasks::sourceID AsynchTasks::TaskSource::range(unsigned long long pCount, const std::function<void(unsigned long long)>& pProcess, unsigned int pLookAhead, ETaskPriority pPriority) {
+    //Ensure the process is valid
+    if (!pProcess) return 0;
+
+    //Share the process between the jobs
+    std::shared_ptr<const std::function<void(unsigned long long)>> process = std::make_shared<const std::function<void(unsigned long long)>>(pProcess);
+
+    //Generate a job for each index
+    unsigned long long next = 0;
+    return add([next, pCount, process](std::function<void()>& pJob) mutable {
+        if (next >= pCount) return false;
+        unsigned long long index = next++;
+        pJob = [index, process]() { (*process)(index); };
+        return true;
+    }, pLookAhead, pPriority);
+}
+
+/*
+    TaskSource : cancel - Stop generating the jobs of a source
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Jobs already in the TaskManager are still processed, the source finishes once they have
+
+    param[in] pID - The ID of the source to cancel
+*/
+void AsynchTasks::TaskSource::cancel(sourceID pID) {
+    //Find the source
+    std::shared_ptr<Source> source = find(pID);
+    if (!source) return;
+
+    //Flag the source as exhausted
+    source->lock.lock();
+    source->exhausted = true;
+    source->lock.unlock();
+
+    //Finish the source if no jobs are in flight
+    fill(source);
+}
+
+/*
+    TaskSource : progress - Retrieve the progress of a source
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pID - The ID of the source
+
+    return SourceProgress - Returns the progress (all 0 if the source doesn't exist)
+*/
+AsynchTasks::SourceProgress AsynchTasks::TaskSource::progress(sourceID pID) {
+    //Find the source
+    std::shared_ptr<Source> source = find(pID);
+    if (!source) return SourceProgress{ 0, 0, 0, false };
+
+    //Copy the progress
+    std::lock_guard<std::mutex> guard(source->lock);
+    return source->progress;
+}
+
+/*
+    TaskSource : wait - Block until a source has finished and forget it
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Must not be called from a job or a finish hook, as the source can't finish
+
+    param[in] pID - The ID of the source
+
+    return SourceProgress - Returns the final progress (all 0 if the source doesn't exist)
+*/
+AsynchTasks::SourceProgress AsynchTasks::TaskSource::wait(sourceID pID) {
+    //Find the source
+    std::shared_ptr<Source> source = find(pID);
+    if (!source) return SourceProgress{ 0, 0, 0, false };
+
+    //Wait for the jobs to finish
+    std::unique_lock<std::mutex> lock(source->lock);
+    source->done.wait(lock, [&]() { return source->progress.finished; });
+    SourceProgress progress = source->progress;
+    lock.unlock();
+
+    //Forget the source
+    mInstanceLock.lock();
+    if (mInstance) mInstance->mSources.erase(pID);
+    mInstanceLock.unlock();
+    return progress;
+}
+#pragma endregion
+#endif
@@ -0,0 +1,660 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+#include "AsyncSerialisable.h"
+
+#include <deque>
+#include <map>
+#include <functional>
+#include <condition_variable>
+
+#include <stdio.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a queue for serialisable
+ *      Tasks that spills to disk once the Tasks waiting in memory exceed
+ *      a budget.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the function used to set up a Task once it is loaded from the spill queue
+    typedef std::function<void(Task<IOBuffer>& pTask, taskKind pKind)> spillSetup;
+    #pragma endregion
+
+    #pragma region Spill Queue Decleration
+    /*
+     *      Name: SpillQueue
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Queue very large numbers of serialisable Tasks without holding
+     *      them all in memory. Tasks are handed to the TaskManager while the
+     *      memory used by the unfinished Tasks is within the budget, beyond
+     *      that they are appended to segment files on disk (one sequence of
+     *      segments per priority).
+     *
+     *      As the Workers finish Tasks, a pager thread loads the spilled
+     *      Tasks back in, highest priority first and in submission order
+     *      within a priority, so they are dispatched in the same order as if
+     *      they had been added to the TaskManager directly. Segments are
+     *      deleted once they have been read.
+     *
+     *      Tasks are only created when they are loaded, the setup function
+     *      given on creation is called to attach the callback.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      SpillQueue. The directory must exist. Spilled Tasks are discarded
+     *      when the queue is destroyed, use the TaskJournal for durability.
+    **/
+    class SpillQueue {
+        //! Prototype the internal segment and lane objects
+        struct Segment;
+        struct Lane;
+        struct Entry;
+
+        /*----------Singleton Values----------*/
+        static SpillQueue* mInstance;
+
+        //! Create a lock to prevent the finish hooks using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        SpillQueue(const std::string& pDirectory, size_t pMemoryBudget, const spillSetup& pSetup, size_t pSegmentSize);
+        ~SpillQueue() = default;
+
+        SpillQueue() = delete;
+        SpillQueue(const SpillQueue&) = delete;
+        SpillQueue& operator=(const SpillQueue&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as a constant the directory the segments are stored in
+        const std::string mDirectory;
+
+        //! Keep as constants the limits of the memory and segment sizes
+        const size_t mMemoryBudget;
+        const size_t mSegmentSize;
+
+        //! Store the function used to set up loaded Tasks
+        const spillSetup mSetup;
+
+        //! Store the spilled Tasks for each priority, highest priority first
+        std::map<unsigned int, Lane, std::greater<unsigned int>> mLanes;
+
+        //! Track the memory used by the unfinished Tasks in the TaskManager
+        size_t mInMemory;
+
+        //! Count the Tasks that are in memory and on disk
+        size_t mMemoryCount;
+        size_t mSpilledCount;
+
+        //! Count the Tasks that have been read from disk but not yet added
+        size_t mLoading;
+
+        //! Count the Tasks that were lost as their segment couldn't be read
+        size_t mLostCount;
+
+        //! Store the number used to name the next segment
+        unsigned long long mNextSegment;
+
+        //! Create a lock to prevent thread clashes over the lanes
+        std::mutex mLaneLock;
+
+        //! Signal the pager thread when memory is available
+        std::condition_variable mPagerCondition;
+
+        //! Flag if the queue is operating
+        bool mRunning;
+
+        //! Maintain the thread that loads spilled Tasks
+        std::thread mPagerThread;
+
+        /*----------Functions----------*/
+        //! Function run on the pager thread to load spilled Tasks
+        void runPager();
+
+        //! Write a Task to the end of its lane
+        bool spill(taskKind pKind, const IOBuffer& pPayload, ETaskPriority pPriority);
+
+        //! Read the Tasks at the front of the lanes
+        void load(std::vector<Entry>& pEntries);
+
+        //! Discard the unread Tasks of the front segment of a lane
+        void discard(Lane& pLane, const char* pReason);
+
+        //! Create a Task and add it to the TaskManager
+        bool dispatch(Entry& pEntry);
+
+        //! Retrieve the memory accounted to a Task
+        static size_t memoryOf(size_t pPayloadSize);
+
+    public:
+        //! Main operation functionality
+        static bool create(const std::string& pDirectory, size_t pMemoryBudget = 64u * 1024u * 1024u, const spillSetup& pSetup = nullptr, size_t pSegmentSize = 64u * 1024u * 1024u);
+        static void destroy();
+
+        //! Submission options
+        static bool submit(taskKind pKind, const IOBuffer& pPayload, ETaskPriority pPriority = ETaskPriority::Medium_Priority);
+
+        //! Retrieve the number of Tasks that haven't finished
+        static size_t pending();
+
+        //! Retrieve the number of Tasks that are spilled to disk
+        static size_t spilled();
+
+        //! Retrieve the number of spilled Tasks that were lost as they couldn't be read back
+        static size_t lost();
+    };
+    #pragma endregion
+
+    #pragma region Spill Queue Definitions
+    /*
+     *      Name: Segment
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single segment file. Each record in the file
+     *      is the kind and size of a Task followed by its payload
+    **/
+    struct SpillQueue::Segment {
+        //! Store the path of the segment
+        std::string path;
+
+        //! Store the files used to write to and read from the segment
+        FILE* writer;
+        FILE* reader;
+
+        //! Store the number of bytes written to the segment
+        size_t size;
+
+        //! Store the number of records written and read
+        size_t written;
+        size_t read;
+    };
+
+    /*
+     *      Name: Lane
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the segments of a single priority, oldest first
+    **/
+    struct SpillQueue::Lane {
+        //! Store the segments of the lane
+        std::deque<Segment> segments;
+    };
+
+    /*
+     *      Name: Entry
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a Task that has been read back from a segment
+    **/
+    struct SpillQueue::Entry {
+        //! Store the kind and payload of the Task
+        taskKind kind;
+        IOBuffer payload;
+
+        //! Store the priority of the Task
+        ETaskPriority priority;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::SpillQueue* AsynchTasks::SpillQueue::mInstance = nullptr;
+std::mutex AsynchTasks::SpillQueue::mInstanceLock;
+
+#pragma region Spill Queue Function Definitions
+/*
+    SpillQueue : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pDirectory - The directory to store the segments in
+    param[in] pMemoryBudget - The number of bytes the unfinished Tasks can use in memory
+    param[in] pSetup - The function used to set up loaded Tasks
+    param[in] pSegmentSize - The number of bytes to write to a segment before starting another
+*/
+AsynchTasks::SpillQueue::SpillQueue(const std::string& pDirectory, size_t pMemoryBudget, const spillSetup& pSetup, size_t pSegmentSize) :
+    mDirectory(pDirectory),
+    mMemoryBudget(pMemoryBudget),
+    mSegmentSize(pSegmentSize),
+    mSetup(pSetup),
+    mInMemory(0),
+    mMemoryCount(0),
+    mSpilledCount(0),
+    mLoading(0),
+    mLostCount(0),
+    mNextSegment(0),
+    mRunning(false)
+{}
+
+/*
+    SpillQueue : memoryOf - Retrieve the memory accounted to a Task in the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPayloadSize - The number of bytes in the payload of the Task
+
+    return size_t - Returns the payload size plus an estimate of the Task objects
+*/
+size_t AsynchTasks::SpillQueue::memoryOf(size_t pPayloadSize) {
+    return pPayloadSize + sizeof(Asynch_Task_Job<IOBuffer>) + sizeof(IOBuffer) + 128u;
+}
+
+/*
+    SpillQueue : runPager - Load spilled Tasks into the TaskManager as memory becomes available
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::SpillQueue::runPager() {
+    //Store the Tasks read from the segments
+    std::vector<Entry> entries;
+
+    //Loop so long as the queue is running
+    std::unique_lock<std::mutex> lanes(mLaneLock);
+    while (mRunning) {
+        //Wait for spilled Tasks and the memory to load them
+        if (!mSpilledCount || mInMemory >= mMemoryBudget) {
+            mPagerCondition.wait(lanes);
+            continue;
+        }
+
+        //Read the next Tasks
+        load(entries);
+
+        //Add the Tasks without the lock, the setup function may submit more Tasks
+        lanes.unlock();
+        for (auto& entry : entries) dispatch(entry);
+        lanes.lock();
+        mLoading -= entries.size();
+        entries.clear();
+    }
+}
+
+/*
+    SpillQueue : spill - Write a Task to the end of the lane for its priority
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The lane lock must be held
+
+    param[in] pKind - The kind of the Task
+    param[in] pPayload - The payload of the Task
+    param[in] pPriority - The priority of the Task
+
+    return bool - Returns true if the Task was written
+*/
+bool AsynchTasks::SpillQueue::spill(taskKind pKind, const IOBuffer& pPayload, ETaskPriority pPriority) {
+    //Start a new segment when the last is full
+    Lane& lane = mLanes[pPriority];
+    if (lane.segments.empty() || lane.segments.back().size >= mSegmentSize) {
+        Segment segment = {};
+        segment.path = mDirectory + "/spill-" + std::to_string((unsigned int)pPriority) + "-" + std::to_string(mNextSegment++) + ".seg";
+        segment.writer = fopen(segment.path.c_str(), "wb");
+        if (!segment.writer) return false;
+        lane.segments.push_back(segment);
+    }
+
+    //Write the record
+    Segment& segment = lane.segments.back();
+    unsigned int header[2] = { pKind, (unsigned int)pPayload.size() };
+    if (fwrite(header, sizeof(header), 1, segment.writer) != 1 ||
+        (pPayload.size() && fwrite(pPayload.data(), pPayload.size(), 1, segment.writer) != 1)) return false;
+
+    //Track the record
+    segment.size += sizeof(header) + pPayload.size();
+    ++segment.written;
+    ++mSpilledCount;
+    return true;
+}
+
+/*
+    SpillQueue : load - Read the Tasks at the front of the highest priority lanes until the
+                        memory budget is reached
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The lane lock must be held
+
+    param[out] pEntries - A list to fill with the Tasks that were read
+*/
+void AsynchTasks::SpillQueue::load(std::vector<Entry>& pEntries) {
+    //Take Tasks from the highest priority lane with Tasks left
+    auto lane = mLanes.begin();
+    while (lane != mLanes.end() && mInMemory < mMemoryBudget) {
+        //Remove empty lanes
+        if (lane->second.segments.empty()) {
+            lane = mLanes.erase(lane);
+            continue;
+        }
+
+        //Segments are removed once read, so the front segment has Tasks to read
+        Segment& segment = lane->second.segments.front();
+
+        //Open the segment for reading, writes are flushed so the reader sees them
+        fflush(segment.writer);
+        if (!segment.reader && !(segment.reader = fopen(segment.path.c_str(), "rb"))) {
+            discard(lane->second, "open");
+            continue;
+        }
+
+        //Read the record
+        Entry entry;
+        unsigned int header[2];
+        if (fread(header, sizeof(header), 1, segment.reader) != 1) {
+            discard(lane->second, "read");
+            continue;
+        }
+        entry.kind = header[0];
+        entry.priority = (ETaskPriority)lane->first;
+        entry.payload.resize(header[1]);
+        if (header[1] && fread(entry.payload.data(), header[1], 1, segment.reader) != 1) {
+            discard(lane->second, "read");
+            continue;
+        }
+
+        //Account for the Task before it is added
+        ++segment.read;
+        --mSpilledCount;
+        ++mMemoryCount;
+        ++mLoading;
+        mInMemory += memoryOf(entry.payload.size());
+        pEntries.push_back(std::move(entry));
+
+        //Remove the segment once it has been read, the next spill starts a new segment
+        if (segment.read == segment.written) {
+            fclose(segment.writer);
+            fclose(segment.reader);
+            remove(segment.path.c_str());
+            lane->second.segments.pop_front();
+        }
+    }
+}
+
+/*
+    SpillQueue : discard - Discard the unread Tasks of the front segment of a lane after it
+                           failed to be read
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The error is reported once for the segment and the Tasks are counted as lost, so the
+    pager moves on to the next segment rather than retrying the failed one
+
+    Requires:
+    The lane lock must be held
+
+    param[in/out] pLane - The lane to discard the front segment of
+    param[in] pReason - The operation that failed ("open" or "read")
+*/
+void AsynchTasks::SpillQueue::discard(Lane& pLane, const char* pReason) {
+    //Report the lost Tasks
+    Segment& segment = pLane.segments.front();
+    const size_t lost = segment.written - segment.read;
+    printf("Unable to %s the spill segment '%s', %u Tasks were lost\n", pReason, segment.path.c_str(), (unsigned int)lost);
+
+    //Remove the Tasks from the counts
+    mSpilledCount -= lost;
+    mLostCount += lost;
+
+    //Close and remove the segment, the next spill starts a new segment
+    if (segment.writer) fclose(segment.writer);
+    if (segment.reader) fclose(segment.reader);
+    remove(segment.path.c_str());
+    pLane.segments.pop_front();
+}
+
+/*
+    SpillQueue : dispatch - Create a Task for an entry and add it to the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The memory of the entry must already be accounted for. The lane lock must not be held
+
+    param[in/out] pEntry - The entry to dispatch. The payload is moved into the Task
+
+    return bool - Returns true if the Task was added to the TaskManager
+*/
+bool AsynchTasks::SpillQueue::dispatch(Entry& pEntry) {
+    //Create the Task
+    Task<IOBuffer> task = TaskManager::createTask<IOBuffer>();
+    task->priority = pEntry.priority;
+    if (mSetup) mSetup(task, pEntry.kind);
+
+    //Release the memory of the Task once it has finished
+    const size_t memory = memoryOf(pEntry.payload.size());
+    std::function<void()> release = [memory]() {
+        std::lock_guard<std::mutex> guard(mInstanceLock);
+        if (!mInstance) return;
+        mInstance->mLaneLock.lock();
+        mInstance->mInMemory -= memory;
+        --mInstance->mMemoryCount;
+        mInstance->mLaneLock.unlock();
+        mInstance->mPagerCondition.notify_one();
+    };
+    TaskManager::setFinishHook(*task, release);
+
+    //Add the Task, releasing the memory if it couldn't be added
+    if (!TaskRegistry::addTask(task, pEntry.kind, std::move(pEntry.payload))) {
+        TaskManager::setFinishHook(*task, nullptr);
+        release();
+        return false;
+    }
+    return true;
+}
+
+/*
+    SpillQueue : create - Initialise the queue and start the pager thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pDirectory - The existing directory to store the segments in
+    param[in] pMemoryBudget - The number of bytes the unfinished Tasks can use in memory
+                              before Tasks are spilled to disk (Default 64MB)
+    param[in] pSetup - An optional function called for each Task before it is added to the
+                       TaskManager, used to set the callback (Default nullptr)
+    param[in] pSegmentSize - The number of bytes to write to a segment before starting
+                             another (Default 64MB)
+
+    return bool - Returns true if the SpillQueue was created successfully
+*/
+bool AsynchTasks::SpillQueue::create(const std::string& pDirectory, size_t pMemoryBudget, const spillSetup& pSetup, size_t pSegmentSize) {
+    //Assert that the queue doesn't already exist
+    assert(!mInstance);
+
+    //Create the new queue
+    SpillQueue* instance = new SpillQueue(pDirectory, pMemoryBudget, pSetup, (pSegmentSize ? pSegmentSize : 1u));
+
+    //Test to ensure the instance were created
+    if (!instance) {
+        printf("Unable to create the SpillQueue singleton instance.");
+        return false;
+    }
+
+    //Start the pager thread
+    instance->mRunning = true;
+    instance->mPagerThread = std::thread([instance]() {
+        //Call the pager function
+        instance->runPager();
+    });
+
+    //Publish the instance
+    mInstanceLock.lock();
+    mInstance = instance;
+    mInstanceLock.unlock();
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    SpillQueue : destroy - Stop loading Tasks and delete the spilled Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Tasks already in the TaskManager are still processed
+*/
+void AsynchTasks::SpillQueue::destroy() {
+    //Take the singleton instance so the finish hooks of running Tasks no longer use it
+    mInstanceLock.lock();
+    SpillQueue* instance = mInstance;
+    mInstance = nullptr;
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Stop the pager thread
+        instance->mLaneLock.lock();
+        instance->mRunning = false;
+        instance->mLaneLock.unlock();
+        instance->mPagerCondition.notify_all();
+        if (instance->mPagerThread.get_id() != std::thread::id())
+            instance->mPagerThread.join();
+
+        //Delete the segments
+        for (auto& lane : instance->mLanes) {
+            for (auto& segment : lane.second.segments) {
+                fclose(segment.writer);
+                if (segment.reader) fclose(segment.reader);
+                remove(segment.path.c_str());
+            }
+        }
+
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    SpillQueue : submit - Add a serialisable Task to the queue
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The Task is added to the TaskManager straight away when nothing is spilled and the memory
+    budget allows it, otherwise it is spilled to disk
+
+    param[in] pKind - The kind of the Task
+    param[in] pPayload - The payload to process
+    param[in] pPriority - The priority of the Task (Default Medium_Priority)
+
+    return bool - Returns a flag determining if the Task was queued successfully
+*/
+bool AsynchTasks::SpillQueue::submit(taskKind pKind, const IOBuffer& pPayload, ETaskPriority pPriority) {
+    //Ensure the queue exists and the kind can be processed
+    if (!mInstance || !TaskRegistry::isRegistered(pKind)) return false;
+
+    //Lock the lanes
+    std::unique_lock<std::mutex> lanes(mInstance->mLaneLock);
+
+    //Spill the Task if there are spilled Tasks ahead of it or the memory is used
+    const size_t memory = memoryOf(pPayload.size());
+    if (mInstance->mSpilledCount || mInstance->mLoading || mInstance->mInMemory + memory > mInstance->mMemoryBudget) {
+        bool spilled = mInstance->spill(pKind, pPayload, pPriority);
+        lanes.unlock();
+        mInstance->mPagerCondition.notify_one();
+        return spilled;
+    }
+
+    //Account for the Task
+    mInstance->mInMemory += memory;
+    ++mInstance->mMemoryCount;
+    lanes.unlock();
+
+    //Add the Task to the TaskManager
+    Entry entry = { pKind, pPayload, pPriority };
+    return mInstance->dispatch(entry);
+}
+
+/*
+    SpillQueue : pending - Retrieve the number of Tasks that haven't finished
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of Tasks in memory and on disk
+*/
+size_t AsynchTasks::SpillQueue::pending() {
+    //Check the queue exists
+    if (!mInstance) return 0;
+
+    //Count the Tasks
+    std::lock_guard<std::mutex> guard(mInstance->mLaneLock);
+    return mInstance->mMemoryCount + mInstance->mSpilledCount;
+}
+
+/*
+    SpillQueue : spilled - Retrieve the number of Tasks that are waiting on disk
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of spilled Tasks
+*/
+size_t AsynchTasks::SpillQueue::spilled() {
+    //Check the queue exists
+    if (!mInstance) return 0;
+
+    //Count the Tasks
+    std::lock_guard<std::mutex> guard(mInstance->mLaneLock);
+    return mInstance->mSpilledCount;
+}
+
+/*
+    SpillQueue : lost - Retrieve the number of spilled Tasks that couldn't be read back
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of Tasks lost with their segments
+*/
+size_t AsynchTasks::SpillQueue::lost() {
+    //Check the queue exists
+    if (!mInstance) return 0;
+
+    //Count the Tasks
+    std::lock_guard<std::mutex> guard(mInstance->mLaneLock);
+    return mInstance->mLostCount;
+}
+#pragma endregion
+#endif
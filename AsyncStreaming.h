@@ -0,0 +1,755 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+
+#include <set>
+#include <map>
+#include <unordered_map>
+#include <chrono>
+#include <condition_variable>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a service for streaming
+ *      large numbers of assets from disk in priority order.
+**/
+namespace AsynchTasks {
+    #pragma region Type Defines
+    //! Define the function used to decode a single chunk of an asset
+    typedef std::function<void(const char* pData, size_t pSize, unsigned long long pOffset)> chunkDecoder;
+
+    /*
+     *      Name: StreamingStats
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Report the throughput of the StreamingService and the time
+     *      requests spent queued before their first read, by priority
+    **/
+    struct StreamingStats {
+        //! Store the queue latency of the requests with a single priority
+        struct Latency {
+            unsigned long long count;
+            double averageMs;
+            double maxMs;
+        };
+
+        //! Store the total number of bytes read
+        unsigned long long bytesRead;
+
+        //! Store the average throughput since the service was created
+        double bytesPerSecond;
+
+        //! Store the number of requests waiting and the number of chunks being processed
+        unsigned int pending;
+        unsigned int inFlight;
+
+        //! Store the number of requests that completed, failed or were cancelled
+        unsigned long long completed;
+        unsigned long long failed;
+        unsigned long long cancelled;
+
+        //! Store the queue latency of the requests by priority
+        std::map<unsigned int, Latency> latency;
+    };
+    #pragma endregion
+
+    #pragma region Streaming Service Decleration
+    /*
+     *      Name: StreamingService
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Stream files from disk in chunks, highest priority first. Each
+     *      chunk is read through the IOManager and decoded on a Worker with
+     *      the priority of its request. A streaming thread chooses the next
+     *      chunk to read, limiting the number of chunks in flight and the
+     *      number of bytes read per second.
+     *
+     *      Requests are identified by the ID of the Task<void> given when
+     *      streaming. They can be re-prioritised or cancelled at any point
+     *      before they complete, taking effect at the next chunk. The chunks
+     *      of a single request are read and decoded in order, one at a time.
+     *
+     *      Once all chunks are decoded the Task is added to the TaskManager
+     *      for its callback. If a read or decode fails, or the request is
+     *      cancelled, the Task finishes with an error.
+     *
+     *      Requires:
+     *      The TaskManager and IOManager must be created before and destroyed
+     *      after the StreamingService.
+    **/
+    class StreamingService {
+        //! Prototype the internal stream object
+        struct Stream;
+
+        //! Define the ordering of the waiting streams
+        struct StreamOrder {
+            bool operator()(const std::shared_ptr<Stream>& pFirst, const std::shared_ptr<Stream>& pSecond) const;
+        };
+
+        /*----------Singleton Values----------*/
+        static StreamingService* mInstance;
+        StreamingService(unsigned long long pBytesPerSecond, size_t pChunkSize, unsigned int pMaxInFlight);
+        ~StreamingService() = default;
+
+        StreamingService() = delete;
+        StreamingService(const StreamingService&) = delete;
+        StreamingService& operator=(const StreamingService&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as constants the size of the chunks and the number that can be in flight
+        const size_t mChunkSize;
+        const unsigned int mMaxInFlight;
+
+        //! Store the bandwidth limit and the current number of bytes that can be read
+        unsigned long long mBytesPerSecond;
+        double mTokens;
+        std::chrono::steady_clock::time_point mLastRefill;
+
+        //! Flag if the service is operating
+        bool mRunning;
+
+        //! Maintain the thread that issues the chunk reads
+        std::thread mStreamingThread;
+
+        //! Create a lock and signal to prevent thread clashes over the streams
+        std::mutex mStreamLock;
+        std::condition_variable mStreamSignal;
+
+        //! Store the streams waiting for their next chunk in priority order
+        std::set<std::shared_ptr<Stream>, StreamOrder> mPending;
+
+        //! Store all unfinished streams by the ID of their Task
+        std::unordered_map<taskID, std::shared_ptr<Stream>> mStreams;
+
+        //! Track the order that streams are added to the pending set
+        unsigned long long mNextSequence;
+
+        //! Track the number of chunks that are being read or decoded
+        unsigned int mInFlight;
+
+        //! Store the values used to create the stats
+        std::chrono::steady_clock::time_point mCreated;
+        StreamingStats mStats;
+
+        /*----------Functions----------*/
+        //! Issue chunk reads on the streaming thread
+        void issueChunks();
+
+        //! Manage the state of the streams
+        void queueStream(const std::shared_ptr<Stream>& pStream);
+        bool openStream(Stream& pStream);
+        void chunkFinished(const std::shared_ptr<Stream>& pStream, Asynch_Task_Base* pChunk);
+        void finishStream(const std::shared_ptr<Stream>& pStream);
+
+    public:
+        //! Main operation functionality
+        static bool create(unsigned long long pBytesPerSecond = 0ull, size_t pChunkSize = 256u * 1024u, unsigned int pMaxInFlight = 8u);
+        static void destroy();
+
+        //! Request options
+        static bool stream(Task<void>& pTask, const std::string& pPath, const chunkDecoder& pDecoder);
+        static bool reprioritise(taskID pID, ETaskPriority pPriority);
+        static bool cancel(taskID pID);
+
+        //! Retrieve the current stats of the service
+        static StreamingStats stats();
+
+        /*----------Setters----------*/
+        static void setBandwidth(unsigned long long pBytesPerSecond);
+    };
+    #pragma endregion
+
+    #pragma region Stream Definition
+    /*
+     *      Name: Stream
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single streaming request
+    **/
+    struct StreamingService::Stream {
+        //! Store the Task to add once the stream has finished
+        Task<void> task;
+
+        //! Store the file to read
+        std::string path;
+        int file;
+
+        //! Store the size of the file, the position of the next chunk and the chunk in flight
+        unsigned long long size;
+        unsigned long long offset;
+        unsigned long long chunkOffset;
+
+        //! Store the function used to decode each chunk
+        chunkDecoder decoder;
+
+        //! Store the current priority of the stream and its order within that priority
+        ETaskPriority priority;
+        unsigned long long sequence;
+
+        //! Store the time the stream was requested
+        std::chrono::steady_clock::time_point requested;
+
+        //! Flag the state of the stream
+        bool started;
+        bool busy;
+        bool cancelled;
+
+        //! Store the error that caused the stream to fail
+        std::string error;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::StreamingService* AsynchTasks::StreamingService::mInstance = nullptr;
+
+#pragma region Streaming Service Function Definitions
+/*
+    StreamingService : StreamOrder - Order the waiting streams by priority and then by sequence
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFirst - The first stream to compare
+    param[in] pSecond - The second stream to compare
+
+    return bool - Returns true if the first stream should be read before the second
+*/
+bool AsynchTasks::StreamingService::StreamOrder::operator()(const std::shared_ptr<Stream>& pFirst, const std::shared_ptr<Stream>& pSecond) const {
+    if (pFirst->priority != pSecond->priority) return pFirst->priority > pSecond->priority;
+    return pFirst->sequence < pSecond->sequence;
+}
+
+/*
+    StreamingService : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBytesPerSecond - The maximum number of bytes to read per second (0 for no limit)
+    param[in] pChunkSize - The number of bytes to read and decode at a time
+    param[in] pMaxInFlight - The maximum number of chunks that can be read or decoded at once
+*/
+AsynchTasks::StreamingService::StreamingService(unsigned long long pBytesPerSecond, size_t pChunkSize, unsigned int pMaxInFlight) :
+    mChunkSize(pChunkSize),
+    mMaxInFlight(pMaxInFlight),
+    mBytesPerSecond(pBytesPerSecond),
+    mTokens(0.0),
+    mRunning(false),
+    mNextSequence(0),
+    mInFlight(0)
+{
+    //Clear the stats
+    mStats.bytesRead = mStats.completed = mStats.failed = mStats.cancelled = 0;
+    mStats.bytesPerSecond = 0.0;
+    mStats.pending = mStats.inFlight = 0;
+}
+
+/*
+    StreamingService : issueChunks - Read the next chunk of the highest priority streams while
+                                     within the in flight and bandwidth limits
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::StreamingService::issueChunks() {
+    //Lock the streams
+    std::unique_lock<std::mutex> guard(mStreamLock);
+
+    //Loop so long as the service is running
+    while (mRunning) {
+        //Wait for a stream and room for another chunk
+        if (mPending.empty() || mInFlight >= mMaxInFlight) {
+            mStreamSignal.wait(guard);
+            continue;
+        }
+
+        //Check the bandwidth limit
+        if (mBytesPerSecond) {
+            //Add the bytes that have become available since the last refill (limited to a second's worth)
+            auto now = std::chrono::steady_clock::now();
+            mTokens = std::min((double)mBytesPerSecond, mTokens + std::chrono::duration<double>(now - mLastRefill).count() * mBytesPerSecond);
+            mLastRefill = now;
+
+            //Wait until the limit has refilled
+            if (mTokens < 0.0) {
+                mStreamSignal.wait_until(guard, now + std::chrono::microseconds((long long)(-mTokens * 1000000.0 / mBytesPerSecond) + 1));
+                continue;
+            }
+        }
+
+        //Get the highest priority stream
+        std::shared_ptr<Stream> stream = *mPending.begin();
+        mPending.erase(mPending.begin());
+
+        //Open the file for the first chunk
+        if (!stream->started) {
+            //Record the time spent waiting in the queue
+            double latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stream->requested).count();
+            StreamingStats::Latency& stats = mStats.latency[stream->priority];
+            stats.averageMs = (stats.averageMs * stats.count + latency) / (stats.count + 1);
+            stats.maxMs = std::max(stats.maxMs, latency);
+            stats.count++;
+
+            //Open the file
+            stream->started = true;
+            guard.unlock();
+            bool opened = openStream(*stream);
+            guard.lock();
+
+            //Check if the stream has already finished
+            if (!opened || !stream->size) {
+                mStreams.erase(stream->task->id);
+                guard.unlock();
+                finishStream(stream);
+                guard.lock();
+                continue;
+            }
+        }
+
+        //Determine the size of the chunk to read
+        size_t size = (size_t)std::min((unsigned long long)mChunkSize, stream->size - stream->offset);
+
+        //Take the chunk from the bandwidth limit
+        if (mBytesPerSecond) mTokens -= (double)size;
+
+        //Flag the stream as busy
+        stream->busy = true;
+        stream->chunkOffset = stream->offset;
+        mInFlight++;
+
+        //Create the Task to read and decode the chunk
+        Task<IOBuffer> chunk = TaskManager::createTask<IOBuffer>();
+        chunk->priority = stream->priority;
+        unsigned long long offset = stream->offset;
+        chunk->callback = [stream, offset](IOBuffer& pData) {
+            stream->decoder(pData.data(), pData.size(), offset);
+            stream->offset = offset + pData.size();
+            if (!pData.size()) stream->size = offset;
+        };
+
+        //Update the stream once the chunk has finished
+        Asynch_Task_Base* chunkTask = chunk.get();
+        TaskManager::setFinishHook(*chunk, [stream, chunkTask]() {
+            if (mInstance) mInstance->chunkFinished(stream, chunkTask);
+        });
+
+        //Read the chunk
+        guard.unlock();
+        IOManager::read(chunk, stream->file, offset, size);
+        guard.lock();
+    }
+}
+
+/*
+    StreamingService : queueStream - Add a stream to the pending set to wait for its next chunk
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The stream lock must be held when queueing streams
+
+    param[in] pStream - The stream to add
+*/
+void AsynchTasks::StreamingService::queueStream(const std::shared_ptr<Stream>& pStream) {
+    //Place the stream after those of the same priority
+    pStream->sequence = mNextSequence++;
+    mPending.insert(pStream);
+
+    //Wake the streaming thread
+    mStreamSignal.notify_one();
+}
+
+/*
+    StreamingService : openStream - Open the file of a stream and find its size
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pStream - The stream to open
+
+    return bool - Returns true if the file was opened
+*/
+bool AsynchTasks::StreamingService::openStream(Stream& pStream) {
+    #ifdef _WIN32
+    //Open the file
+    pStream.file = _open(pStream.path.c_str(), _O_RDONLY | _O_BINARY);
+
+    //Get the size of the file
+    struct _stat64 info;
+    if (pStream.file >= 0 && _fstat64(pStream.file, &info) == 0) {
+        pStream.size = (unsigned long long)info.st_size;
+        return true;
+    }
+    #else
+    //Open the file
+    pStream.file = open(pStream.path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    //Get the size of the file
+    struct stat info;
+    if (pStream.file >= 0 && fstat(pStream.file, &info) == 0) {
+        pStream.size = (unsigned long long)info.st_size;
+        return true;
+    }
+    #endif
+
+    //Store the error
+    pStream.error = "Failed to open the file '" + pStream.path + "' for streaming: " + strerror(errno);
+    return false;
+}
+
+/*
+    StreamingService : chunkFinished - Update a stream once a chunk has been read and decoded
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pStream - The stream the chunk belongs to
+    param[in] pChunk - The Task that read and decoded the chunk
+*/
+void AsynchTasks::StreamingService::chunkFinished(const std::shared_ptr<Stream>& pStream, Asynch_Task_Base* pChunk) {
+    //Lock the streams
+    std::unique_lock<std::mutex> guard(mStreamLock);
+
+    //Free the space used by the chunk
+    pStream->busy = false;
+    mInFlight--;
+    mStreamSignal.notify_one();
+
+    //Check if the chunk failed
+    if (pChunk->status == ETaskStatus::Error)
+        pStream->error = pChunk->error.value();
+
+    //Track the data read
+    else mStats.bytesRead += pStream->offset - pStream->chunkOffset;
+
+    //Continue with the next chunk
+    if (pStream->error.empty() && !pStream->cancelled && pStream->offset < pStream->size) {
+        queueStream(pStream);
+        return;
+    }
+
+    //Remove the finished stream
+    mStreams.erase(pStream->task->id);
+    guard.unlock();
+    finishStream(pStream);
+}
+
+/*
+    StreamingService : finishStream - Close the file of a stream and add its Task to the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pStream - The stream that has finished
+*/
+void AsynchTasks::StreamingService::finishStream(const std::shared_ptr<Stream>& pStream) {
+    //Close the file
+    if (pStream->file >= 0) {
+        #ifdef _WIN32
+        _close(pStream->file);
+        #else
+        close(pStream->file);
+        #endif
+        pStream->file = -1;
+    }
+
+    //Get the message to report
+    std::string error = (pStream->cancelled ? "The streaming request for '" + pStream->path + "' was cancelled" : pStream->error);
+
+    //Track the result
+    mStreamLock.lock();
+    if (pStream->cancelled) mStats.cancelled++;
+    else if (error.size()) mStats.failed++;
+    else mStats.completed++;
+    mStreamLock.unlock();
+
+    //Set the process to report the result of the stream
+    TaskManager::setProcess<void>(*pStream->task, [error]() {
+        if (error.size()) throw std::runtime_error(error);
+    });
+
+    //Hand the Task to the Workers for the callback stage
+    TaskManager::queueTask(pStream->task);
+}
+
+/*
+    StreamingService : create - Initialise and setup the streaming service
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBytesPerSecond - The maximum number of bytes to read per second (Default 0, no limit)
+    param[in] pChunkSize - The number of bytes to read and decode at a time (Default 256KB)
+    param[in] pMaxInFlight - The maximum number of chunks that can be read or decoded at
+                             once (Default 8)
+
+    return bool - Returns true if the StreamingService was created successfully
+*/
+bool AsynchTasks::StreamingService::create(unsigned long long pBytesPerSecond, size_t pChunkSize, unsigned int pMaxInFlight) {
+    //Assert that the service doesn't already exist
+    assert(!mInstance);
+
+    //Assert that chunks can be read
+    assert(pChunkSize && pMaxInFlight);
+
+    //Create the new service
+    mInstance = new StreamingService(pBytesPerSecond, pChunkSize, pMaxInFlight);
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the StreamingService singleton instance.");
+        return false;
+    }
+
+    //Set the starting times
+    mInstance->mCreated = mInstance->mLastRefill = std::chrono::steady_clock::now();
+
+    //Set the operating flag
+    mInstance->mRunning = true;
+
+    //Start the streaming thread
+    mInstance->mStreamingThread = std::thread([&]() {
+        //Call the issuing function
+        mInstance->issueChunks();
+    });
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    StreamingService : destroy - Cancel the unfinished requests, close the streaming thread and
+                                 delete the StreamingService
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Chunks that are in flight are allowed to finish before the service is deleted
+*/
+void AsynchTasks::StreamingService::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        //Kill the streaming thread
+        mInstance->mStreamLock.lock();
+        mInstance->mRunning = false;
+        mInstance->mStreamLock.unlock();
+        mInstance->mStreamSignal.notify_all();
+
+        //Join the streaming thread
+        if (mInstance->mStreamingThread.get_id() != std::thread::id())
+            mInstance->mStreamingThread.join();
+
+        //Cancel the waiting streams
+        std::vector<std::shared_ptr<Stream>> cancelled;
+        mInstance->mStreamLock.lock();
+        for (auto& pair : mInstance->mStreams) pair.second->cancelled = true;
+        cancelled.assign(mInstance->mPending.begin(), mInstance->mPending.end());
+        for (size_t i = 0; i < cancelled.size(); i++) mInstance->mStreams.erase(cancelled[i]->task->id);
+        mInstance->mPending.clear();
+        mInstance->mStreamLock.unlock();
+        for (size_t i = 0; i < cancelled.size(); i++) mInstance->finishStream(cancelled[i]);
+
+        //Wait for the chunks in flight to finish
+        std::unique_lock<std::mutex> guard(mInstance->mStreamLock);
+        while (mInstance->mStreams.size()) {
+            guard.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            guard.lock();
+        }
+        guard.unlock();
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    StreamingService : stream - Request a file to be streamed and decoded in chunks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - A Task<void> object to be added to the TaskManager once the file has
+                          been decoded. The priority of the Task is used for the request. Once
+                          added the property values will be uneditable
+    param[in] pPath - The path of the file to stream
+    param[in] pDecoder - The function used to decode each chunk, called on a Worker in order
+
+    return bool - Returns a flag determining if the request was added successfully
+*/
+bool AsynchTasks::StreamingService::stream(Task<void>& pTask, const std::string& pPath, const chunkDecoder& pDecoder) {
+    //Ensure that the service is available and the pointer is valid
+    if (!mInstance || !pTask || !pDecoder || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the stream
+    std::shared_ptr<Stream> stream = std::make_shared<Stream>();
+    stream->task = pTask;
+    stream->path = pPath;
+    stream->file = -1;
+    stream->size = stream->offset = stream->chunkOffset = 0;
+    stream->decoder = pDecoder;
+    stream->priority = pTask->priority;
+    stream->requested = std::chrono::steady_clock::now();
+    stream->started = stream->busy = stream->cancelled = false;
+
+    //Add the stream to the service
+    std::lock_guard<std::mutex> guard(mInstance->mStreamLock);
+    mInstance->mStreams[pTask->id] = stream;
+    mInstance->queueStream(stream);
+    return true;
+}
+
+/*
+    StreamingService : reprioritise - Change the priority of an unfinished request
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pID - The ID of the Task used to make the request
+    param[in] pPriority - The new priority of the request
+
+    return bool - Returns true if the request was found
+*/
+bool AsynchTasks::StreamingService::reprioritise(taskID pID, ETaskPriority pPriority) {
+    //Ensure that the service is available
+    if (!mInstance) return false;
+
+    //Lock the streams
+    std::lock_guard<std::mutex> guard(mInstance->mStreamLock);
+
+    //Find the stream
+    auto iter = mInstance->mStreams.find(pID);
+    if (iter == mInstance->mStreams.end()) return false;
+    std::shared_ptr<Stream> stream = iter->second;
+
+    //Move the stream within the pending set
+    bool waiting = (mInstance->mPending.erase(stream) != 0);
+    stream->priority = pPriority;
+    TaskManager::setPriority(*stream->task, pPriority);
+    if (waiting) mInstance->mPending.insert(stream);
+    return true;
+}
+
+/*
+    StreamingService : cancel - Cancel an unfinished request
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If a chunk of the request is being read or decoded it will finish first. The Task
+    of the request finishes with an error.
+
+    param[in] pID - The ID of the Task used to make the request
+
+    return bool - Returns true if the request was found
+*/
+bool AsynchTasks::StreamingService::cancel(taskID pID) {
+    //Ensure that the service is available
+    if (!mInstance) return false;
+
+    //Lock the streams
+    std::unique_lock<std::mutex> guard(mInstance->mStreamLock);
+
+    //Find the stream
+    auto iter = mInstance->mStreams.find(pID);
+    if (iter == mInstance->mStreams.end()) return false;
+    std::shared_ptr<Stream> stream = iter->second;
+
+    //Flag the stream as cancelled
+    stream->cancelled = true;
+
+    //Finish streams that are waiting, busy streams finish with their chunk
+    if (mInstance->mPending.erase(stream)) {
+        mInstance->mStreams.erase(iter);
+        guard.unlock();
+        mInstance->finishStream(stream);
+    }
+    return true;
+}
+
+/*
+    StreamingService : stats - Retrieve the current throughput and queue latency of the service
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return StreamingStats - Returns a copy of the current stats
+*/
+AsynchTasks::StreamingStats AsynchTasks::StreamingService::stats() {
+    //Ensure that the service is available
+    StreamingStats stats = StreamingStats();
+    if (!mInstance) return stats;
+
+    //Copy the stats
+    std::lock_guard<std::mutex> guard(mInstance->mStreamLock);
+    stats = mInstance->mStats;
+    stats.pending = (unsigned int)mInstance->mPending.size();
+    stats.inFlight = mInstance->mInFlight;
+
+    //Find the average throughput
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - mInstance->mCreated).count();
+    stats.bytesPerSecond = (elapsed > 0.0 ? stats.bytesRead / elapsed : 0.0);
+    return stats;
+}
+
+/*
+    StreamingService : setBandwidth - Set the maximum number of bytes to read per second
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBytesPerSecond - The new limit (0 for no limit)
+*/
+void AsynchTasks::StreamingService::setBandwidth(unsigned long long pBytesPerSecond) {
+    //Ensure that the service is available
+    if (!mInstance) return;
+
+    //Set the new limit
+    mInstance->mStreamLock.lock();
+    mInstance->mBytesPerSecond = pBytesPerSecond;
+    mInstance->mTokens = 0.0;
+    mInstance->mLastRefill = std::chrono::steady_clock::now();
+    mInstance->mStreamLock.unlock();
+    mInstance->mStreamSignal.notify_one();
+}
+#pragma endregion
+#endif
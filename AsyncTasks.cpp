@@ -1,2 +1,21 @@
 #define _ASYNCHRONOUS_TASKS_
-#include "AsyncTasks.h"
\ No newline at end of file
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+#include "AsyncReactor.h"
+#include "AsyncStreaming.h"
+#include "AsyncMappedFile.h"
+#include "AsyncWriteBehind.h"
+#include "AsyncSerialisable.h"
+#include "AsyncProcessPool.h"
+#include "AsyncRemote.h"
+#include "AsyncJournal.h"
+#include "AsyncSpill.h"
+#include "AsyncRateLimit.h"
+#include "AsyncIncremental.h"
+#include "AsyncIntrospection.h"
+#include "AsyncSimulation.h"
+#include "AsyncTrace.h"
+#include "AsyncPolicy.h"
+#include "AsyncClosed.h"
+#include "AsyncSource.h"
+#include "AsyncScope.h"
\ No newline at end of file
@@ -3,18 +3,36 @@
 #include <assert.h>
 
 #include <functional>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
 
 #include <algorithm>
+#include <cmath>
 
 #include <memory>
+#include <new>
 
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <chrono>
+#include <random>
+#include <exception>
+#include <typeinfo>
 
 #include <vector>
 #include <string>
 
+//Enable the memory resource support when compiling as C++17 or later
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+#define _ASYNCHRONOUS_TASKS_PMR_
+#include <memory_resource>
+#endif
+#endif
+
 /*
  *      Namespace: AsynchTasks
  *      Author: Mitchell Croft
@@ -158,15 +176,42 @@ namespace AsynchTasks {
 
     //! Forward declare the template for different Tasks that can be completed
     template<class T> class Asynch_Task_Job;
+
+    //! Forward declare the template for Tasks that store the arguments of their process
+    template<class T, class F, class... Args> class Asynch_Bound_Task_Job;
+
+    //! Forward declare the templates for Tasks that can be processed in batches of the same kind
+    template<class In, class Out> struct Asynch_Batch_Kind;
+    template<class In, class Out> class Asynch_Batch_Task_Job;
+
+    //! Forward declare the scope that structured Tasks are spawned into, and the Tasks it spawns
+    class TaskScope;
+    template<class F> class Asynch_Scoped_Task_Job;
     #pragma endregion
 
     #pragma region Type Defines
     //! Define the task ID number 
     typedef unsigned long long int taskID;
 
+    //! Define the timer ID number
+    typedef unsigned long long int timerID;
+
     //! Create an alias for the different Task items that the user can receive
     template<class T> using Task = std::shared_ptr<Asynch_Task_Job<T>>;
 
+    //! Create an alias for the kinds of Tasks that are processed in batches
+    template<class In, class Out> using BatchKind = std::shared_ptr<const Asynch_Batch_Kind<In, Out>>;
+
+    //! Define the lists of Tasks kept by the Task Manager, allocated from its memory resource when supported
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+    typedef std::pmr::vector<std::shared_ptr<Asynch_Task_Base>> taskList;
+#else
+    typedef std::vector<std::shared_ptr<Asynch_Task_Base>> taskList;
+#endif
+
+    //! Define the result of a function called with a set of bound arguments, moved in
+    template<class F, class... Args> using boundResult = decltype(std::declval<typename std::decay<F>::type&>()(std::declval<typename std::decay<Args>::type&&>()...));
+
     //! Label the different states the task can be in
     enum class ETaskStatus : char {
         //! An error occurred when trying to process the Task, check the Tasks error
@@ -196,12 +241,115 @@ namespace AsynchTasks {
     };
     #pragma endregion
 
+    #pragma region Retry Policy Decleration
+    /*
+     *      Name: RetryPolicy
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe how a Task whose process throws is retried. The Task is
+     *      queued again after an exponential backoff with random jitter, 
+     *      without leaving the Task Manager or being reallocated. The Task
+     *      remains Pending while it waits to be retried.
+    **/
+    struct RetryPolicy {
+        //! Store the maximum number of times the process is attempted (1 disables retrying)
+        unsigned int maxAttempts = 1;
+
+        //! Store the delay before the first retry and the maximum delay between retries
+        std::chrono::milliseconds baseDelay = std::chrono::milliseconds(10);
+        std::chrono::milliseconds maxDelay = std::chrono::milliseconds(1000);
+
+        //! Store the value the delay is multiplied by after each retry
+        double multiplier = 2.0;
+
+        //! Store the fraction of the delay that is randomly removed (0 - 1) to spread out retries
+        double jitter = 0.5;
+
+        //! Store an optional filter deciding if an error is retryable (nullptr retries all errors)
+        std::function<bool(const std::exception_ptr&)> retryable;
+
+        //! Calculate the delay before a retry
+        std::chrono::milliseconds delay(unsigned int pRetry) const;
+
+        //! Create a filter that only retries errors of type E
+        template<class E> static std::function<bool(const std::exception_ptr&)> only();
+    };
+
+    /*
+     *      Name: TaskMetrics
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Report the counters kept by the TaskManager
+    **/
+    struct TaskMetrics {
+        //! Store the number of Tasks added to the Task Manager for processing
+        unsigned long long tasksQueued;
+
+        //! Store the number of Tasks the Workers processed successfully and unsuccessfully
+        unsigned long long tasksCompleted;
+        unsigned long long tasksFailed;
+
+        //! Store the number of times Tasks have been queued again by their retry policy
+        unsigned long long retries;
+
+        //! Store the number of Tasks that failed after using all of their attempts
+        unsigned long long retriesExhausted;
+    };
+    #pragma endregion
+
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+    #pragma region Locked Resource Decleration
+    /*
+     *      Name: LockedResource
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Allow a memory resource that isn't thread safe (E.g. a
+     *      std::pmr::monotonic_buffer_resource arena) to be shared by Tasks,
+     *      whose results are allocated on the Worker threads, by locking a
+     *      mutex around each allocation.
+     *
+     *      Requires:
+     *      The upstream resource must outlive the LockedResource.
+    **/
+    class LockedResource : public std::pmr::memory_resource {
+        /*----------Variables----------*/
+        //! Store the resource that is allocated from
+        std::pmr::memory_resource* mUpstream;
+
+        //! Create a lock to prevent thread clashes over the upstream resource
+        std::mutex mLock;
+
+        /*----------Functions----------*/
+        //! Override the memory resource functions
+        void* do_allocate(size_t pBytes, size_t pAlignment) override;
+        void do_deallocate(void* pMemory, size_t pBytes, size_t pAlignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& pOther) const noexcept override;
+
+    public:
+        //! Wrap a resource
+        LockedResource(std::pmr::memory_resource* pUpstream);
+
+        //! Retrieve the resource that is allocated from
+        inline std::pmr::memory_resource* upstream() const { return mUpstream; }
+    };
+    #pragma endregion
+#endif
+
     #pragma region Task Manager Decleration
     /*
      *      Name: TaskManager
      *      Author: Mitchell Croft
      *      Created: 16/08/2016
-     *      Modified: 11/01/2017
+     *      Modified: 18/10/2026
      *
      *      Purpose:
      *      Complete tasks in a multi-threaded environment, while providing
@@ -217,9 +365,45 @@ namespace AsynchTasks {
         //! Prototype the Worker class as a private object
         class Worker;
 
+        //! Prototype the internal timer object
+        struct Timer;
+
+        //! Prototype the record of a fire and forget job
+        struct LightJob;
+
+        //! Set the subsystems as friends to allow for use of the internal Task pipeline
+        friend class IOManager;
+        friend class Reactor;
+        friend class StreamingService;
+        friend class MappedFileProcessor;
+        friend class WriteBehindService;
+        friend class ProcessPool;
+        friend class RemoteExecutor;
+        friend class RemoteNode;
+        friend class TaskJournal;
+        friend class SpillQueue;
+        friend class RateLimiter;
+        friend class IncrementalGraph;
+        friend class Introspection;
+        friend class SchedulerSimulator;
+        friend class TraceRecorder;
+        friend class TraceReplayer;
+        friend class TaskSource;
+        friend class TaskScope;
+
+        //! Set the batched Tasks as friends to allow them to report the Tasks grouped with them
+        template<class, class> friend class Asynch_Batch_Task_Job;
+
+        //! Define the function raised once a Task has been processed, with the times (in steady clock ticks) it started and finished
+        typedef void(*processedHook)(const Asynch_Task_Base& pTask, long long pStarted, long long pFinished, bool pFailed);
+
         /*----------Singleton Values----------*/
         static TaskManager* mInstance;
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        TaskManager(unsigned int pWorkers, std::pmr::memory_resource* pResource);
+#else
         TaskManager(unsigned int pWorkers);
+#endif
         ~TaskManager() = default;
 
         TaskManager() = delete;
@@ -246,31 +430,139 @@ namespace AsynchTasks {
         //! Create a lock to prevent thread clashes over tasks
         std::mutex mTaskLock;
 
-        //! Track the current ID to distribute to new Tasks
-        taskID mNextID;
+        //! Track the current ID to distribute to new Tasks, Tasks are created on many threads
+        std::atomic<taskID> mNextID;
 
         //! Store the maximum number of Tasks that can have their callbacks executed on update per call
         unsigned int mMaxCallbacksOnUpdate;
 
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        //! Store the memory resource used for the Task lists and the fire and forget jobs
+        std::pmr::memory_resource* mResource;
+#endif
+
         //! Keep a vector of all the Tasks to be completed
-        std::vector<std::shared_ptr<Asynch_Task_Base>> mUncompletedTasks;
+        taskList mUncompletedTasks;
 
         //! Keep a vector of all the Tasks to have their callback called on an update call
-        std::vector<std::shared_ptr<Asynch_Task_Base>> mToCallOnUpdate;
+        taskList mToCallOnUpdate;
+
+        //! Keep a vector of the finished Tasks that have a subsystem finish hook to raise
+        taskList mFinishedTasks;
+
+        //! Keep a heap of the timers started by the subsystems, soonest first
+        std::vector<Timer> mTimers;
+
+        //! Keep the functions and retried Tasks of the timers being raised, reused between passes
+        std::vector<std::function<void()>> mDueTimers;
+        taskList mDueRetries;
+
+        //! Create a lock to prevent thread clashes over the timers
+        std::mutex mTimerLock;
+
+        //! Store the time of the soonest timer (in steady clock ticks) so it can be checked without locking
+        std::atomic<long long> mNextTimer;
+
+        //! Track the current ID to distribute to new timers
+        timerID mNextTimerID;
+
+        //! Count the Tasks added to the uncompleted list for the metrics
+        std::atomic<unsigned long long> mQueued;
+
+        //! Count the retries of Tasks for the metrics
+        std::atomic<unsigned long long> mRetries;
+        std::atomic<unsigned long long> mRetriesExhausted;
+
+        //! Count the scoped Tasks processed by the threads waiting on their scope for the metrics
+        std::atomic<unsigned long long> mHelpedCompleted;
+        std::atomic<unsigned long long> mHelpedFailed;
+
+        //! Store the function raised once each Task has been processed, used to trace the workload
+        std::atomic<processedHook> mProcessedHook;
+
+        //! Store the fire and forget jobs waiting for a Worker, in the order they are handed out (guarded by the Task lock)
+        LightJob* mLightHead;
+        LightJob* mLightTail;
+
+        //! Keep the free fire and forget job records and the blocks they were allocated in
+        LightJob* mFreeLightJobs;
+        std::vector<LightJob*> mLightBlocks;
+
+        //! Create a lock to prevent thread clashes over the free job records
+        std::mutex mLightLock;
 
         /*----------Functions----------*/
         //! Organise tasks in a separate thread
         void organiseTasks();
 
+        //! Order the Tasks waiting for a Worker
+        static inline bool runsBefore(ETaskPriority pFirst, ETaskPriority pSecond);
+
+        //! Raise the timers that are due
+        void raiseTimers();
+
+        //! Internal Task pipeline shared with the Task Manager subsystems
+        static bool lockTask(Asynch_Task_Base& pTask);
+        static void queueTask(const std::shared_ptr<Asynch_Task_Base>& pTask);
+        static void releaseTask(Asynch_Task_Base& pTask);
+        static void setPriority(Asynch_Task_Base& pTask, ETaskPriority pPriority);
+        static void setFinishHook(Asynch_Task_Base& pTask, const std::function<void()>& pHook);
+        static void raiseFinishHooks(taskList& pTasks);
+        static long long queuedAt(const Asynch_Task_Base& pTask);
+        static const std::type_info& processType(const Asynch_Task_Base& pTask);
+        static void setProcessedHook(processedHook pHook);
+        template<class T> static void setProcess(Asynch_Task_Job<T>& pTask, std::function<T()> pProcess);
+
+        //! Manage the records of the fire and forget jobs
+        static LightJob* takeLightJob();
+        static void queueLightJob(LightJob* pJob);
+        static void recycleJob(LightJob* pJob);
+        void discardLightJobs();
+
+        //! Group the pending Tasks of the same batch kind with a Task given to a Worker
+        void gatherBatch(Asynch_Task_Base& pTask);
+
+        //! Collect the Tasks that were processed in the batch of a Worker's Task
+        void collectBatch(Worker& pWorker);
+
+        //! Take a pending Task of a scope from the uncompleted list and process it on the calling thread
+        static bool runScoped(const TaskScope* pScope);
+
+        //! Raise the processed hook for the first attempt of a Task
+        static void reportProcessed(const Asynch_Task_Base& pTask, long long pStarted, bool pFailed);
+
+        //! Queue a failed Task again if its retry policy allows
+        static bool retryTask(std::shared_ptr<Asynch_Task_Base>& pTask, const std::exception_ptr& pError);
+
+        //! Queue a retried Task once its backoff delay has passed
+        static void startRetry(const std::chrono::steady_clock::time_point& pDue, std::shared_ptr<Asynch_Task_Base> pTask);
+
+        //! Timer pipeline shared with the Task Manager subsystems
+        static timerID startTimer(const std::chrono::steady_clock::time_point& pDue, std::function<void()> pFire, std::function<void()> pCancel = nullptr);
+        static void stopTimer(timerID pTimer);
+
     public:
         //! Main operation functionality
         static bool create(unsigned int pWorkers = 5u);
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        static bool create(unsigned int pWorkers, std::pmr::memory_resource* pResource);
+#endif
         static void update();
         static void destroy();
 
         //! Task options
         template<class T> static Task<T> createTask();
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        template<class T> static Task<T> createTask(std::pmr::memory_resource* pResource);
+#endif
+        template<class F, class... Args> static Task<boundResult<F, Args...>> createTask(F&& pFunction, Args&&... pArguments);
+        template<class In, class Out> static BatchKind<In, Out> createBatchKind(const std::function<void(const In*, Out*, size_t)>& pProcess, size_t pLimit = 64, const std::function<void(Out*, size_t)>& pCallback = nullptr);
+        template<class In, class Out> static Task<Out> createBatchTask(const BatchKind<In, Out>& pKind, In pInput);
         template<class T> static bool addTask(Task<T>& pTask);
+        template<class F> static bool run(F&& pFunction, ETaskPriority pPriority = Low_Priority);
+
+        /*----------Getters----------*/
+        static TaskMetrics metrics();
 
         /*----------Setters----------*/
         static inline void setWorkerTimeout(unsigned int pTime);
@@ -284,7 +576,7 @@ namespace AsynchTasks {
      *      Name: Asynch_Task_Base
      *      Author: Mitchell Croft
      *      Created: 17/08/2016
-     *      Modified: 10/01/2017
+     *      Modified: 18/10/2026
      *      
      *      Purpose:
      *      An abstract base class to allow for the creation and
@@ -318,6 +610,35 @@ namespace AsynchTasks {
         //! String used to contain and display error messages to the user
         std::string mErrorMsg;
 
+        //! Store a function used by the Task Manager subsystems to be notified when the Task has finished
+        std::function<void()> mOnFinish;
+
+        //! Store the policy used to retry the Task when the process fails
+        RetryPolicy mRetryPolicy;
+
+        //! Count the number of times the Task has been retried since it was added
+        unsigned int mRetryCount;
+
+        //! Store the time the Task was last added to the uncompleted list (in steady clock ticks)
+        long long mQueuedAt;
+
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        //! Store the memory resource the Task and its result are allocated from (nullptr for the global heap)
+        std::pmr::memory_resource* mResource = nullptr;
+#endif
+
+        //! Identify the kind of Tasks this Task can be processed in a batch with (nullptr if not batched)
+        const void* mBatchKind;
+
+        //! Store the maximum number of Tasks processed in one batch
+        size_t mBatchLimit;
+
+        //! Store the pending Tasks of the same kind grouped with this Task by the Task Manager
+        std::vector<std::shared_ptr<Asynch_Task_Base>> mBatch;
+
+        //! Identify the scope the Task was spawned into (nullptr if not scoped)
+        const TaskScope* mScope;
+
         /*----------Functions----------*/
         Asynch_Task_Base();
         virtual ~Asynch_Task_Base() = default;
@@ -328,6 +649,13 @@ namespace AsynchTasks {
         virtual void completeProcess() = 0;
         virtual void completeCallback() = 0;
         virtual void cleanupData() = 0;
+
+        //! Identify the function processed by the Task
+        virtual const std::type_info& processType() const = 0;
+
+        //! Deliver the results of Tasks of the same batch kind to the callback of the kind
+        virtual bool hasBatchCallback() const { return false; }
+        virtual void completeBatchCallback(std::vector<std::shared_ptr<Asynch_Task_Base>>& /*pTasks*/) {}
         
     public:
         //! Expose the ID and status values to the user for reading
@@ -342,6 +670,12 @@ namespace AsynchTasks {
 
         //! Expose the error string to the user for reading
         Properties::ReadOnlyProperty<std::string> error;
+
+        //! Expose the retry policy to the user
+        Properties::ReadWriteFlaggedProperty<RetryPolicy> retryPolicy;
+
+        //! Expose the number of retries to the user for reading
+        Properties::ReadOnlyProperty<unsigned int> retries;
     };
 
     /*
@@ -360,6 +694,10 @@ namespace AsynchTasks {
         //! Set as a friend of the Task Manager to allow for construction and use
         friend class TaskManager;
 
+        //! Set the bound and batched Tasks as friends to allow them to extend the Task
+        template<class, class, class...> friend class Asynch_Bound_Task_Job;
+        template<class, class> friend class Asynch_Batch_Task_Job;
+
         //! Store a pointer of type T to keep the return result in
         T* mResult;
 
@@ -375,6 +713,10 @@ namespace AsynchTasks {
         void completeProcess() override;
         void completeCallback() override;
         void cleanupData() override;
+        const std::type_info& processType() const override;
+
+        //! Store the result of the process
+        void storeResult(T&& pResult);
 
     public:
         //! Expose the destructor to allow for the shared pointers to delete used jobs
@@ -408,8 +750,35 @@ namespace AsynchTasks {
     */
     template<class T>
     inline void Asynch_Task_Job<T>::completeProcess() {
-        //Create a pointer to a new object of T and call the copy constructor on the return from the process
-        mResult = new T(mProcess());
+        //Store the return from the process
+        storeResult(mProcess());
+    }
+
+    /*
+        Asynch_Task_Job<T> : storeResult - Move a result into memory owned by the Task
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        param[in] pResult - The result to store
+    */
+    template<class T>
+    inline void Asynch_Task_Job<T>::storeResult(T&& pResult) {
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        //Construct the result in the memory resource of the Task, passing the resource on to
+        //results that use a polymorphic allocator
+        if (mResource) {
+            std::pmr::polymorphic_allocator<T> allocator(mResource);
+            T* result = allocator.allocate(1);
+            try { allocator.construct(result, std::move(pResult)); }
+            catch (...) { allocator.deallocate(result, 1); throw; }
+            mResult = result;
+            return;
+        }
+#endif
+
+        //Create a pointer to a new object of T and call the move constructor on the result
+        mResult = new T(std::move(pResult));
     }
 
     /*
@@ -432,6 +801,16 @@ namespace AsynchTasks {
     */
     template<class T>
     inline void AsynchTasks::Asynch_Task_Job<T>::cleanupData() {
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        //Return the result to the memory resource it was allocated from
+        if (mResult && mResource) {
+            std::pmr::polymorphic_allocator<T> allocator(mResource);
+            mResult->~T();
+            allocator.deallocate(mResult, 1);
+            mResult = nullptr;
+        }
+#endif
+
         //Check if the data has been set
         if (mResult) delete mResult;
 
@@ -439,6 +818,17 @@ namespace AsynchTasks {
         mResult = nullptr;
     }
 
+    /*
+        Asynch_Task_Job<T> : processType - Identify the function processed by the Task
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return const std::type_info& - Returns the type of the process function (void if not set)
+    */
+    template<class T>
+    inline const std::type_info& Asynch_Task_Job<T>::processType() const { return mProcess.target_type(); }
+
     /*
         Asynch_Task_Job<T> : Destructor - Delete any memory used by the Task
         Author: Mitchell Croft
@@ -466,6 +856,10 @@ namespace AsynchTasks {
         //! Set as a friend of the Task Manager to allow for construction and use
         friend class TaskManager;
 
+        //! Set the bound and scoped Tasks as friends to allow them to extend the Task
+        template<class, class, class...> friend class Asynch_Bound_Task_Job;
+        template<class> friend class Asynch_Scoped_Task_Job;
+
         //Store the function calls to process
         std::function<void()> mProcess;
         std::function<void()> mCallback;
@@ -478,6 +872,7 @@ namespace AsynchTasks {
         void completeProcess() override;
         void completeCallback() override;
         void cleanupData() override;
+        const std::type_info& processType() const override;
 
     public:
         //! Expose the destructor to allow for the shared pointers to delete used jobs
@@ -529,276 +924,1678 @@ namespace AsynchTasks {
         Modified: 19/08/2016
     */
     inline void Asynch_Task_Job<void>::cleanupData() {}
-    #pragma endregion
+
+    /*
+        Asynch_Task_Job<void> : processType - Identify the function processed by the Task
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        return const std::type_info& - Returns the type of the process function (void if not set)
+    */
+    inline const std::type_info& Asynch_Task_Job<void>::processType() const { return mProcess.target_type(); }
     #pragma endregion
 
-    #pragma region Worker Definition
+    #pragma region Bound Task Definition
     /*
-     *      Name: Worker
+     *      Name: Asynch_Bound_Task_Job
      *      Author: Mitchell Croft
-     *      Created: 18/08/2016
-     *      Modified: 20/08/2016
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
      *
      *      Purpose:
-     *      Execute the Tasks provided to it by the Task Manager
+     *      Extend a Task with a function and the decayed arguments to call it
+     *      with, stored inside of the Task object. The process property is set
+     *      to a function that only captures the Task, which std::function
+     *      stores without allocating.
+     *
+     *      Requires:
+     *      The arguments are moved into the function when the process runs, so
+     *      adding the Task again calls the function with the moved from
+     *      arguments.
     **/
-    class TaskManager::Worker {
-        /*----------Variables----------*/
-        //! Flags if the processing thread is running
-        std::atomic_flag mRunning;
-
-        //! The thread that is running the Task processes
-        std::thread mProcessingThread;
-
-        //! Used to indicate how many seconds of inactivity must pass before the Worker goes to sleep
-        Properties::ReadOnlyProperty<unsigned int> mInactiveTimeout;
+    template<class T, class F, class... Args>
+    class Asynch_Bound_Task_Job : public Asynch_Task_Job<T> {
+        //! Set as a friend of the Task Manager to allow for construction
+        friend class TaskManager;
 
-        //! Used to indicate how long the processing thread should sleep when inactive
-        Properties::ReadOnlyProperty<unsigned int> mSleepLength;
+        //! Store the function and the arguments to call it with
+        F mFunction;
+        std::tuple<Args...> mArguments;
 
         /*----------Functions----------*/
+        //! Restrict Job creation to the Task Manager
+        template<class Function, class... Arguments>
+        Asynch_Bound_Task_Job(Function&& pFunction, Arguments&&... pArguments) :
+            mFunction(std::forward<Function>(pFunction)),
+            mArguments(std::forward<Arguments>(pArguments)...)
+        {
+            Asynch_Task_Job<T>::mProcess = [this]() -> T { return call(std::index_sequence_for<Args...>()); };
+        }
 
-        //! Function run on the Worker Thread to process Tasks given to it
-        void doWork();
-
-    public:
-        /*----------Variables----------*/
-        //! Used to store an active Task to complete
-        std::shared_ptr<Asynch_Task_Base> task;
-
-        //! Used to flag when the Worker has finished their Task and protect modification clashes
-        std::mutex taskLock;
+        //! Call the function, moving the arguments in
+        template<size_t... I>
+        inline T call(std::index_sequence<I...>) { return mFunction(std::move(std::get<I>(mArguments))...); }
 
-        /*----------Functions----------*/
-        Worker();
-        ~Worker();
+        //! Identify the bound function rather than the function calling it
+        const std::type_info& processType() const override { return typeid(F); }
     };
     #pragma endregion
 
-    #pragma region Task Manager Templated Definitions
+    #pragma region Batch Task Definition
     /*
-        TaskManager : createTask - Return a new Task object with a return type of T
-        Author: Mitchell Croft
-        Created: 18/08/2016
-        Modified: 18/08/2016
-
-        return Task<T> - Returns a Task<T> shared pointer to a new Task object
-    */
-    template<class T>
-    inline Task<T> TaskManager::createTask() {
-        //Create a new Task
-        Task<T> newTask = Task<T>(new Asynch_Task_Job<T>());
+     *      Name: Asynch_Batch_Kind
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Describe a kind of Task that shares a process function and only
+     *      differs in its input, allowing the Task Manager to process many
+     *      pending Tasks of the kind with a single call.
+    **/
+    template<class In, class Out>
+    struct Asynch_Batch_Kind {
+        //! Store the function that processes a span of inputs, writing an output for each
+        std::function<void(const In* pInputs, Out* pOutputs, size_t pCount)> process;
 
-        //ID stamp the new task
-        newTask->mID = ++mInstance->mNextID;
+        //! Store the function that receives a span of the results of Tasks with callbacks on update (optional)
+        std::function<void(Out* pResults, size_t pCount)> callback;
 
-        //Return the task
-        return newTask;
-    }
+        //! Store the maximum number of Tasks processed in one batch
+        size_t limit;
+    };
 
     /*
-        TaskManager : addTask - Add a new Task to the Task Manager for processing
-        Author: Mitchell Croft
-        Created: 18/08/2016
-        Modified: 18/08/2016
+     *      Name: Asynch_Batch_Task_Job
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Extend a Task with an input and the kind of batch it belongs to.
+     *      When a Worker is given the Task, the Task Manager groups it with
+     *      the pending Tasks of the same kind (up to the limit of the kind).
+     *      The Task then calls the batch function once for the group and
+     *      completes each of the grouped Tasks, running their callbacks as
+     *      their own process would have.
+     *
+     *      If the kind has a callback, Tasks of the kind with callbacks on
+     *      update have their results moved into a span and delivered to it
+     *      by update, in one call for the Tasks of the kind within the
+     *      callback limit, instead of to their own callbacks.
+     *
+     *      Requires:
+     *      The output type must be default constructible. The process
+     *      property is set to process the Task as a batch of one, and must
+     *      not be replaced. A batch that throws fails each of its Tasks,
+     *      which aren't retried unless the Task was processed alone.
+    **/
+    template<class In, class Out>
+    class Asynch_Batch_Task_Job : public Asynch_Task_Job<Out> {
+        static_assert(!std::is_void<Out>::value, "Batched Tasks must produce an output");
 
-        Note:
-        Priority of the Task does not ensure execution before lower priority tasks.
-        If a lower priority Task was added before the higher priority Task it is 
-        possible for the lower priority Task to begin processing before the higher
-        priority Task is added to the Task Manager.
+        //! Set as a friend of the Task Manager to allow for construction
+        friend class TaskManager;
 
-        param[in/out] pTask - A Task<T> object to be added to the list. Once added to the
-                              Task Manager the property values will be uneditable.
+        //! Store the kind of the Task, keeping the batch function alive
+        BatchKind<In, Out> mKind;
 
-        return bool - Returns a flag determining if the Task was added to the manager
-                      successfully.
-    */
-    template<class T>
-    inline bool TaskManager::addTask(Task<T>& pTask) {
-        //Ensure that the pointer is valid
-        if (!pTask) return false;
+        //! Store the input of the Task
+        In mInput;
 
-        //Ensure that the task is in the setup or complete state
-        switch (pTask->mStatus) {
-        case ETaskStatus::Setup:
-        case ETaskStatus::Completed: break;
-        default: return false;
+        /*----------Functions----------*/
+        //! Restrict Job creation to the Task Manager
+        Asynch_Batch_Task_Job(const BatchKind<In, Out>& pKind, In&& pInput) :
+            mKind(pKind),
+            mInput(std::move(pInput))
+        {
+            this->mBatchKind = mKind.get();
+            this->mBatchLimit = mKind->limit;
+            Asynch_Task_Job<Out>::mProcess = [this]() -> Out { Out output; mKind->process(&mInput, &output, 1); return output; };
         }
 
-        //Ensure that the task has at minimum a process functions set
-        if (!pTask->mProcess) return false;
+        //! Process the Task along with the Tasks grouped with it
+        void completeProcess() override;
 
-        //Lock down the tasks values
-        pTask->mLockValues = true;
+        //! Return the inputs moved out for the batch function to their Tasks
+        void restoreInputs(std::vector<In>& pInputs);
 
-        //Change the state to indicate pending processing
-        pTask->mStatus = ETaskStatus::Pending;
+        //! Flag the grouped Tasks with an error
+        void failBatch(const std::string& pMessage, long long pStarted);
 
-        //Lock the Task list
-        mInstance->mTaskLock.lock();
+        //! Complete a grouped Task with its output
+        static void completeGrouped(Asynch_Batch_Task_Job& pTask, Out&& pOutput, long long pStarted);
 
-        //Add the task to the vector
-        mInstance->mUncompletedTasks.push_back(pTask);
+        //! Describe the exception currently being handled
+        static std::string currentError();
 
-        //Sort the list based on the priority of the Tasks
-        std::sort(mInstance->mUncompletedTasks.begin(),
-            mInstance->mUncompletedTasks.end(),
-            [&](const std::shared_ptr<Asynch_Task_Base>& pFirst, const std::shared_ptr<Asynch_Task_Base>& pSecond) {
-            return pFirst->mPriority > pSecond->mPriority;
-        });
+        //! Identify the batch function rather than the function calling it
+        const std::type_info& processType() const override { return mKind->process.target_type(); }
 
-        //Unlock the task list
-        mInstance->mTaskLock.unlock();
+        //! Deliver the results of Tasks of the kind to the callback of the kind
+        bool hasBatchCallback() const override { return (bool)mKind->callback; }
+        void completeBatchCallback(std::vector<std::shared_ptr<Asynch_Task_Base>>& pTasks) override;
+    };
 
-        //Return success
-        return true;
+    /*
+        Asynch_Batch_Task_Job : completeProcess - Process the Task and the Tasks grouped with it
+                                                  in a single call to the batch function
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+    */
+    template<class In, class Out>
+    inline void Asynch_Batch_Task_Job<In, Out>::completeProcess() {
+        //Process the Task alone if it wasn't grouped with others
+        if (this->mBatch.empty()) {
+            Asynch_Task_Job<Out>::completeProcess();
+            return;
+        }
+
+        //Store the time the grouped Tasks started processing
+        const long long started = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        //Store the inputs and outputs of the batch, this Task first
+        const size_t count = this->mBatch.size() + 1;
+        std::vector<In> inputs;
+        std::vector<Out> outputs;
+
+        //Process the batch, failing the grouped Tasks if it throws
+        try {
+            //Move the inputs into a span, they are returned once the batch is processed
+            inputs.reserve(count);
+            inputs.push_back(std::move(mInput));
+            for (auto& task : this->mBatch) {
+                Asynch_Batch_Task_Job& grouped = static_cast<Asynch_Batch_Task_Job&>(*task);
+                inputs.push_back(std::move(grouped.mInput));
+                grouped.mStatus = ETaskStatus::In_Progress;
+            }
+
+            //Call the batch function
+            outputs.resize(count);
+            mKind->process(inputs.data(), outputs.data(), count);
+        } catch (...) {
+            restoreInputs(inputs);
+            failBatch(currentError(), started);
+            throw;
+        }
+        restoreInputs(inputs);
+
+        //Complete the grouped Tasks
+        for (size_t i = 1; i < count; i++)
+            completeGrouped(static_cast<Asynch_Batch_Task_Job&>(*this->mBatch[i - 1]), std::move(outputs[i]), started);
+
+        //Store the result of this Task
+        this->storeResult(std::move(outputs[0]));
     }
 
     /*
-        TaskManager : setWorkerTimeout - Set the time each Worker waits for work before 
-                                         going to sleep
+        Asynch_Batch_Task_Job : restoreInputs - Return the inputs moved out for the batch function
+                                                to their Tasks, so the Tasks can be added again
         Author: Mitchell Croft
-        Created: 18/08/2016
-        Modified: 11/01/2017
+        Created: 18/10/2026
+        Modified: 18/10/2026
 
-        param[in] pTime - The amount of time (in milliseconds) to wait
+        param[in/out] pInputs - The inputs of the batch, this Task first. May hold fewer inputs
+                                than there are Tasks if gathering them threw
     */
-    inline void TaskManager::setWorkerTimeout(unsigned int pTime) {
-        mInstance->mWorkerInactiveTimeout = pTime;
+    template<class In, class Out>
+    inline void Asynch_Batch_Task_Job<In, Out>::restoreInputs(std::vector<In>& pInputs) {
+        if (pInputs.size()) mInput = std::move(pInputs[0]);
+        for (size_t i = 1; i < pInputs.size(); i++)
+            static_cast<Asynch_Batch_Task_Job&>(*this->mBatch[i - 1]).mInput = std::move(pInputs[i]);
     }
 
     /*
-        TaskManager : setWorkerSleep - Set the time each worker is asleep for in between 
-                                       checking for new Tasks
+        Asynch_Batch_Task_Job : failBatch - Flag each of the grouped Tasks with an error
         Author: Mitchell Croft
-        Created: 18/08/2016
-        Modified: 18/08/2016
+        Created: 18/10/2026
+        Modified: 18/10/2026
 
-        param[in] pTime - The amount of time (in milliseconds) to sleep
+        param[in] pMessage - The message of the error
+        param[in] pStarted - The time (in steady clock ticks) the batch started processing
     */
-    inline void TaskManager::setWorkerSleep(unsigned int pTime) {
-        mInstance->mWorkerSleepLength = pTime;
+    template<class In, class Out>
+    inline void Asynch_Batch_Task_Job<In, Out>::failBatch(const std::string& pMessage, long long pStarted) {
+        for (auto& task : this->mBatch) {
+            Asynch_Batch_Task_Job& grouped = static_cast<Asynch_Batch_Task_Job&>(*task);
+            TaskManager::reportProcessed(grouped, pStarted, true);
+            grouped.mErrorMsg = pMessage;
+            grouped.mStatus = ETaskStatus::Error;
+            grouped.mLockValues = false;
+        }
     }
 
     /*
-        TaskManager : setMaxCallbacks - Set the maximum number of callbacks that can
-                                        occur every time TaskManager::update is called
+        Asynch_Batch_Task_Job : completeGrouped - Complete a grouped Task the same way a Worker
+                                                  completes the Task it was given
         Author: Mitchell Croft
-        Created: 18/08/2016
-        Modified: 10/01/2017
+        Created: 18/10/2026
+        Modified: 18/10/2026
 
-        param[in] pMax - The maximum number of callbacks that can be executed
+        param[in/out] pTask - The grouped Task to complete
+        param[in] pOutput - The output of the batch function for the Task
+        param[in] pStarted - The time (in steady clock ticks) the batch started processing
     */
-    inline void TaskManager::setMaxCallbacks(unsigned int pMax) {
-        mInstance->mMaxCallbacksOnUpdate = pMax;
-    }
-    #pragma endregion
-}
+    template<class In, class Out>
+    inline void Asynch_Batch_Task_Job<In, Out>::completeGrouped(Asynch_Batch_Task_Job& pTask, Out&& pOutput, long long pStarted) {
+        //Store the message of an error thrown while completing the Task
+        std::string message;
+        bool failed = false;
 
-/*
+        //Store the result and run the callback if it doesn't need to be run on main
+        try {
+            pTask.storeResult(std::move(pOutput));
+            if (!pTask.mCallbackOnUpdate) pTask.completeCallback();
+        } catch (...) {
+            message = currentError();
+            failed = true;
+        }
 
-    Function Definitions:
+        //Report the grouped Task as the Worker reports the Task it was given
+        TaskManager::reportProcessed(pTask, pStarted, failed);
 
-    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
-    of the project to use the AsynchTasks namespace functionality
+        //Flag the Task with the error
+        if (failed) {
+            pTask.mErrorMsg = std::move(message);
+            pTask.mStatus = ETaskStatus::Error;
+            pTask.mLockValues = false;
+            pTask.cleanupData();
+        }
 
-*/
-#ifdef _ASYNCHRONOUS_TASKS_
-//! Define static singleton instance
-AsynchTasks::TaskManager* AsynchTasks::TaskManager::mInstance = nullptr;
+        //Flag the Task as completed
+        else if (!pTask.mCallbackOnUpdate) {
+            pTask.mStatus = ETaskStatus::Completed;
+
+            //Allow editing of Task values
+            pTask.mLockValues = false;
+
+            //Clear Tasks allocated memory
+            pTask.cleanupData();
+        }
+
+        //Otherwise flag the Task as needing to be called in main
+        else pTask.mStatus = ETaskStatus::Callback_On_Update;
+    }
+
+    /*
+        Asynch_Batch_Task_Job : completeBatchCallback - Deliver the results of Tasks of the kind
+                                                        to the callback of the kind in one call
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        If the callback throws, each of the Tasks is flagged with the error
+
+        param[in/out] pTasks - The Tasks of the kind waiting for their callback, in the order
+                               the callbacks would have been raised
+    */
+    template<class In, class Out>
+    inline void Asynch_Batch_Task_Job<In, Out>::completeBatchCallback(std::vector<std::shared_ptr<Asynch_Task_Base>>& pTasks) {
+        //Store the message of an error thrown by the callback
+        std::string message;
+        bool failed = false;
+
+        //Deliver the results in a single span
+        try {
+            std::vector<Out> results;
+            results.reserve(pTasks.size());
+            for (auto& task : pTasks) results.push_back(std::move(*static_cast<Asynch_Batch_Task_Job&>(*task).mResult));
+            mKind->callback(results.data(), results.size());
+        } catch (...) {
+            message = currentError();
+            failed = true;
+        }
+
+        //Finish the Tasks
+        for (auto& task : pTasks) {
+            Asynch_Batch_Task_Job& delivered = static_cast<Asynch_Batch_Task_Job&>(*task);
+            if (failed) {
+                delivered.mErrorMsg = message;
+                delivered.mStatus = ETaskStatus::Error;
+            } else delivered.mStatus = ETaskStatus::Completed;
+            delivered.mLockValues = false;
+            delivered.cleanupData();
+        }
+    }
+
+    /*
+        Asynch_Batch_Task_Job : currentError - Describe the exception currently being handled
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Requires:
+        Must be called from within a catch block
+
+        return std::string - Returns the message of the exception
+    */
+    template<class In, class Out>
+    inline std::string Asynch_Batch_Task_Job<In, Out>::currentError() {
+        try { throw; }
+        catch (const std::exception& pExc) { return pExc.what(); }
+        catch (const std::string& pExc) { return pExc; }
+        catch (...) { return "An unknown error occurred while executing the Task. Error thrown did not provide any information as to the cause\n"; }
+    }
+    #pragma endregion
+    #pragma endregion
+
+    #pragma region Timer Definition
+    /*
+     *      Name: Timer
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a function to raise (or a retried Task to queue) on the
+     *      organisation thread once a point in time has been reached
+    **/
+    struct TaskManager::Timer {
+        //! Store the time the timer is due
+        std::chrono::steady_clock::time_point due;
+
+        //! Store the ID used to stop the timer
+        timerID id;
+
+        //! Store the function to raise (empty once stopped)
+        std::function<void()> fire;
+
+        //! Store the function to raise if the Task Manager is destroyed before the timer is due (optional)
+        std::function<void()> cancel;
+
+        //! Store the Task to queue in place of the functions, used by retries to avoid allocating
+        std::shared_ptr<Asynch_Task_Base> retry;
+
+        //! Order the timers so the soonest is at the front of the heap
+        inline bool operator<(const Timer& pOther) const { return due > pOther.due; }
+    };
+    #pragma endregion
+
+    #pragma region Light Job Definition
+    /*
+     *      Name: LightJob
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a fire and forget job added with TaskManager::run. The record
+     *      is plain data, the function is stored inline when it fits (or on
+     *      the heap otherwise) and the records are kept in a free list so
+     *      they are reused without allocating.
+    **/
+    struct TaskManager::LightJob {
+        //! Define the number of bytes a function can use before it is stored on the heap
+        static const size_t STORAGE = 6 * sizeof(void*);
+
+        //! Define the number of records allocated at once when the free list is empty
+        static const size_t BLOCK = 64;
+
+        //! Store the function that processes (if flagged) and then destroys the stored function
+        void(*handle)(LightJob& pJob, bool pProcess);
+
+        //! Store the next record in the queue or free list
+        LightJob* next;
+
+        //! Store the ID and priority of the job
+        taskID id;
+        ETaskPriority priority;
+
+        //! Store the function, or a pointer to it if it doesn't fit
+        alignas(std::max_align_t) unsigned char storage[STORAGE];
+
+        //! Store a function in the record
+        template<class F> inline void store(F&& pFunction) {
+            typedef typename std::decay<F>::type Function;
+            if (sizeof(Function) <= STORAGE && alignof(Function) <= alignof(std::max_align_t)) {
+                new (storage) Function(std::forward<F>(pFunction));
+                handle = &handleInline<Function>;
+            } else {
+                *(Function**)storage = new Function(std::forward<F>(pFunction));
+                handle = &handleHeap<Function>;
+            }
+        }
+
+        //! Process and destroy a function stored in the record
+        template<class Function> static void handleInline(LightJob& pJob, bool pProcess) {
+            struct Destroy { Function& function; ~Destroy() { function.~Function(); } } destroy = { *(Function*)pJob.storage };
+            if (pProcess) destroy.function();
+        }
+
+        //! Process and destroy a function stored on the heap
+        template<class Function> static void handleHeap(LightJob& pJob, bool pProcess) {
+            std::unique_ptr<Function> function(*(Function**)pJob.storage);
+            if (pProcess) (*function)();
+        }
+
+        //! Check if a function is empty before it is stored
+        template<class F> static inline bool isEmpty(const F&) { return false; }
+        template<class R, class... Args> static inline bool isEmpty(const std::function<R(Args...)>& pFunction) { return !pFunction; }
+        template<class R, class... Args> static inline bool isEmpty(R(*pFunction)(Args...)) { return !pFunction; }
+    };
+    #pragma endregion
+
+    #pragma region Worker Definition
+    /*
+     *      Name: Worker
+     *      Author: Mitchell Croft
+     *      Created: 18/08/2016
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Execute the Tasks provided to it by the Task Manager
+    **/
+    class TaskManager::Worker {
+        /*----------Variables----------*/
+        //! Flags if the processing thread is running
+        std::atomic_flag mRunning;
+
+        //! The thread that is running the Task processes
+        std::thread mProcessingThread;
+
+        //! Used to indicate how many seconds of inactivity must pass before the Worker goes to sleep
+        Properties::ReadOnlyProperty<unsigned int> mInactiveTimeout;
+
+        //! Used to indicate how long the processing thread should sleep when inactive
+        Properties::ReadOnlyProperty<unsigned int> mSleepLength;
+
+        /*----------Functions----------*/
+
+        //! Function run on the Worker Thread to process Tasks given to it
+        void doWork();
+
+    public:
+        /*----------Variables----------*/
+        //! Used to store an active Task to complete
+        std::shared_ptr<Asynch_Task_Base> task;
+
+        //! Used to store an active fire and forget job to complete
+        LightJob* light;
+
+        //! Used to flag when the Worker has finished their Task and protect modification clashes
+        std::mutex taskLock;
+
+        //! Store the state of the Worker so it can be inspected without taking the Task lock
+        std::atomic<taskID> activeID;               //0 when no Task is being processed
+        std::atomic<unsigned int> activePriority;
+        std::atomic<long long> activeSince;         //Steady clock ticks
+        std::atomic_bool sleeping;
+
+        //! Count the Tasks processed by the Worker
+        std::atomic<unsigned long long> completed;
+        std::atomic<unsigned long long> failed;
+
+        /*----------Functions----------*/
+        Worker();
+        ~Worker();
+    };
+    #pragma endregion
+
+    #pragma region Task Manager Templated Definitions
+    /*
+        TaskManager : createTask - Return a new Task object with a return type of T
+        Author: Mitchell Croft
+        Created: 18/08/2016
+        Modified: 18/08/2016
+
+        return Task<T> - Returns a Task<T> shared pointer to a new Task object
+    */
+    template<class T>
+    inline Task<T> TaskManager::createTask() {
+        //Create a new Task
+        Task<T> newTask = Task<T>(new Asynch_Task_Job<T>());
+
+        //ID stamp the new task
+        newTask->mID = mInstance->mNextID.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        //Return the task
+        return newTask;
+    }
+
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+    /*
+        TaskManager : createTask - Return a new Task object with a return type of T, allocated
+                                   from a memory resource
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The Task object, its reference count and each result of the process are allocated from
+        the resource. Results that use a polymorphic allocator (E.g. std::pmr::vector) are given
+        the resource for their own allocations. The process and callback functions still use the
+        global heap, as std::function has no allocator support
+
+        Requires:
+        The resource must outlive the Task and any copies of its result that use the resource.
+        The Task Manager can hold a finished Task until its next organisation pass, so release
+        the resource once the Task Manager has been destroyed (or the Tasks have been reused).
+        Results are allocated on the Worker threads, so a resource shared by several Tasks must
+        be thread safe (See LockedResource)
+
+        param[in] pResource - The memory resource to allocate from
+
+        return Task<T> - Returns a Task<T> shared pointer to a new Task object
+    */
+    template<class T>
+    inline Task<T> TaskManager::createTask(std::pmr::memory_resource* pResource) {
+        //Construct the Task in memory from the resource
+        void* memory = pResource->allocate(sizeof(Asynch_Task_Job<T>), alignof(Asynch_Task_Job<T>));
+        Asynch_Task_Job<T>* job;
+        try { job = new (memory) Asynch_Task_Job<T>(); }
+        catch (...) { pResource->deallocate(memory, sizeof(Asynch_Task_Job<T>), alignof(Asynch_Task_Job<T>)); throw; }
+        job->mResource = pResource;
+
+        //Share the Task, returning its memory to the resource once the last reference is released
+        Task<T> newTask = Task<T>(job, [pResource](Asynch_Task_Job<T>* pJob) {
+            pJob->~Asynch_Task_Job<T>();
+            pResource->deallocate(pJob, sizeof(Asynch_Task_Job<T>), alignof(Asynch_Task_Job<T>));
+        }, std::pmr::polymorphic_allocator<char>(pResource));
+
+        //ID stamp the new task
+        newTask->mID = mInstance->mNextID.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        //Return the task
+        return newTask;
+    }
+#endif
+
+    /*
+        TaskManager : createTask - Return a new Task object that calls a function with a set of
+                                   arguments stored inside of the Task
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The arguments are decayed and stored by value, then moved into the function when the
+        process runs. The process property is set, replacing it discards the bound function
+
+        param[in] pFunction - The function to call as the process
+        param[in] pArguments - The arguments to call the function with
+
+        return Task<boundResult<F, Args...>> - Returns a Task shared pointer to a new Task object,
+                                              with a return type of the function
+    */
+    template<class F, class... Args>
+    inline Task<boundResult<F, Args...>> TaskManager::createTask(F&& pFunction, Args&&... pArguments) {
+        //Create a new Task storing the function and arguments
+        typedef boundResult<F, Args...> T;
+        Task<T> newTask = Task<T>(new Asynch_Bound_Task_Job<T, typename std::decay<F>::type, typename std::decay<Args>::type...>(
+            std::forward<F>(pFunction), std::forward<Args>(pArguments)...));
+
+        //ID stamp the new task
+        newTask->mID = mInstance->mNextID.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        //Return the task
+        return newTask;
+    }
+
+    /*
+        TaskManager : createBatchKind - Return a new kind of Task that is processed in batches
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The batch function is called from the Worker threads with the inputs of between 1 and
+        pLimit Tasks, and must write an output for each input. The callback is called from update
+        with the results of the Tasks of the kind that have callbacks on update, replacing their
+        own callbacks. Each of the results counts towards the maximum callbacks per update
+
+        param[in] pProcess - The function that processes a batch of inputs
+        param[in] pLimit - The maximum number of Tasks processed in one batch (Default 64)
+        param[in] pCallback - The function that receives the results on update (Default nullptr
+                              uses the callbacks of the Tasks)
+
+        return BatchKind<In, Out> - Returns a shared pointer to the new kind
+    */
+    template<class In, class Out>
+    inline BatchKind<In, Out> TaskManager::createBatchKind(const std::function<void(const In*, Out*, size_t)>& pProcess, size_t pLimit, const std::function<void(Out*, size_t)>& pCallback) {
+        //Assert the kind is valid
+        assert(pProcess && pLimit);
+
+        //Create the kind
+        std::shared_ptr<Asynch_Batch_Kind<In, Out>> kind = std::make_shared<Asynch_Batch_Kind<In, Out>>();
+        kind->process = pProcess;
+        kind->callback = pCallback;
+        kind->limit = pLimit;
+        return kind;
+    }
+
+    /*
+        TaskManager : createBatchTask - Return a new Task object of a batch kind
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The Task is added with addTask as normal, and reports its status, result and error
+        individually once its batch has been processed
+
+        param[in] pKind - The kind of the Task
+        param[in] pInput - The input of the Task for the batch function
+
+        return Task<Out> - Returns a Task<Out> shared pointer to a new Task object
+    */
+    template<class In, class Out>
+    inline Task<Out> TaskManager::createBatchTask(const BatchKind<In, Out>& pKind, In pInput) {
+        //Create a new Task storing the kind and input
+        Task<Out> newTask = Task<Out>(new Asynch_Batch_Task_Job<In, Out>(pKind, std::move(pInput)));
+
+        //ID stamp the new task
+        newTask->mID = mInstance->mNextID.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        //Return the task
+        return newTask;
+    }
+
+    /*
+        TaskManager : run - Process a function on the Workers without a Task handle
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        The function is stored in a pooled job record rather than a Task, so there is no status,
+        result or error to check. Errors thrown by the function are discarded and the job isn't
+        reported to the processed hook, but it is counted in the metrics. Functions larger than
+        LightJob::STORAGE bytes are stored on the heap
+
+        param[in] pFunction - The function to process
+        param[in] pPriority - The priority of the job (Default Low_Priority)
+
+        return bool - Returns true if the job was added to the Task Manager
+    */
+    template<class F>
+    inline bool TaskManager::run(F&& pFunction, ETaskPriority pPriority) {
+        //Ensure the Task Manager exists and there is a function to process
+        if (!mInstance || LightJob::isEmpty(pFunction)) return false;
+
+        //Take a free record and store the function, returning the record if that fails
+        LightJob* job = takeLightJob();
+        try { job->store(std::forward<F>(pFunction)); }
+        catch (...) {
+            recycleJob(job);
+            throw;
+        }
+        job->priority = pPriority;
+
+        //Add the job to the queue for processing
+        queueLightJob(job);
+        return true;
+    }
+
+    /*
+        TaskManager : addTask - Add a new Task to the Task Manager for processing
+        Author: Mitchell Croft
+        Created: 18/08/2016
+        Modified: 18/10/2026
+
+        Note:
+        Priority of the Task does not ensure execution before lower priority tasks.
+        If a lower priority Task was added before the higher priority Task it is 
+        possible for the lower priority Task to begin processing before the higher
+        priority Task is added to the Task Manager.
+
+        param[in/out] pTask - A Task<T> object to be added to the list. Once added to the
+                              Task Manager the property values will be uneditable.
+
+        return bool - Returns a flag determining if the Task was added to the manager
+                      successfully.
+    */
+    template<class T>
+    inline bool TaskManager::addTask(Task<T>& pTask) {
+        //Ensure that the pointer is valid
+        if (!pTask) return false;
+
+        //Ensure that the task has at minimum a process functions set
+        if (!pTask->mProcess) return false;
+
+        //Ensure the task is in the setup or complete state and lock down its values
+        if (!lockTask(*pTask)) return false;
+
+        //Add the task to the list for processing
+        queueTask(pTask);
+
+        //Return success
+        return true;
+    }
+
+    /*
+        TaskManager : setProcess - Replace the process function of a Task from within the
+                                   Task Manager subsystems
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Used by subsystems that complete the work of a Task outside of the Workers (E.g.
+        asynchronous I/O). The process is replaced with a function that returns the 
+        previously gathered result so that the callback stage follows the regular path.
+
+        param[in] pTask - The Task object to modify
+        param[in] pProcess - The function to be used as the new process
+    */
+    template<class T>
+    inline void TaskManager::setProcess(Asynch_Task_Job<T>& pTask, std::function<T()> pProcess) {
+        pTask.mProcess = std::move(pProcess);
+    }
+
+    /*
+        TaskManager : runsBefore - Determine if a Task should be handed to a Worker before another
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Tasks that don't run before each other are handed out in the order they were queued
+
+        param[in] pFirst - The priority of the first Task
+        param[in] pSecond - The priority of the second Task
+
+        return bool - Returns true if the first Task is handed out before the second
+    */
+    inline bool TaskManager::runsBefore(ETaskPriority pFirst, ETaskPriority pSecond) {
+        return pFirst > pSecond;
+    }
+
+    /*
+        TaskManager : setWorkerTimeout - Set the time each Worker waits for work before 
+                                         going to sleep
+        Author: Mitchell Croft
+        Created: 18/08/2016
+        Modified: 11/01/2017
+
+        param[in] pTime - The amount of time (in milliseconds) to wait
+    */
+    inline void TaskManager::setWorkerTimeout(unsigned int pTime) {
+        mInstance->mWorkerInactiveTimeout = pTime;
+    }
+
+    /*
+        TaskManager : setWorkerSleep - Set the time each worker is asleep for in between 
+                                       checking for new Tasks
+        Author: Mitchell Croft
+        Created: 18/08/2016
+        Modified: 18/08/2016
+
+        param[in] pTime - The amount of time (in milliseconds) to sleep
+    */
+    inline void TaskManager::setWorkerSleep(unsigned int pTime) {
+        mInstance->mWorkerSleepLength = pTime;
+    }
+
+    /*
+        TaskManager : setMaxCallbacks - Set the maximum number of callbacks that can
+                                        occur every time TaskManager::update is called
+        Author: Mitchell Croft
+        Created: 18/08/2016
+        Modified: 10/01/2017
+
+        param[in] pMax - The maximum number of callbacks that can be executed
+    */
+    inline void TaskManager::setMaxCallbacks(unsigned int pMax) {
+        mInstance->mMaxCallbacksOnUpdate = pMax;
+    }
+    #pragma endregion
+
+    #pragma region Retry Policy Templated Definitions
+    /*
+        RetryPolicy : only - Create a filter that only retries errors of type E
+        Author: Mitchell Croft
+        Created: 18/10/2026
+        Modified: 18/10/2026
+
+        Note:
+        Errors thrown as types other than E (including std::string) are not retried
+
+        return std::function<bool(const std::exception_ptr&)> - Returns the filter to set as retryable
+    */
+    template<class E>
+    inline std::function<bool(const std::exception_ptr&)> RetryPolicy::only() {
+        return [](const std::exception_ptr& pError) {
+            //Rethrow the error to check its type
+            try { std::rethrow_exception(pError); }
+            catch (const E&) { return true; }
+            catch (...) { return false; }
+        };
+    }
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::TaskManager* AsynchTasks::TaskManager::mInstance = nullptr;
 
 #pragma region Task Manager Function Definitions
 /*
-    TaskManager : Custom Constructor - Set default pre-creation singleton values
+    TaskManager : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 16/08/2016
+    Modified: 18/10/2026
+
+    param[in] pWorkers - A constant value for the number of workers that will be used
+                         by the Task Manager
+    param[in] pResource - The memory resource to allocate the Task lists from (C++17 only)
+*/
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+AsynchTasks::TaskManager::TaskManager(unsigned int pWorkers, std::pmr::memory_resource* pResource) :
+#else
+AsynchTasks::TaskManager::TaskManager(unsigned int pWorkers) :
+#endif
+    /*----------Workers----------*/
+    mWorkerCount(pWorkers),
+    mWorkers(nullptr),
+    mWorkerInactiveTimeout(2000),
+    mWorkerSleepLength(100),
+
+    /*----------Tasks----------*/
+    mMaxCallbacksOnUpdate(10),
+    mNextID(0),
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+    mResource(pResource),
+    mUncompletedTasks(pResource),
+    mToCallOnUpdate(pResource),
+    mFinishedTasks(pResource),
+    mDueRetries(pResource),
+#endif
+
+    /*----------Timers----------*/
+    mNextTimer(std::chrono::steady_clock::time_point::max().time_since_epoch().count()),
+    mNextTimerID(1),
+
+    /*----------Metrics----------*/
+    mQueued(0),
+    mRetries(0),
+    mRetriesExhausted(0),
+    mHelpedCompleted(0),
+    mHelpedFailed(0),
+
+    /*----------Tracing----------*/
+    mProcessedHook(nullptr),
+
+    /*----------Fire and Forget----------*/
+    mLightHead(nullptr),
+    mLightTail(nullptr),
+    mFreeLightJobs(nullptr)
+{}
+
+/*
+    TaskManager : organiseTasks - Manage the active tasks and close finished jobs
+    Author: Mitchell Croft
+    Created: 16/08/2016
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TaskManager::organiseTasks() {
+    //Loop so long as the Task Manager is running
+    while (mRunning.test_and_set()) {
+        //Lock the data
+        mTaskLock.lock();
+
+        //Loop through all of the workers and check their progress
+        for (unsigned int i = 0; i < mWorkerCount; i++) {
+            //Lock the workers Task
+            if (mWorkers[i].taskLock.try_lock()) {
+
+                //Check if the worker has a task
+                if (mWorkers[i].task) {
+                    //Check if the task is finished
+                    switch (mWorkers[i].task->mStatus) {
+                    case ETaskStatus::Callback_On_Update:
+                        //Add the Task to the on update callback vector
+                        mToCallOnUpdate.push_back(mWorkers[i].task);
+
+                        //Sort the vector based on priority
+                        std::sort(mToCallOnUpdate.begin(), mToCallOnUpdate.end(),
+                            [&](const std::shared_ptr<Asynch_Task_Base>& pFirst, const std::shared_ptr<Asynch_Task_Base>& pSecond) {
+                            return pFirst->mPriority < pSecond->mPriority;
+                        });
+                    case ETaskStatus::Error:
+                    case ETaskStatus::Completed:
+                        //Collect the Tasks processed in the same batch
+                        collectBatch(mWorkers[i]);
+
+                        //Store finished Tasks that need to notify a subsystem
+                        if (mWorkers[i].task->mStatus != ETaskStatus::Callback_On_Update && mWorkers[i].task->mOnFinish)
+                            mFinishedTasks.push_back(mWorkers[i].task);
+
+                        //Clear the Workers Task
+                        mWorkers[i].task = nullptr;
+                        break;
+                    }
+                }
+
+                //Give the Worker the next fire and forget job if it doesn't run after the next Task
+                if (mLightHead && !mWorkers[i].task && !mWorkers[i].light &&
+                    (mUncompletedTasks.empty() || !runsBefore(mUncompletedTasks[0]->mPriority, mLightHead->priority))) {
+                    mWorkers[i].light = mLightHead;
+                    mLightHead = mLightHead->next;
+                    if (!mLightHead) mLightTail = nullptr;
+                }
+
+                //Check if there are any Tasks to handout and Worker isn't busy
+                else if (mUncompletedTasks.size() && !mWorkers[i].task && !mWorkers[i].light) {
+                    //Give the Worker the next Task
+                    mWorkers[i].task = mUncompletedTasks[0];
+
+                    //Clear that task from the uncompleted list
+                    mUncompletedTasks.erase(mUncompletedTasks.begin());
+
+                    //Group the pending Tasks of the same batch kind with the Task
+                    if (mWorkers[i].task->mBatchKind) gatherBatch(*mWorkers[i].task);
+                }
+
+                //Unlock the data
+                mWorkers[i].taskLock.unlock();
+            }
+        }
+
+        //Unlock the data
+        mTaskLock.unlock();
+
+        //Notify the subsystems of the finished Tasks
+        if (mFinishedTasks.size()) raiseFinishHooks(mFinishedTasks);
+
+        //Raise the timers that are due
+        if (mNextTimer.load(std::memory_order_acquire) <= std::chrono::steady_clock::now().time_since_epoch().count())
+            raiseTimers();
+    }
+}
+
+/*
+    TaskManager : raiseTimers - Raise the timers that have reached their due time
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TaskManager::raiseTimers() {
+    //Remove the due timers from the heap
+    mTimerLock.lock();
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    while (mTimers.size() && mTimers.front().due <= now) {
+        std::pop_heap(mTimers.begin(), mTimers.end());
+        if (mTimers.back().retry) mDueRetries.push_back(std::move(mTimers.back().retry));
+        else if (mTimers.back().fire) mDueTimers.push_back(std::move(mTimers.back().fire));
+        mTimers.pop_back();
+    }
+
+    //Update the time of the next timer
+    mNextTimer.store((mTimers.size() ? mTimers.front().due : std::chrono::steady_clock::time_point::max()).time_since_epoch().count(), std::memory_order_release);
+    mTimerLock.unlock();
+
+    //Queue the retried Tasks and raise the timers without the lock so they can start new timers
+    for (auto& task : mDueRetries) queueTask(task);
+    mDueRetries.clear();
+    for (auto& fire : mDueTimers) fire();
+    mDueTimers.clear();
+}
+
+/*
+    TaskManager : lockTask - Lock the values of a Task and flag it as pending processing
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - The Task object that is to be locked
+
+    return bool - Returns true if the Task was in the setup or complete state and has 
+                  been locked
+*/
+bool AsynchTasks::TaskManager::lockTask(Asynch_Task_Base& pTask) {
+    //Ensure that the task is in the setup or complete state
+    switch (pTask.mStatus) {
+    case ETaskStatus::Setup:
+    case ETaskStatus::Completed: break;
+    default: return false;
+    }
+
+    //Lock down the tasks values
+    pTask.mLockValues = true;
+
+    //Reset the number of retries
+    pTask.mRetryCount = 0;
+
+    //Change the state to indicate pending processing
+    pTask.mStatus = ETaskStatus::Pending;
+
+    //Return success
+    return true;
+}
+
+/*
+    TaskManager : queueTask - Add a locked Task to the uncompleted list for the Workers
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pTask - The pending Task object to be added to the list
+*/
+void AsynchTasks::TaskManager::queueTask(const std::shared_ptr<Asynch_Task_Base>& pTask) {
+    //Stamp the time the Task was queued
+    pTask->mQueuedAt = std::chrono::steady_clock::now().time_since_epoch().count();
+    mInstance->mQueued.fetch_add(1, std::memory_order_relaxed);
+
+    //Lock the Task list
+    mInstance->mTaskLock.lock();
+
+    //Insert the task after the Tasks of the same or higher priority, keeping the list sorted
+    //and the Tasks of a priority in the order they were added
+    mInstance->mUncompletedTasks.insert(std::upper_bound(mInstance->mUncompletedTasks.begin(),
+        mInstance->mUncompletedTasks.end(), pTask,
+        [&](const std::shared_ptr<Asynch_Task_Base>& pFirst, const std::shared_ptr<Asynch_Task_Base>& pSecond) {
+        return runsBefore(pFirst->mPriority, pSecond->mPriority);
+    }), pTask);
+
+    //Unlock the task list
+    mInstance->mTaskLock.unlock();
+}
+
+/*
+    TaskManager : releaseTask - Return a locked Task that was never processed to the setup state
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pTask - The Task object that is to be released
+*/
+void AsynchTasks::TaskManager::releaseTask(Asynch_Task_Base& pTask) {
+    //Flag the Task as being setup
+    pTask.mStatus = ETaskStatus::Setup;
+
+    //Allow editing of Task values
+    pTask.mLockValues = false;
+}
+
+/*
+    TaskManager : setPriority - Change the priority of a locked Task that is held by a subsystem
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The Task must not be in the uncompleted list, as the list would no longer be sorted
+
+    param[in/out] pTask - The Task object to modify
+    param[in] pPriority - The new priority of the Task
+*/
+void AsynchTasks::TaskManager::setPriority(Asynch_Task_Base& pTask, ETaskPriority pPriority) {
+    pTask.mPriority = pPriority;
+}
+
+/*
+    TaskManager : setFinishHook - Set the function used to notify a subsystem when a Task
+                                  has finished processing (Completed or Error)
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The hook is raised on the organisation thread (or the thread calling update for Tasks 
+    with callbacks on update) once the Task is no longer held by a Worker, allowing the
+    Task to be queued again from within the hook.
+
+    param[in/out] pTask - The Task object to set the hook on
+    param[in] pHook - The function to raise (nullptr to clear)
+*/
+void AsynchTasks::TaskManager::setFinishHook(Asynch_Task_Base& pTask, const std::function<void()>& pHook) {
+    pTask.mOnFinish = pHook;
+}
+
+/*
+    TaskManager : raiseFinishHooks - Notify the subsystems of a collection of finished Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The Task lock must not be held when raising the hooks
+
+    param[in/out] pTasks - The finished Tasks to notify about. The vector is cleared once raised
+*/
+void AsynchTasks::TaskManager::raiseFinishHooks(taskList& pTasks) {
+    //Loop through the finished Tasks
+    for (size_t i = 0; i < pTasks.size(); i++) {
+        //Copy the hook as it may be modified while raised
+        std::function<void()> hook = pTasks[i]->mOnFinish;
+
+        //Raise the hook
+        if (hook) hook();
+    }
+
+    //Clear the finished Tasks
+    pTasks.clear();
+}
+
+/*
+    TaskManager : queuedAt - Retrieve the time a Task was last added to the uncompleted list
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pTask - The Task object to check
+
+    return long long - Returns the time in steady clock ticks (0 if never queued)
+*/
+long long AsynchTasks::TaskManager::queuedAt(const Asynch_Task_Base& pTask) {
+    return pTask.mQueuedAt;
+}
+
+/*
+    TaskManager : processType - Identify the function processed by a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pTask - The Task object to check
+
+    return const std::type_info& - Returns the type of the process function (void if not set)
+*/
+const std::type_info& AsynchTasks::TaskManager::processType(const Asynch_Task_Base& pTask) {
+    return pTask.processType();
+}
+
+/*
+    TaskManager : takeLightJob - Take a free fire and forget job record, allocating a block of
+                                 records if none are free
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return LightJob* - Returns the record to store a job in
+*/
+AsynchTasks::TaskManager::LightJob* AsynchTasks::TaskManager::takeLightJob() {
+    //Lock the free records
+    std::lock_guard<std::mutex> lock(mInstance->mLightLock);
+
+    //Allocate a block of records when none are free
+    if (!mInstance->mFreeLightJobs) {
+        mInstance->mLightBlocks.reserve(mInstance->mLightBlocks.size() + 1);
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        LightJob* block = (LightJob*)mInstance->mResource->allocate(sizeof(LightJob) * LightJob::BLOCK, alignof(LightJob));
+#else
+        LightJob* block = (LightJob*)::operator new(sizeof(LightJob) * LightJob::BLOCK);
+#endif
+        mInstance->mLightBlocks.push_back(block);
+
+        //Link the records into the free list
+        for (size_t i = 0; i < LightJob::BLOCK; i++)
+            block[i].next = (i + 1 < LightJob::BLOCK ? &block[i + 1] : nullptr);
+        mInstance->mFreeLightJobs = block;
+    }
+
+    //Take the first free record
+    LightJob* job = mInstance->mFreeLightJobs;
+    mInstance->mFreeLightJobs = job->next;
+    return job;
+}
+
+/*
+    TaskManager : queueLightJob - Add a fire and forget job to the queue for the Workers
     Author: Mitchell Croft
-    Created: 16/08/2016
-    Modified: 18/08/2016
+    Created: 18/10/2026
+    Modified: 18/10/2026
 
-    param[in] pWorkers - A constant value for the number of workers that will be used
-                         by the Task Manager
+    Note:
+    The job is placed after the queued jobs of the same or higher priority, which is the end
+    of the queue unless jobs of different priorities are mixed
+
+    param[in] pJob - The job to queue, with its function and priority set
 */
-AsynchTasks::TaskManager::TaskManager(unsigned int pWorkers) :
-    /*----------Workers----------*/
-    mWorkerCount(pWorkers),
-    mWorkers(nullptr),
-    mWorkerInactiveTimeout(2000),
-    mWorkerSleepLength(100),
+void AsynchTasks::TaskManager::queueLightJob(LightJob* pJob) {
+    //Count the queued job
+    mInstance->mQueued.fetch_add(1, std::memory_order_relaxed);
+    pJob->next = nullptr;
+
+    //Lock the Task list
+    std::lock_guard<std::mutex> lock(mInstance->mTaskLock);
+    pJob->id = mInstance->mNextID.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    //Add the first job
+    LightJob*& head = mInstance->mLightHead;
+    LightJob*& tail = mInstance->mLightTail;
+    if (!head) head = tail = pJob;
+
+    //Add to the end of the queue
+    else if (!runsBefore(pJob->priority, tail->priority)) {
+        tail->next = pJob;
+        tail = pJob;
+    }
 
-    /*----------Tasks----------*/
-    mMaxCallbacksOnUpdate(10),
-    mNextID(0)
-{}
+    //Add to the front of the queue
+    else if (runsBefore(pJob->priority, head->priority)) {
+        pJob->next = head;
+        head = pJob;
+    }
+
+    //Insert after the jobs that run before it
+    else {
+        LightJob* previous = head;
+        while (!runsBefore(pJob->priority, previous->next->priority)) previous = previous->next;
+        pJob->next = previous->next;
+        previous->next = pJob;
+    }
+}
 
 /*
-    TaskManager : organiseTasks - Manage the active tasks and close finished jobs
+    TaskManager : recycleJob - Return a fire and forget job record to the free list
     Author: Mitchell Croft
-    Created: 16/08/2016
-    Modified: 10/01/2017
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The function stored in the record must already be destroyed
+
+    param[in] pJob - The record to reuse
 */
-void AsynchTasks::TaskManager::organiseTasks() {
-    //Loop so long as the Task Manager is running
-    while (mRunning.test_and_set()) {
-        //Lock the data
-        mTaskLock.lock();
+void AsynchTasks::TaskManager::recycleJob(LightJob* pJob) {
+    std::lock_guard<std::mutex> lock(mInstance->mLightLock);
+    pJob->next = mInstance->mFreeLightJobs;
+    mInstance->mFreeLightJobs = pJob;
+}
 
-        //Loop through all of the workers and check their progress
-        for (unsigned int i = 0; i < mWorkerCount; i++) {
-            //Lock the workers Task
-            if (mWorkers[i].taskLock.try_lock()) {
+/*
+    TaskManager : discardLightJobs - Destroy the fire and forget jobs that weren't processed and
+                                     release the job records
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
 
-                //Check if the worker has a task
-                if (mWorkers[i].task) {
-                    //Check if the task is finished
-                    switch (mWorkers[i].task->mStatus) {
-                    case ETaskStatus::Callback_On_Update:
-                        //Add the Task to the on update callback vector
-                        mToCallOnUpdate.push_back(mWorkers[i].task);
+    Requires:
+    The organisation thread and Workers must have stopped
+*/
+void AsynchTasks::TaskManager::discardLightJobs() {
+    //Destroy the functions of the queued jobs
+    for (LightJob* job = mLightHead; job; job = job->next)
+        job->handle(*job, false);
+    mLightHead = mLightTail = mFreeLightJobs = nullptr;
+
+    //Release the blocks of records
+    for (LightJob* block : mLightBlocks) {
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        mResource->deallocate(block, sizeof(LightJob) * LightJob::BLOCK, alignof(LightJob));
+#else
+        ::operator delete(block);
+#endif
+    }
+    mLightBlocks.clear();
+}
 
-                        //Sort the vector based on priority
-                        std::sort(mToCallOnUpdate.begin(), mToCallOnUpdate.end(),
-                            [&](const std::shared_ptr<Asynch_Task_Base>& pFirst, const std::shared_ptr<Asynch_Task_Base>& pSecond) {
-                            return pFirst->mPriority < pSecond->mPriority;
-                        });
-                    case ETaskStatus::Error:
-                    case ETaskStatus::Completed:
-                        //Clear the Workers Task
-                        mWorkers[i].task = nullptr;
-                        break;
-                    }
-                }
+/*
+    TaskManager : gatherBatch - Move the pending Tasks of the same batch kind as a Task into its batch
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
 
-                //Check if there are any Tasks to handout and Worker isn't busy
-                if (mUncompletedTasks.size() && !mWorkers[i].task) {
-                    //Give the Worker the next Task
-                    mWorkers[i].task = mUncompletedTasks[0];
+    Requires:
+    The Task lock must be held
 
-                    //Clear that task from the uncompleted list
-                    mUncompletedTasks.erase(mUncompletedTasks.begin());
-                }
+    param[in/out] pTask - The Task given to a Worker
+*/
+void AsynchTasks::TaskManager::gatherBatch(Asynch_Task_Base& pTask) {
+    //Keep the Tasks that aren't grouped in their order
+    auto kept = mUncompletedTasks.begin();
+    auto next = mUncompletedTasks.begin();
+    for (; next != mUncompletedTasks.end() && pTask.mBatch.size() + 1 < pTask.mBatchLimit; ++next) {
+        if ((*next)->mBatchKind == pTask.mBatchKind) pTask.mBatch.push_back(std::move(*next));
+        else {
+            if (kept != next) *kept = std::move(*next);
+            ++kept;
+        }
+    }
 
-                //Unlock the data
-                mWorkers[i].taskLock.unlock();
-            }
+    //Remove the gaps left by the grouped Tasks
+    if (kept != next) mUncompletedTasks.erase(std::move(next, mUncompletedTasks.end(), kept), mUncompletedTasks.end());
+}
+
+/*
+    TaskManager : collectBatch - Handle the Tasks that were processed in the batch of a Worker's Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    The Task lock and the Worker's Task lock must be held
+
+    param[in/out] pWorker - The Worker that processed the batch
+*/
+void AsynchTasks::TaskManager::collectBatch(Worker& pWorker) {
+    //Check if the Task was processed with others
+    std::vector<std::shared_ptr<Asynch_Task_Base>>& batch = pWorker.task->mBatch;
+    if (batch.empty()) return;
+
+    //Handle the grouped Tasks as if they were processed by the Worker
+    bool onUpdate = false;
+    for (auto& task : batch) {
+        //Count the processed Task
+        if (task->mStatus == ETaskStatus::Error) pWorker.failed.fetch_add(1, std::memory_order_relaxed);
+        else pWorker.completed.fetch_add(1, std::memory_order_relaxed);
+
+        //Store the Tasks with callbacks on update or finish hooks
+        if (task->mStatus == ETaskStatus::Callback_On_Update) {
+            mToCallOnUpdate.push_back(task);
+            onUpdate = true;
+        } else if (task->mOnFinish) mFinishedTasks.push_back(task);
+    }
+    batch.clear();
+
+    //Sort the on update callbacks based on priority
+    if (onUpdate) {
+        std::sort(mToCallOnUpdate.begin(), mToCallOnUpdate.end(),
+            [&](const std::shared_ptr<Asynch_Task_Base>& pFirst, const std::shared_ptr<Asynch_Task_Base>& pSecond) {
+            return pFirst->mPriority < pSecond->mPriority;
+        });
+    }
+}
+
+/*
+    TaskManager : runScoped - Take the most recently queued pending Task of a scope and process
+                              it on the calling thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Used by a scope to help process its Tasks while it waits for them, so it never waits on
+    Tasks that no Worker is free to process. The Task is counted in the metrics and reported
+    to the processed hook as it would be by a Worker. Scoped Tasks give their errors to the
+    scope before they are flagged on the Task
+
+    param[in] pScope - The scope to process a Task of
+
+    return bool - Returns true if a Task was processed
+*/
+bool AsynchTasks::TaskManager::runScoped(const TaskScope* pScope) {
+    //Ensure the Task Manager exists
+    if (!mInstance) return false;
+
+    //Take the last Task of the scope from the uncompleted list
+    std::shared_ptr<Asynch_Task_Base> task;
+    mInstance->mTaskLock.lock();
+    for (size_t i = mInstance->mUncompletedTasks.size(); i-- > 0;) {
+        if (mInstance->mUncompletedTasks[i]->mScope == pScope) {
+            task = std::move(mInstance->mUncompletedTasks[i]);
+            mInstance->mUncompletedTasks.erase(mInstance->mUncompletedTasks.begin() + i);
+            break;
         }
+    }
+    mInstance->mTaskLock.unlock();
+    if (!task) return false;
+
+    //Process the Task
+    const long long started = std::chrono::steady_clock::now().time_since_epoch().count();
+    bool failed = false;
+    try {
+        task->mStatus = ETaskStatus::In_Progress;
+        task->completeProcess();
+        task->mStatus = ETaskStatus::Completed;
+        task->cleanupData();
+    } catch (const std::exception& pExc) {
+        task->mErrorMsg = pExc.what();
+        task->mStatus = ETaskStatus::Error;
+        failed = true;
+    } catch (const std::string& pExc) {
+        task->mErrorMsg = pExc;
+        task->mStatus = ETaskStatus::Error;
+        failed = true;
+    } catch (...) {
+        task->mErrorMsg = "An unknown error occurred while executing the Task. Error thrown did not provide any information as to the cause\n";
+        task->mStatus = ETaskStatus::Error;
+        failed = true;
+    }
+    task->mLockValues = false;
 
-        //Unlock the data
-        mTaskLock.unlock();
+    //Report and count the processed Task
+    reportProcessed(*task, started, failed);
+    (failed ? mInstance->mHelpedFailed : mInstance->mHelpedCompleted).fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/*
+    TaskManager : reportProcessed - Raise the processed hook for the first attempt of a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Retries of a Task aren't reported, so traces record the Task once
+
+    param[in] pTask - The Task that was processed
+    param[in] pStarted - The time (in steady clock ticks) the Task started processing
+    param[in] pFailed - Flags if the process or callback of the Task threw
+*/
+void AsynchTasks::TaskManager::reportProcessed(const Asynch_Task_Base& pTask, long long pStarted, bool pFailed) {
+    processedHook hook = mInstance->mProcessedHook.load(std::memory_order_relaxed);
+    if (hook && !pTask.mRetryCount)
+        hook(pTask, pStarted, std::chrono::steady_clock::now().time_since_epoch().count(), pFailed);
+}
+
+/*
+    TaskManager : setProcessedHook - Set the function raised by the Workers once each Task has been processed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The hook is raised on the Worker threads for the first attempt of each Task, so it must
+    be quick and thread safe. Retries are not reported
+
+    param[in] pHook - The function to raise (nullptr to clear)
+*/
+void AsynchTasks::TaskManager::setProcessedHook(processedHook pHook) {
+    mInstance->mProcessedHook.store(pHook);
+}
+
+/*
+    TaskManager : startTimer - Raise a function on the organisation thread at a point in time
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The organisation thread checks the timers every time it passes over the Workers, so timers
+    are raised very shortly after they are due. Functions should be short as Tasks are not
+    handed out while they run
+
+    param[in] pDue - The time to raise the function at
+    param[in] pFire - The function to raise
+    param[in] pCancel - The function to raise instead if the Task Manager is destroyed before
+                        the timer is due (Default nullptr)
+
+    return timerID - Returns the ID used to stop the timer
+*/
+AsynchTasks::timerID AsynchTasks::TaskManager::startTimer(const std::chrono::steady_clock::time_point& pDue, std::function<void()> pFire, std::function<void()> pCancel) {
+    //Lock the timers
+    std::lock_guard<std::mutex> guard(mInstance->mTimerLock);
+
+    //Add the timer to the heap
+    const timerID id = mInstance->mNextTimerID++;
+    mInstance->mTimers.push_back({ pDue, id, std::move(pFire), std::move(pCancel), nullptr });
+    std::push_heap(mInstance->mTimers.begin(), mInstance->mTimers.end());
+
+    //Update the time of the next timer
+    mInstance->mNextTimer.store(mInstance->mTimers.front().due.time_since_epoch().count(), std::memory_order_release);
+    return id;
+}
+
+/*
+    TaskManager : stopTimer - Stop a timer from being raised
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Has no effect if the timer has already been raised
+
+    param[in] pTimer - The ID of the timer to stop
+*/
+
+void AsynchTasks::TaskManager::stopTimer(timerID pTimer) {
+    //Lock the timers
+    std::lock_guard<std::mutex> guard(mInstance->mTimerLock);
+
+    //Clear the functions of the timer, it is removed from the heap when due
+    for (auto& timer : mInstance->mTimers) {
+        if (timer.id == pTimer) {
+            timer.fire = nullptr;
+            timer.cancel = nullptr;
+            timer.retry = nullptr;
+            break;
+        }
+    }
+}
+
+/*
+    TaskManager : retryTask - Queue a Task whose process failed again if its retry policy allows
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Called by the Workers when the process of a Task throws. The Task stays Pending and is
+    added back to the uncompleted list by a timer once the backoff delay has passed, reusing
+    the same Task object. If the Task Manager is destroyed first the Task is flagged with an
+    error (its callback is not raised)
+
+    param[in/out] pTask - The Task that failed. Cleared if the Task is to be retried
+    param[in] pError - The error that was thrown by the process
+
+    return bool - Returns true if the Task will be retried
+*/
+bool AsynchTasks::TaskManager::retryTask(std::shared_ptr<Asynch_Task_Base>& pTask, const std::exception_ptr& pError) {
+    //Get the policy of the Task
+    const RetryPolicy& policy = pTask->mRetryPolicy;
+
+    //Check if retrying is enabled
+    if (policy.maxAttempts <= 1) return false;
+
+    //Check the error can be retried
+    if (policy.retryable) {
+        try { if (!policy.retryable(pError)) return false; }
+        catch (...) { return false; }
+    }
+
+    //Check if the Task has attempts remaining
+    if (pTask->mRetryCount + 1 >= policy.maxAttempts) {
+        ++mInstance->mRetriesExhausted;
+        return false;
+    }
+
+    //Count the retry
+    const std::chrono::milliseconds delay = policy.delay(++pTask->mRetryCount);
+    ++mInstance->mRetries;
+
+    //Flag the Task as waiting to be processed
+    pTask->mStatus = ETaskStatus::Pending;
+
+    //Take the Task from the Worker and queue it once the delay has passed
+    startRetry(std::chrono::steady_clock::now() + delay, std::move(pTask));
+    return true;
+}
+
+/*
+    TaskManager : startRetry - Queue a retried Task on the organisation thread at a point in time
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The Task is held by the timer itself rather than captured by functions, so a retry doesn't
+    allocate once the heap has grown. If the Task Manager is destroyed first the Task is failed
+
+    param[in] pDue - The time to queue the Task at
+    param[in] pTask - The pending Task to queue
+*/
+void AsynchTasks::TaskManager::startRetry(const std::chrono::steady_clock::time_point& pDue, std::shared_ptr<Asynch_Task_Base> pTask) {
+    //Lock the timers
+    std::lock_guard<std::mutex> guard(mInstance->mTimerLock);
+
+    //Add the timer to the heap
+    mInstance->mTimers.push_back({ pDue, mInstance->mNextTimerID++, nullptr, nullptr, std::move(pTask) });
+    std::push_heap(mInstance->mTimers.begin(), mInstance->mTimers.end());
+
+    //Update the time of the next timer
+    mInstance->mNextTimer.store(mInstance->mTimers.front().due.time_since_epoch().count(), std::memory_order_release);
+}
+
+/*
+    TaskManager : metrics - Retrieve the current counters of the Task Manager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return TaskMetrics - Returns a copy of the counters
+*/
+AsynchTasks::TaskMetrics AsynchTasks::TaskManager::metrics() {
+    //Check the Task Manager exists
+    if (!mInstance) return TaskMetrics();
+
+    //Copy the counters
+    TaskMetrics metrics;
+    metrics.tasksQueued = mInstance->mQueued.load();
+    metrics.tasksCompleted = mInstance->mHelpedCompleted.load(std::memory_order_relaxed);
+    metrics.tasksFailed = mInstance->mHelpedFailed.load(std::memory_order_relaxed);
+    for (unsigned int i = 0; i < mInstance->mWorkerCount; i++) {
+        metrics.tasksCompleted += mInstance->mWorkers[i].completed.load(std::memory_order_relaxed);
+        metrics.tasksFailed += mInstance->mWorkers[i].failed.load(std::memory_order_relaxed);
     }
+    metrics.retries = mInstance->mRetries.load();
+    metrics.retriesExhausted = mInstance->mRetriesExhausted.load();
+    return metrics;
 }
 
 /*
     TaskManager : create - Initialise and setup the task manager
     Author: Mitchell Croft
     Created: 16/08/2016
-    Modified: 16/08/2016
+    Modified: 18/10/2026
 
     param[in] pWorkers - The number of workers that the Task Manager is to create and use
                          (Default 5)
 
     return bool - Returns true if the TaskManager was created successfully
 */
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+bool AsynchTasks::TaskManager::create(unsigned int pWorkers) {
+    //Allocate from the default memory resource
+    return create(pWorkers, std::pmr::get_default_resource());
+}
+
+/*
+    TaskManager : create - Initialise and setup the task manager, allocating the Task lists and
+                           fire and forget jobs from a memory resource
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The resource is used from multiple threads so must be thread safe, and should reuse freed
+    memory as the lists grow and shrink for as long as the Task Manager exists (E.g.
+    std::pmr::synchronized_pool_resource)
+
+    Requires:
+    The resource must outlive the Task Manager
+
+    param[in] pWorkers - The number of workers that the Task Manager is to create and use
+    param[in] pResource - The memory resource to allocate from
+
+    return bool - Returns true if the TaskManager was created successfully
+*/
+bool AsynchTasks::TaskManager::create(unsigned int pWorkers, std::pmr::memory_resource* pResource) {
+#else
 bool AsynchTasks::TaskManager::create(unsigned int pWorkers) {
+#endif
     //Assert that the Task Manager doesn't already exist
     assert(!mInstance);
 
@@ -806,7 +2603,11 @@ bool AsynchTasks::TaskManager::create(unsigned int pWorkers) {
     assert(pWorkers);
 
     //Create the new Task Manager
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+    mInstance = new TaskManager(pWorkers, pResource);
+#else
     mInstance = new TaskManager(pWorkers);
+#endif
 
     //Test to ensure the instance were created
     if (!mInstance) {
@@ -845,22 +2646,47 @@ bool AsynchTasks::TaskManager::create(unsigned int pWorkers) {
 
     Author: Mitchell Croft
     Created: 18/08/2016
-    Modified: 10/01/2017
+    Modified: 18/10/2026
 */
 void AsynchTasks::TaskManager::update() {
+    //Store the finished Tasks that need to notify a subsystem
+    taskList finished(mInstance->mFinishedTasks.get_allocator());
+
     //Lock the Tasks
     mInstance->mTaskLock.lock();
 
     //Check if there are any Tasks to complete
     if (mInstance->mToCallOnUpdate.size()) {
-        //Loop through the Tasks that need executing
-        for (int i = (int)mInstance->mToCallOnUpdate.size() - 1, count = 0;
-             i >= 0 && (unsigned int)count < mInstance->mMaxCallbacksOnUpdate; 
-             i--, count++) {
+        //Find the Tasks that can have their callbacks executed, taken from the back of the list
+        const size_t first = mInstance->mToCallOnUpdate.size() - std::min((size_t)mInstance->mMaxCallbacksOnUpdate, mInstance->mToCallOnUpdate.size());
 
+        //Loop through the Tasks that need executing
+        for (size_t i = mInstance->mToCallOnUpdate.size(); i-- > first;) {
             //Get a reference to the task
             std::shared_ptr<Asynch_Task_Base>& task = mInstance->mToCallOnUpdate[i];
 
+            //Skip Tasks that were delivered with a batch
+            if (!task) continue;
+
+            //Deliver the Tasks of the same batch kind in one call
+            if (task->mBatchKind && task->hasBatchCallback()) {
+                //Take the Tasks of the kind, in the order their callbacks would be executed
+                const void* kind = task->mBatchKind;
+                std::vector<std::shared_ptr<Asynch_Task_Base>> batch;
+                for (size_t j = i + 1; j-- > first;) {
+                    if (mInstance->mToCallOnUpdate[j] && mInstance->mToCallOnUpdate[j]->mBatchKind == kind)
+                        batch.push_back(std::move(mInstance->mToCallOnUpdate[j]));
+                }
+
+                //Deliver the results
+                batch.front()->completeBatchCallback(batch);
+
+                //Store the Tasks that need to notify a subsystem
+                for (auto& delivered : batch)
+                    if (delivered->mOnFinish) finished.push_back(delivered);
+                continue;
+            }
+
             //Try to execute the Task 
             try {
                 //Run the callback process
@@ -906,20 +2732,26 @@ void AsynchTasks::TaskManager::update() {
             //Clear Task's allocated memory
             task->cleanupData();
 
-            //Remove the task from the list
-            mInstance->mToCallOnUpdate.erase(mInstance->mToCallOnUpdate.begin() + i);
+            //Store the Task if it needs to notify a subsystem
+            if (task->mOnFinish) finished.push_back(task);
         }
+
+        //Remove the Tasks from the list
+        mInstance->mToCallOnUpdate.erase(mInstance->mToCallOnUpdate.begin() + first, mInstance->mToCallOnUpdate.end());
     }
 
     //Unlock the Tasks
     mInstance->mTaskLock.unlock();
+
+    //Notify the subsystems of the finished Tasks
+    if (finished.size()) raiseFinishHooks(finished);
 }
 
 /*
     TaskManager : destroy - Close all threads and delete the TaskManager
     Author: Mitchell Croft
     Created: 16/08/2016
-    Modified: 18/08/2016
+    Modified: 18/10/2026
 */
 void AsynchTasks::TaskManager::destroy() {
     //Test if the singleton instance was created
@@ -935,6 +2767,20 @@ void AsynchTasks::TaskManager::destroy() {
         if (mInstance->mWorkers)
             delete[] mInstance->mWorkers;
 
+        //Release the fire and forget jobs
+        mInstance->discardLightJobs();
+
+        //Raise the cancel functions of the timers that are still due, failing the Tasks waiting to be retried
+        for (Timer& timer : mInstance->mTimers) {
+            if (timer.retry) {
+                timer.retry->mErrorMsg = "The Task Manager was destroyed before the Task was retried";
+                timer.retry->mStatus = ETaskStatus::Error;
+                timer.retry->mLockValues = false;
+            }
+            else if (timer.fire && timer.cancel) timer.cancel();
+        }
+        mInstance->mTimers.clear();
+
         //Delete the singleton instance
         delete mInstance;
         mInstance = nullptr;
@@ -955,21 +2801,113 @@ AsynchTasks::Asynch_Task_Base::Asynch_Task_Base() :
     mPriority(AsynchTasks::Low_Priority),
     mCallbackOnUpdate(false),
     mLockValues(false),
+    mRetryCount(0),
+    mQueuedAt(0),
+    mBatchKind(nullptr),
+    mBatchLimit(1),
+    mScope(nullptr),
     id(mID),
     status(mStatus),
     priority(mPriority, mLockValues, [this]() { mStatus = ETaskStatus::Setup; mErrorMsg = ""; }),
     callbackOnUpdate(mCallbackOnUpdate, mLockValues, [this]() { mStatus = ETaskStatus::Setup; mErrorMsg = ""; }),
-    error(mErrorMsg)
+    error(mErrorMsg),
+    retryPolicy(mRetryPolicy, mLockValues, [this]() { mStatus = ETaskStatus::Setup; mErrorMsg = ""; }),
+    retries(mRetryCount)
 {}
 #pragma endregion
 
+#pragma region Retry Policy Function Definitions
+/*
+    RetryPolicy : delay - Calculate the delay before a retry of a Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pRetry - The number of the retry (starting at 1)
+
+    return std::chrono::milliseconds - Returns the backoff delay with the jitter applied
+*/
+std::chrono::milliseconds AsynchTasks::RetryPolicy::delay(unsigned int pRetry) const {
+    //Store a generator for the jitter on each thread
+    thread_local std::minstd_rand generator((unsigned int)std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    //Grow the delay exponentially up to the maximum
+    double length = (double)baseDelay.count() * std::pow(multiplier, (double)(pRetry - 1));
+    length = std::min(length, (double)maxDelay.count());
+
+    //Remove a random portion of the delay
+    const double spread = std::max(0.0, std::min(jitter, 1.0));
+    length -= length * spread * std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+    return std::chrono::milliseconds((long long)length);
+}
+#pragma endregion
+
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+#pragma region Locked Resource Function Definitions
+/*
+    LockedResource : Constructor - Wrap a memory resource
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pUpstream - The resource to allocate from
+*/
+AsynchTasks::LockedResource::LockedResource(std::pmr::memory_resource* pUpstream) : mUpstream(pUpstream) {}
+
+/*
+    LockedResource : do_allocate - Allocate memory from the upstream resource
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pBytes - The number of bytes to allocate
+    param[in] pAlignment - The alignment of the memory
+
+    return void* - Returns the allocated memory
+*/
+void* AsynchTasks::LockedResource::do_allocate(size_t pBytes, size_t pAlignment) {
+    std::lock_guard<std::mutex> guard(mLock);
+    return mUpstream->allocate(pBytes, pAlignment);
+}
+
+/*
+    LockedResource : do_deallocate - Return memory to the upstream resource
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pMemory - The memory to return
+    param[in] pBytes - The number of bytes that were allocated
+    param[in] pAlignment - The alignment of the memory
+*/
+void AsynchTasks::LockedResource::do_deallocate(void* pMemory, size_t pBytes, size_t pAlignment) {
+    std::lock_guard<std::mutex> guard(mLock);
+    mUpstream->deallocate(pMemory, pBytes, pAlignment);
+}
+
+/*
+    LockedResource : do_is_equal - Determine if memory from another resource can be returned to this one
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pOther - The resource to compare against
+
+    return bool - Returns true if the resources are the same object
+*/
+bool AsynchTasks::LockedResource::do_is_equal(const std::pmr::memory_resource& pOther) const noexcept {
+    return this == &pOther;
+}
+#pragma endregion
+#endif
+
 #pragma region Worker Object Function Definitions
 /*
     TaskManager::Worker : doWork - Complete the Task objects assigned by the 
                                    Task Manager
     Author: Mitchell Croft
     Created: 18/08/2016
-    Modified: 19/08/2016
+    Modified: 18/10/2026
 */
 void AsynchTasks::TaskManager::Worker::doWork() {
     //Track the period in time where the Worker will sleep
@@ -980,6 +2918,32 @@ void AsynchTasks::TaskManager::Worker::doWork() {
         //Lock the Task
         taskLock.lock();
 
+        //Process a fire and forget job
+        if (light) {
+            //Set the new sleep time
+            workerSleepPoint = std::chrono::system_clock::now() + std::chrono::milliseconds(mInactiveTimeout);
+
+            //Publish the job being processed
+            activePriority.store(light->priority, std::memory_order_relaxed);
+            activeSince.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+            activeID.store(light->id, std::memory_order_release);
+
+            //Process the job, discarding its errors
+            bool threw = false;
+            try { light->handle(*light, true); }
+            catch (...) { threw = true; }
+
+            //Count the processed job and return the record
+            (threw ? failed : completed).fetch_add(1, std::memory_order_relaxed);
+            activeID.store(0, std::memory_order_release);
+            TaskManager::recycleJob(light);
+            light = nullptr;
+
+            //Unlock the Task
+            taskLock.unlock();
+            continue;
+        }
+
         //Check if there is a job to do
         if (!task || (task && task->mStatus != ETaskStatus::Pending)) {
             //Get the current time 
@@ -989,6 +2953,7 @@ void AsynchTasks::TaskManager::Worker::doWork() {
             auto difference = std::chrono::duration_cast<std::chrono::milliseconds>(workerSleepPoint - currentTime);
 
             //Check to see if the Worker is still awake
+            sleeping.store(difference.count() <= 0, std::memory_order_relaxed);
             if (difference.count() > 0) {
                 //Unlock the Task
                 taskLock.unlock();
@@ -1013,6 +2978,16 @@ void AsynchTasks::TaskManager::Worker::doWork() {
         //Set the new sleep time
         workerSleepPoint = std::chrono::system_clock::now() + std::chrono::milliseconds(mInactiveTimeout);
 
+        //Store the error thrown by the Task and if it was thrown by the process
+        std::exception_ptr failure;
+        std::string message;
+        bool processing = true;
+
+        //Publish the Task being processed
+        activePriority.store(task->mPriority, std::memory_order_relaxed);
+        activeSince.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        activeID.store(task->mID, std::memory_order_release);
+
         //Try to execute the Task 
         try {
             //Update the tasks current state
@@ -1020,6 +2995,7 @@ void AsynchTasks::TaskManager::Worker::doWork() {
 
             //Run the process
             task->completeProcess();
+            processing = false;
 
             //Check if the callback doesn't need to be run on main
             if (!task->mCallbackOnUpdate) {
@@ -1040,28 +3016,25 @@ void AsynchTasks::TaskManager::Worker::doWork() {
             else task->mStatus = ETaskStatus::Callback_On_Update;
         } 
         
-        //If an error occurs, store the error message inside of the Task
+        //If an error occurs, store the error and its message
         catch (const std::exception& pExc) {
-            //Store the message
-            task->mErrorMsg = pExc.what();
-
-            //Flag the Task with an error flag
-            task->mStatus = ETaskStatus::Error;
-
-            //Allow editing of Task values
-            task->mLockValues = false;
+            failure = std::current_exception();
+            message = pExc.what();
         } catch (const std::string& pExc) {
-            //Store the message
-            task->mErrorMsg = pExc;
+            failure = std::current_exception();
+            message = pExc;
+        } catch (...) {
+            failure = std::current_exception();
+            message = "An unknown error occurred while executing the Task. Error thrown did not provide any information as to the cause\n";
+        }
 
-            //Flag the Task with an error flag
-            task->mStatus = ETaskStatus::Error;
+        //Report the first attempt of the Task if it is being traced
+        TaskManager::reportProcessed(*task, activeSince.load(std::memory_order_relaxed), (bool)failure);
 
-            //Allow editing of Task values
-            task->mLockValues = false;
-        } catch (...) {
-            //Store generic message
-            task->mErrorMsg = "An unknown error occurred while executing the Task. Error thrown did not provide any information as to the cause\n";
+        //Check if the Task failed and won't be retried
+        if (failure && !(processing && task->mBatch.empty() && TaskManager::retryTask(task, failure))) {
+            //Store the message
+            task->mErrorMsg = std::move(message);
 
             //Flag the Task with an error flag
             task->mStatus = ETaskStatus::Error;
@@ -1070,6 +3043,11 @@ void AsynchTasks::TaskManager::Worker::doWork() {
             task->mLockValues = false;
         }
 
+        //Count the processed Task
+        if (!failure) completed.fetch_add(1, std::memory_order_relaxed);
+        else if (task) failed.fetch_add(1, std::memory_order_relaxed);
+        activeID.store(0, std::memory_order_release);
+
         //Unlock the Task
         taskLock.unlock();
     }
@@ -1080,12 +3058,19 @@ void AsynchTasks::TaskManager::Worker::doWork() {
                                         the Worker thread
     Author: Mitchell Croft
     Created: 18/08/2016
-    Modified: 18/08/2016
+    Modified: 18/10/2026
 */
 inline AsynchTasks::TaskManager::Worker::Worker() :
     mInactiveTimeout(AsynchTasks::TaskManager::mInstance->mWorkerInactiveTimeout),
     mSleepLength(AsynchTasks::TaskManager::mInstance->mWorkerSleepLength),
-    task(nullptr) {
+    task(nullptr),
+    light(nullptr),
+    activeID(0),
+    activePriority(0),
+    activeSince(0),
+    sleeping(false),
+    completed(0),
+    failed(0) {
     mProcessingThread = std::thread([&]() {
         //Set the running flag
         mRunning.test_and_set();
@@ -1108,6 +3093,12 @@ inline AsynchTasks::TaskManager::Worker::~Worker() {
     //Join the worker thread
     if (this->mProcessingThread.get_id() != std::thread::id())
         mProcessingThread.join();
+
+    //Destroy a fire and forget job that was given to the Worker but not processed
+    if (light) {
+        light->handle(*light, false);
+        TaskManager::recycleJob(light);
+    }
 }
 #pragma endregion
 #endif
\ No newline at end of file
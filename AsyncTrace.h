@@ -0,0 +1,783 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncSimulation.h"
+
+#include <unordered_map>
+#include <typeindex>
+#include <memory>
+#include <condition_variable>
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a recorder of the Tasks
+ *      arriving at a live TaskManager, and a replayer that re-drives the
+ *      recorded arrivals so scheduler changes can be evaluated offline
+ *      against real traffic.
+**/
+namespace AsynchTasks {
+    #pragma region Task Trace Decleration
+    //! Label the tags of the records in a trace file, events carry the callback and failure flags
+    enum ETraceTag : unsigned char {
+        Trace_Kind = 1,
+        Trace_Event = 2,
+        Trace_Callback_On_Update = 4,
+        Trace_Failed = 8
+    };
+
+    /*
+     *      Name: TraceEvent
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a single Task arrival read from a trace
+    **/
+    struct TraceEvent {
+        //! Store the time the Task arrived (in seconds from the start of the recording)
+        double arrival;
+
+        //! Store the time taken to process the Task, including a callback run on the Worker (in seconds)
+        double runTime;
+
+        //! Store the index of the kind of the Task in the trace's kinds
+        unsigned int kind;
+
+        //! Store the priority of the Task
+        ETaskPriority priority;
+
+        //! Flag if the callback was called on update and if the process failed
+        bool callbackOnUpdate;
+        bool failed;
+    };
+
+    /*
+     *      Name: TaskTrace
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the kinds and arrivals of a trace, ordered by arrival
+    **/
+    struct TaskTrace {
+        //! Store the names of the kinds of Task (the type of the process function)
+        std::vector<std::string> kinds;
+
+        //! Store the arrivals in the order they arrived
+        std::vector<TraceEvent> events;
+    };
+    #pragma endregion
+
+    #pragma region Trace Recorder Decleration
+    /*
+     *      Name: TraceRecorder
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Record the Tasks processed by the TaskManager to a compact binary
+     *      trace. Each Worker reports the first attempt of every Task once it
+     *      has been processed into a buffer of its own, so reporting Workers
+     *      don't contend with each other, and a writer thread merges the
+     *      buffers into the file. Reports beyond the limit of a buffer are
+     *      dropped (and counted) until the writer next empties it.
+     *
+     *      The trace starts with the magic "ATRC" and a version, followed by
+     *      records tagged with a byte. Kind records give the name of the next
+     *      kind, event records store the arrival (the change from the previous
+     *      event), kind, priority and run time as variable length integers,
+     *      with the callback mode and failure in the tag. Times are in
+     *      nanoseconds.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      TraceRecorder. Only one TraceRecorder can observe the TaskManager.
+    **/
+    class TraceRecorder {
+        //! Prototype the internal report and buffer objects
+        struct Report;
+        struct Buffer;
+
+        /*----------Singleton Values----------*/
+        static TraceRecorder* mInstance;
+
+        //! Create a lock to prevent the Workers using the instance while it is destroyed
+        static std::mutex mInstanceLock;
+
+        TraceRecorder(FILE* pFile, unsigned int pFlushInterval, size_t pBufferLimit);
+        ~TraceRecorder() = default;
+
+        TraceRecorder() = delete;
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        /*----------Variables----------*/
+        //! Store the trace file
+        FILE* mFile;
+
+        //! Keep as a constant the number of milliseconds between writes
+        const unsigned int mFlushInterval;
+
+        //! Keep as a constant the number of reports each thread can buffer between writes
+        const size_t mBufferLimit;
+
+        //! Store the time the recording started (in steady clock ticks)
+        const long long mStart;
+
+        //! Store the index of each kind written to the file (only used by the writer thread)
+        std::unordered_map<std::type_index, unsigned int> mKindIndex;
+
+        //! Store the buffers of the threads that have reported Tasks
+        std::vector<std::shared_ptr<Buffer>> mBuffers;
+
+        //! Store the arrival of the last event written, as events are stored as the change
+        long long mLastArrival;
+
+        //! Count the events written and the reports dropped as their buffer was full
+        unsigned long long mRecorded;
+        unsigned long long mDropped;
+
+        //! Flag if the recorder is operating
+        bool mRunning;
+
+        //! Signal the writer thread
+        std::condition_variable mWriteCondition;
+
+        //! Maintain the thread that writes the reports
+        std::thread mWriteThread;
+
+        /*----------Functions----------*/
+        //! Function run on the writer thread to write the reports
+        void runWrites();
+
+        //! Encode and write a set of reports
+        void write(const std::vector<Report>& pReports);
+
+        //! Function raised by the Workers once a Task has been processed
+        static void onProcessed(const Asynch_Task_Base& pTask, long long pStarted, long long pFinished, bool pFailed);
+
+        //! Retrieve the buffer of the calling thread, registering one if needed
+        static std::shared_ptr<Buffer> registerBuffer();
+
+        //! Append a variable length integer to a buffer
+        static void writeVarint(std::string& pBuffer, unsigned long long pValue);
+
+    public:
+        //! Main operation functionality
+        static bool create(const std::string& pPath, unsigned int pFlushInterval = 100u, size_t pBufferLimit = 65536u);
+        static void destroy();
+
+        /*----------Getters----------*/
+        static unsigned long long recorded();
+        static unsigned long long dropped();
+    };
+    #pragma endregion
+
+    #pragma region Trace Replayer Decleration
+    /*
+     *      Name: TraceReplayer
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Read traces written by the TraceRecorder and re-drive their
+     *      arrivals through the TaskManager. Each replayed Task uses the
+     *      processor for the recorded run time, keeping its priority,
+     *      callback mode and failure, so the behaviour of the scheduler can
+     *      be measured against the recorded traffic.
+    **/
+    class TraceReplayer {
+        //! Read a variable length integer from a buffer
+        static bool readVarint(const char*& pCurrent, const char* pEnd, unsigned long long& pValue);
+
+    public:
+        //! Prevent construction, the replayer is used through static functions
+        TraceReplayer() = delete;
+
+        //! Read a trace from a file
+        static bool load(const std::string& pPath, TaskTrace& pTrace);
+
+        //! Replay a trace on the TaskManager and measure its behaviour
+        static SimulationReport replay(const TaskTrace& pTrace, double pSpeed = 1.0);
+    };
+    #pragma endregion
+
+    #pragma region Report Definition
+    /*
+     *      Name: Report
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a processed Task waiting to be written to the trace
+    **/
+    struct TraceRecorder::Report {
+        //! Store the time the Task arrived and the time taken to process it (in steady clock ticks)
+        long long arrival;
+        long long runTime;
+
+        //! Store the kind of the Task (the type of its process function)
+        const std::type_info* kind;
+
+        //! Store the priority of the Task
+        ETaskPriority priority;
+
+        //! Flag if the callback is called on update and if the process failed
+        bool callbackOnUpdate;
+        bool failed;
+    };
+
+    /*
+     *      Name: Buffer
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the reports of a single thread until the writer takes them.
+     *      The lock is only shared with the writer thread
+    **/
+    struct TraceRecorder::Buffer {
+        //! Create a lock to prevent clashes with the writer thread
+        std::mutex lock;
+
+        //! Flag if the recorder still accepts reports from the buffer
+        bool open = true;
+
+        //! Keep the values of the recorder needed to report a Task
+        long long start = 0;
+        size_t limit = 0;
+
+        //! Store the reports waiting to be written
+        std::vector<Report> reports;
+
+        //! Count the reports dropped since the last write
+        unsigned long long dropped = 0;
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+#pragma region Trace Recorder Function Definitions
+//! Define static singleton instance
+AsynchTasks::TraceRecorder* AsynchTasks::TraceRecorder::mInstance = nullptr;
+std::mutex AsynchTasks::TraceRecorder::mInstanceLock;
+
+/*
+    TraceRecorder : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFile - The opened trace file
+    param[in] pFlushInterval - The number of milliseconds between writes
+    param[in] pBufferLimit - The number of reports each thread can buffer between writes
+*/
+AsynchTasks::TraceRecorder::TraceRecorder(FILE* pFile, unsigned int pFlushInterval, size_t pBufferLimit) :
+    mFile(pFile),
+    mFlushInterval(pFlushInterval),
+    mBufferLimit(pBufferLimit),
+    mStart(std::chrono::steady_clock::now().time_since_epoch().count()),
+    mLastArrival(0),
+    mRecorded(0),
+    mDropped(0),
+    mRunning(true)
+{}
+
+/*
+    TraceRecorder : runWrites - Write the buffered reports until the recorder is destroyed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TraceRecorder::runWrites() {
+    //Store the buffers and the reports being written
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    std::vector<Report> reports;
+    unsigned long long dropped = 0;
+
+    //Loop until stopped, writing what remains
+    std::unique_lock<std::mutex> lock(mInstanceLock);
+    while (true) {
+        //Wait for the next write
+        const bool running = mRunning;
+        if (running) mWriteCondition.wait_for(lock, std::chrono::milliseconds(mFlushInterval));
+
+        //Release the buffers of threads that have exited and take a copy of the rest
+        mBuffers.erase(std::remove_if(mBuffers.begin(), mBuffers.end(), [](const std::shared_ptr<Buffer>& pBuffer) {
+            std::lock_guard<std::mutex> guard(pBuffer->lock);
+            return pBuffer.use_count() == 1 && pBuffer->reports.empty();
+        }), mBuffers.end());
+        buffers = mBuffers;
+        lock.unlock();
+
+        //Merge the reports of each thread, closing the buffers once stopped
+        for (auto& buffer : buffers) {
+            std::lock_guard<std::mutex> guard(buffer->lock);
+            reports.insert(reports.end(), buffer->reports.begin(), buffer->reports.end());
+            buffer->reports.clear();
+            dropped += buffer->dropped;
+            buffer->dropped = 0;
+            if (!running) buffer->open = false;
+        }
+        buffers.clear();
+
+        //Write the reports
+        write(reports);
+        lock.lock();
+
+        //Count the written and dropped reports
+        mRecorded += reports.size();
+        mDropped += dropped;
+        reports.clear();
+        dropped = 0;
+
+        //Stop once the last reports are written
+        if (!running) break;
+    }
+}
+
+/*
+    TraceRecorder : write - Encode a set of reports and append them to the trace
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Requires:
+    Only called from the writer thread
+
+    param[in] pReports - The reports to write
+*/
+void AsynchTasks::TraceRecorder::write(const std::vector<Report>& pReports) {
+    //Store the encoded records
+    std::string buffer;
+
+    //Write the events
+    for (auto& report : pReports) {
+        //Find the index of the kind, writing the kind before the first event that uses it
+        auto kind = mKindIndex.find(std::type_index(*report.kind));
+        if (kind == mKindIndex.end()) {
+            kind = mKindIndex.insert({ std::type_index(*report.kind), (unsigned int)mKindIndex.size() }).first;
+            const char* name = report.kind->name();
+            buffer += (char)Trace_Kind;
+            writeVarint(buffer, strlen(name));
+            buffer += name;
+        }
+
+        //Store the tag with the callback mode and failure
+        buffer += (char)(Trace_Event | (report.callbackOnUpdate ? Trace_Callback_On_Update : 0) | (report.failed ? Trace_Failed : 0));
+
+        //Store the change in arrival, zig-zag encoded as the Tasks finish out of order
+        const long long arrival = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration(report.arrival)).count();
+        const long long change = arrival - mLastArrival;
+        writeVarint(buffer, ((unsigned long long)change << 1) ^ (unsigned long long)(change >> 63));
+        mLastArrival = arrival;
+
+        //Store the kind, priority and run time
+        writeVarint(buffer, kind->second);
+        writeVarint(buffer, report.priority);
+        writeVarint(buffer, (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration(report.runTime)).count());
+    }
+
+    //Append the records
+    if (buffer.size()) {
+        fwrite(buffer.data(), 1, buffer.size(), mFile);
+        fflush(mFile);
+    }
+}
+
+/*
+    TraceRecorder : registerBuffer - Create a buffer for the calling thread and give it to the recorder
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Only locks the instance the first time a thread reports to a recorder
+
+    return std::shared_ptr<Buffer> - Returns the buffer, or nullptr if the recorder has been destroyed
+*/
+std::shared_ptr<AsynchTasks::TraceRecorder::Buffer> AsynchTasks::TraceRecorder::registerBuffer() {
+    //Lock the instance
+    std::lock_guard<std::mutex> lock(mInstanceLock);
+    if (!mInstance || !mInstance->mRunning) return nullptr;
+
+    //Create the buffer with the values of the recorder
+    std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();
+    buffer->start = mInstance->mStart;
+    buffer->limit = mInstance->mBufferLimit;
+    buffer->reports.reserve(std::min<size_t>(mInstance->mBufferLimit, 1024u));
+    mInstance->mBuffers.push_back(buffer);
+    return buffer;
+}
+
+/*
+    TraceRecorder : onProcessed - Buffer the report of a processed Task
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Reports go to a buffer owned by the calling thread, so the Workers only share a lock with the
+    writer thread
+
+    param[in] pTask - The Task that was processed
+    param[in] pStarted - The time the Worker started the Task (in steady clock ticks)
+    param[in] pFinished - The time the Worker finished the Task (in steady clock ticks)
+    param[in] pFailed - Flags if the process failed
+*/
+void AsynchTasks::TraceRecorder::onProcessed(const Asynch_Task_Base& pTask, long long pStarted, long long pFinished, bool pFailed) {
+    //Store the buffer of the thread, kept across reports
+    thread_local std::shared_ptr<Buffer> buffer;
+
+    //Register a buffer if the thread hasn't reported to this recorder yet
+    std::unique_lock<std::mutex> lock;
+    if (buffer) lock = std::unique_lock<std::mutex>(buffer->lock);
+    if (!buffer || !buffer->open) {
+        if (lock) lock.unlock();
+        buffer = registerBuffer();
+        if (!buffer) return;
+        lock = std::unique_lock<std::mutex>(buffer->lock);
+        if (!buffer->open) return;
+    }
+
+    //Ignore the Tasks that arrived before the recording started
+    const long long queuedAt = TaskManager::queuedAt(pTask);
+    if (queuedAt < buffer->start) return;
+
+    //Drop the report if the writer hasn't kept up
+    if (buffer->reports.size() >= buffer->limit) {
+        ++buffer->dropped;
+        return;
+    }
+
+    //Buffer the report
+    Report report;
+    report.arrival = queuedAt - buffer->start;
+    report.runTime = pFinished - pStarted;
+    report.kind = &TaskManager::processType(pTask);
+    report.priority = pTask.priority.value();
+    report.callbackOnUpdate = pTask.callbackOnUpdate.value();
+    report.failed = pFailed;
+    buffer->reports.push_back(report);
+}
+
+/*
+    TraceRecorder : writeVarint - Append an integer using 7 bits per byte
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pBuffer - The buffer to append to
+    param[in] pValue - The value to append
+*/
+void AsynchTasks::TraceRecorder::writeVarint(std::string& pBuffer, unsigned long long pValue) {
+    //Write the low bits first, flagging when more follow
+    while (pValue >= 0x80) {
+        pBuffer += (char)((pValue & 0x7F) | 0x80);
+        pValue >>= 7;
+    }
+    pBuffer += (char)pValue;
+}
+
+/*
+    TraceRecorder : create - Start recording the Tasks processed by the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pPath - The path of the trace file, replaced if it exists
+    param[in] pFlushInterval - The number of milliseconds between writes to the file (Default 100)
+    param[in] pBufferLimit - The number of reports each thread can buffer between writes, further
+                             reports are dropped (Default 65536)
+
+    return bool - Returns true if the TraceRecorder was created successfully
+*/
+bool AsynchTasks::TraceRecorder::create(const std::string& pPath, unsigned int pFlushInterval, size_t pBufferLimit) {
+    //Ensure the singleton hasn't been created and the Task Manager has
+    assert(!mInstance);
+    if (!TaskManager::mInstance || TaskManager::mInstance->mProcessedHook.load()) return false;
+
+    //Open the trace file
+    FILE* file = fopen(pPath.c_str(), "wb");
+    if (!file) return false;
+
+    //Write the header
+    const unsigned int version = 1;
+    fwrite("ATRC", 1, 4, file);
+    fwrite(&version, sizeof(version), 1, file);
+
+    //Create the singleton
+    mInstance = new TraceRecorder(file, (pFlushInterval ? pFlushInterval : 1u), (pBufferLimit ? pBufferLimit : 1u));
+
+    //Check the instance was created
+    if (!mInstance) {
+        printf("Unable to create the TraceRecorder singleton instance.");
+        fclose(file);
+        return false;
+    }
+
+    //Start the writer thread
+    TraceRecorder* instance = mInstance;
+    mInstance->mWriteThread = std::thread([instance]() { instance->runWrites(); });
+
+    //Observe the Workers
+    TaskManager::setProcessedHook(onProcessed);
+
+    //Return success
+    return true;
+}
+
+/*
+    TraceRecorder : destroy - Stop recording, writing the remaining reports to the trace
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::TraceRecorder::destroy() {
+    //Stop observing the Workers
+    if (TaskManager::mInstance) TaskManager::setProcessedHook(nullptr);
+
+    //Take the singleton instance so Workers still reporting no longer use it
+    mInstanceLock.lock();
+    TraceRecorder* instance = mInstance;
+    mInstance = nullptr;
+    if (instance) {
+        instance->mRunning = false;
+        instance->mWriteCondition.notify_all();
+    }
+    mInstanceLock.unlock();
+
+    //Test if the singleton instance was created
+    if (instance) {
+        //Stop the writer thread, writing what remains
+        if (instance->mWriteThread.joinable()) instance->mWriteThread.join();
+
+        //Close the trace
+        fclose(instance->mFile);
+
+        //Delete the singleton instance
+        delete instance;
+    }
+}
+
+/*
+    TraceRecorder : recorded - Retrieve the number of Tasks written to the trace
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return unsigned long long - Returns the number of events written (0 if not recording)
+*/
+unsigned long long AsynchTasks::TraceRecorder::recorded() {
+    std::lock_guard<std::mutex> lock(mInstanceLock);
+    return (mInstance ? mInstance->mRecorded : 0);
+}
+
+/*
+    TraceRecorder : dropped - Retrieve the number of Tasks left out of the trace as a buffer was full
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return unsigned long long - Returns the number of reports dropped (0 if not recording)
+*/
+unsigned long long AsynchTasks::TraceRecorder::dropped() {
+    std::lock_guard<std::mutex> lock(mInstanceLock);
+    return (mInstance ? mInstance->mDropped : 0);
+}
+#pragma endregion
+
+#pragma region Trace Replayer Function Definitions
+/*
+    TraceReplayer : readVarint - Read an integer stored using 7 bits per byte
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pCurrent - The position to read from, moved past the value
+    param[in] pEnd - The end of the buffer
+    param[out] pValue - The value that was read
+
+    return bool - Returns true if a complete value was read
+*/
+bool AsynchTasks::TraceReplayer::readVarint(const char*& pCurrent, const char* pEnd, unsigned long long& pValue) {
+    //Read the low bits first until a byte without the continue flag
+    pValue = 0;
+    for (unsigned int shift = 0; pCurrent < pEnd && shift < 64; shift += 7) {
+        const unsigned char byte = (unsigned char)*pCurrent++;
+        pValue |= (unsigned long long)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+/*
+    TraceReplayer : load - Read a trace written by the TraceRecorder
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A trace cut short while recording is read up to the last complete record
+
+    param[in] pPath - The path of the trace file
+    param[out] pTrace - The trace that was read, with the events ordered by arrival
+
+    return bool - Returns true if the file was a trace
+*/
+bool AsynchTasks::TraceReplayer::load(const std::string& pPath, TaskTrace& pTrace) {
+    //Read the file
+    FILE* file = fopen(pPath.c_str(), "rb");
+    if (!file) return false;
+    std::string data;
+    char chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file))) data.append(chunk, read);
+    fclose(file);
+
+    //Check the header
+    unsigned int version = 0;
+    if (data.size() < 8 || data.compare(0, 4, "ATRC")) return false;
+    memcpy(&version, data.data() + 4, sizeof(version));
+    if (version != 1) return false;
+
+    //Read the records
+    pTrace = TaskTrace();
+    const char* current = data.data() + 8, *end = data.data() + data.size();
+    long long arrival = 0;
+    while (current < end) {
+        const unsigned char tag = (unsigned char)*current++;
+        unsigned long long values[4];
+
+        //Read a kind
+        if (tag == Trace_Kind) {
+            if (!readVarint(current, end, values[0]) || (unsigned long long)(end - current) < values[0]) break;
+            pTrace.kinds.emplace_back(current, (size_t)values[0]);
+            current += values[0];
+        }
+
+        //Read an event
+        else if (tag & Trace_Event) {
+            if (!readVarint(current, end, values[0]) || !readVarint(current, end, values[1]) ||
+                !readVarint(current, end, values[2]) || !readVarint(current, end, values[3])) break;
+            arrival += (long long)(values[0] >> 1) ^ -(long long)(values[0] & 1);
+            TraceEvent event;
+            event.arrival = (double)arrival / 1e9;
+            event.kind = (unsigned int)values[1];
+            event.priority = (ETaskPriority)values[2];
+            event.runTime = (double)values[3] / 1e9;
+            event.callbackOnUpdate = (tag & Trace_Callback_On_Update) != 0;
+            event.failed = (tag & Trace_Failed) != 0;
+            pTrace.events.push_back(event);
+        }
+
+        //Stop at an unknown record
+        else break;
+    }
+
+    //Order the events by arrival, keeping the order of Tasks that arrived together
+    std::stable_sort(pTrace.events.begin(), pTrace.events.end(), [](const TraceEvent& pFirst, const TraceEvent& pSecond) {
+        return pFirst.arrival < pSecond.arrival;
+    });
+    return true;
+}
+
+/*
+    TraceReplayer : replay - Re-drive the arrivals of a trace through the TaskManager
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Blocks the calling thread until the trace has finished. Each Task uses the processor for its
+    recorded run time and throws if it failed. Callbacks on update are called while waiting
+
+    Requires:
+    The TaskManager must be created. If the trace has callbacks on update this must be called
+    from the thread that calls TaskManager::update
+
+    param[in] pTrace - The trace to replay
+    param[in] pSpeed - The multiplier of the arrival rate, the run times are unchanged (Default 1)
+
+    return SimulationReport - Returns the measured behaviour, with the latencies until each process finished
+*/
+AsynchTasks::SimulationReport AsynchTasks::TraceReplayer::replay(const TaskTrace& pTrace, double pSpeed) {
+    //Check the Task Manager exists
+    if (!TaskManager::mInstance || pSpeed <= 0.0) return SimulationReport();
+
+    //Check if the update function needs calling
+    bool onUpdate = false;
+    for (auto& event : pTrace.events) onUpdate |= event.callbackOnUpdate;
+
+    //Create the Tasks ahead of time so that creation isn't measured
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    auto elapsed = [start]() { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); };
+    std::vector<SchedulerSimulator::Record> records(pTrace.events.size());
+    std::vector<Task<void>> tasks(pTrace.events.size());
+    for (size_t i = 0; i < pTrace.events.size(); i++) {
+        const TraceEvent& event = pTrace.events[i];
+        tasks[i] = TaskManager::createTask<void>();
+        tasks[i]->priority = event.priority;
+        tasks[i]->callbackOnUpdate = event.callbackOnUpdate;
+        tasks[i]->process = [&records, &elapsed, &event, i]() {
+            //Use the processor for the recorded time
+            records[i].started = elapsed();
+            while (elapsed() - records[i].started < event.runTime);
+            records[i].finished = elapsed();
+
+            //Fail as the recorded Task did
+            if (event.failed) throw std::runtime_error("Replayed failure");
+        };
+    }
+
+    //Wait until a point in time, calling the callbacks on update if needed
+    auto waitUntil = [onUpdate](const std::chrono::steady_clock::time_point& pTime) {
+        while (onUpdate && std::chrono::steady_clock::now() < pTime) {
+            TaskManager::update();
+            std::this_thread::sleep_until(std::min(pTime, std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+        }
+        std::this_thread::sleep_until(pTime);
+    };
+
+    //Add the Tasks at their arrival times
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < pTrace.events.size(); i++) {
+        waitUntil(begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(pTrace.events[i].arrival / pSpeed)));
+        records[i].queued = elapsed();
+        records[i].priority = pTrace.events[i].priority;
+        TaskManager::addTask(tasks[i]);
+    }
+
+    //Wait for the Tasks to finish
+    for (auto& task : tasks) {
+        while (task->status == ETaskStatus::Pending || task->status == ETaskStatus::In_Progress || task->status == ETaskStatus::Callback_On_Update)
+            waitUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+    }
+
+    //Summarise the run
+    return SchedulerSimulator::summarise(records, TaskManager::mInstance->mWorkerCount);
+}
+#pragma endregion
+#endif
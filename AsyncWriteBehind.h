@@ -0,0 +1,662 @@
+#pragma once
+
+#include "AsyncTasks.h"
+#include "AsyncIO.h"
+
+#include <unordered_map>
+#include <condition_variable>
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#endif
+
+/*
+ *      Namespace: AsynchTasks
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Extend the AsynchTasks namespace with a service that buffers
+ *      small file writes from Tasks and flushes them in the background.
+**/
+namespace AsynchTasks {
+    #pragma region Write Behind Service Decleration
+    /*
+     *      Name: WriteBehindService
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Accept buffers to be appended to files without blocking the
+     *      calling thread on the write. Buffers are pushed onto a lock-free
+     *      queue and a dedicated flushing thread coalesces the buffers of
+     *      each file, writing them with a single vectored write (pwritev).
+     *
+     *      Buffers given for a single file are written in the order they
+     *      were accepted. Data is only durable once a sync request for the
+     *      file has completed; the sync Task finishes once every buffer
+     *      accepted before it has been written and the file flushed to
+     *      storage. Any write error on the file since the previous sync is
+     *      reported through the sync Task.
+     *
+     *      When the number of buffered bytes exceeds the limit, writes block
+     *      (or are rejected) until the flushing thread has caught up.
+     *
+     *      Requires:
+     *      The TaskManager must be created before and destroyed after the
+     *      WriteBehindService. Files are opened on their first write and
+     *      remain open until synced with the close flag or the service is
+     *      destroyed.
+    **/
+    class WriteBehindService {
+        //! Prototype the internal queue and file objects
+        struct Node;
+        struct Sync;
+        struct File;
+
+        /*----------Singleton Values----------*/
+        static WriteBehindService* mInstance;
+        WriteBehindService(size_t pByteLimit);
+        ~WriteBehindService() = default;
+
+        WriteBehindService() = delete;
+        WriteBehindService(const WriteBehindService&) = delete;
+        WriteBehindService& operator=(const WriteBehindService&) = delete;
+
+        /*----------Variables----------*/
+        //! Keep as a constant the number of bytes that can be buffered
+        const size_t mByteLimit;
+
+        //! Flag if the service is operating
+        bool mRunning;
+
+        //! Maintain the thread that flushes the buffers
+        std::thread mFlushThread;
+
+        //! Store the most recently pushed node of the lock-free queue
+        std::atomic<Node*> mQueue;
+
+        //! Create a lock and signal to wake the flushing thread
+        std::mutex mWakeLock;
+        std::condition_variable mWakeSignal;
+
+        //! Track the number of bytes that are waiting to be written
+        std::atomic<size_t> mBuffered;
+
+        //! Create a lock and signal for writers waiting on buffer space
+        std::mutex mSpaceLock;
+        std::condition_variable mSpaceSignal;
+
+        //! Store the open files by path (only used by the flushing thread)
+        std::unordered_map<std::string, File> mFiles;
+
+        /*----------Functions----------*/
+        //! Push a node onto the queue and wake the flushing thread
+        void push(Node* pNode);
+
+        //! Function run on the flushing thread to write the buffers
+        void flushBuffers();
+
+        //! Manage the state of the files
+        File& openFile(const std::string& pPath);
+        void flushFile(File& pFile);
+        void syncFile(File& pFile, Sync& pSync);
+        void closeFile(File& pFile);
+
+    public:
+        //! Define the default number of bytes that can be buffered
+        static const size_t DEFAULT_BYTE_LIMIT = 64u * 1024u * 1024u;
+
+        //! Main operation functionality
+        static bool create(size_t pByteLimit = DEFAULT_BYTE_LIMIT);
+        static void destroy();
+
+        //! Write options
+        static bool write(const std::string& pPath, IOBuffer pData, bool pWait = true);
+        static bool sync(Task<void>& pTask, const std::string& pPath, bool pClose = false);
+
+        //! Retrieve the number of bytes waiting to be written
+        static size_t buffered();
+    };
+    #pragma endregion
+
+    #pragma region Write Behind Definitions
+    /*
+     *      Name: Sync
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single sync request
+    **/
+    struct WriteBehindService::Sync {
+        //! Store the Task to queue once the file is synced
+        std::shared_ptr<Asynch_Task_Base> task;
+
+        //! Flag if the file should be closed once synced
+        bool close;
+
+        //! Store the error raised while writing or syncing the file
+        std::string error;
+    };
+
+    /*
+     *      Name: Node
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store a single buffer or sync request on the lock-free queue
+    **/
+    struct WriteBehindService::Node {
+        //! Store the next node in the queue
+        Node* next;
+
+        //! Store the file the request is for
+        std::string path;
+
+        //! Store the data to append to the file
+        IOBuffer data;
+
+        //! Store the sync request (nullptr for writes)
+        std::shared_ptr<Sync> sync;
+    };
+
+    /*
+     *      Name: File
+     *      Author: Mitchell Croft
+     *      Created: 18/10/2026
+     *      Modified: 18/10/2026
+     *
+     *      Purpose:
+     *      Store the state of a single open file on the flushing thread
+    **/
+    struct WriteBehindService::File {
+        //! Store the path and descriptor of the file
+        std::string path;
+        int file;
+
+        //! Store the position that the next buffer is written to
+        unsigned long long offset;
+
+        //! Store the buffers waiting to be written in order
+        std::vector<IOBuffer> pending;
+        size_t pendingBytes;
+
+        //! Store the first error raised since the last sync
+        std::string error;
+
+        //! Initialise with default values
+        inline File() : file(-1), offset(0), pendingBytes(0) {}
+    };
+    #pragma endregion
+}
+
+/*
+
+    Function Definitions:
+
+    Include a define for _ASYNCHRONOUS_TASKS_ in a single .cpp file inside
+    of the project to use the AsynchTasks namespace functionality
+
+*/
+#ifdef _ASYNCHRONOUS_TASKS_
+//! Define static singleton instance
+AsynchTasks::WriteBehindService* AsynchTasks::WriteBehindService::mInstance = nullptr;
+
+#pragma region Write Behind Service Function Definitions
+/*
+    WriteBehindService : Custom Constructor - Set default pre-creation singleton values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pByteLimit - The number of bytes that can be buffered before writes wait
+*/
+AsynchTasks::WriteBehindService::WriteBehindService(size_t pByteLimit) :
+    mByteLimit(pByteLimit),
+    mRunning(false),
+    mQueue(nullptr),
+    mBuffered(0)
+{}
+
+/*
+    WriteBehindService : push - Push a node onto the lock-free queue and wake the flushing thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pNode - The node to add to the queue
+*/
+void AsynchTasks::WriteBehindService::push(Node* pNode) {
+    //Link the node to the front of the queue
+    Node* head = mQueue.load(std::memory_order_relaxed);
+    do { pNode->next = head; } while (!mQueue.compare_exchange_weak(head, pNode, std::memory_order_release, std::memory_order_relaxed));
+
+    //Wake the flushing thread if the queue was empty
+    if (!head) {
+        mWakeLock.lock();
+        mWakeLock.unlock();
+        mWakeSignal.notify_one();
+    }
+}
+
+/*
+    WriteBehindService : flushBuffers - Collect the queued nodes and write them to their files
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void AsynchTasks::WriteBehindService::flushBuffers() {
+    //Loop so long as there are nodes to process or the service is running
+    while (true) {
+        //Wait for nodes to be available
+        std::unique_lock<std::mutex> guard(mWakeLock);
+        mWakeSignal.wait(guard, [&]() { return !mRunning || mQueue.load(std::memory_order_acquire); });
+        guard.unlock();
+
+        //Take all of the queued nodes
+        Node* nodes = mQueue.exchange(nullptr, std::memory_order_acquire);
+
+        //Check if the service is closing
+        if (!nodes) {
+            if (!mRunning) return;
+            continue;
+        }
+
+        //Reverse the nodes so they are processed in the order they were pushed
+        Node* ordered = nullptr;
+        while (nodes) {
+            Node* next = nodes->next;
+            nodes->next = ordered;
+            ordered = nodes;
+            nodes = next;
+        }
+
+        //Coalesce the buffers of each file, syncing where requested
+        while (ordered) {
+            //Get the file of the node
+            Node* node = ordered;
+            ordered = ordered->next;
+            File& file = openFile(node->path);
+
+            //Sync requests write the pending buffers first
+            if (node->sync) {
+                syncFile(file, *node->sync);
+                if (node->sync->close) closeFile(file);
+            }
+
+            //Otherwise add the buffer to the file
+            else {
+                file.pendingBytes += node->data.size();
+                file.pending.push_back(std::move(node->data));
+            }
+
+            //Delete the node
+            delete node;
+        }
+
+        //Write the remaining buffers
+        for (auto& pair : mFiles) {
+            if (pair.second.pending.size()) flushFile(pair.second);
+        }
+    }
+}
+
+/*
+    WriteBehindService : openFile - Retrieve the open file for a path, opening it if required
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A file that failed to open is opened again on its next use, rather than the failure being
+    kept. The error is stored on the file until it is reported by the next sync
+
+    param[in] pPath - The path of the file to retrieve
+
+    return File& - Returns a reference to the file state
+*/
+AsynchTasks::WriteBehindService::File& AsynchTasks::WriteBehindService::openFile(const std::string& pPath) {
+    //Check if the file is already open
+    auto found = mFiles.find(pPath);
+    if (found != mFiles.end() && found->second.file >= 0) return found->second;
+
+    //Create the file state, or retry opening a file that previously failed
+    File& file = (found != mFiles.end() ? found->second : mFiles[pPath]);
+    file.path = pPath;
+
+    //Open the file and append to the existing contents
+    #ifdef _WIN32
+    file.file = _open(pPath.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE);
+    if (file.file >= 0) file.offset = (unsigned long long)_lseeki64(file.file, 0, SEEK_END);
+    #else
+    file.file = open(pPath.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    if (file.file >= 0) file.offset = (unsigned long long)lseek(file.file, 0, SEEK_END);
+    #endif
+    if (file.file < 0 && file.error.empty()) file.error = "Failed to open the file '" + pPath + "' for writing: " + strerror(errno);
+    return file;
+}
+
+/*
+    WriteBehindService : flushFile - Write all of the pending buffers of a file
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    If the file isn't open the buffers are discarded and the error is kept on the file until
+    it is reported by the next sync
+
+    param[in/out] pFile - The file to write the pending buffers of
+*/
+void AsynchTasks::WriteBehindService::flushFile(File& pFile) {
+    //Flag the lost buffers if the file couldn't be opened
+    if (pFile.file < 0 && pFile.error.empty())
+        pFile.error = "Failed to write " + std::to_string(pFile.pendingBytes) + " bytes to the file '" + pFile.path + "' as it couldn't be opened";
+
+    //Write the buffers if the file is open
+    else if (pFile.file >= 0) {
+        #ifdef _WIN32
+        //Write the buffers in order
+        _lseeki64(pFile.file, (long long)pFile.offset, SEEK_SET);
+        for (size_t i = 0; i < pFile.pending.size(); i++) {
+            for (size_t done = 0; done < pFile.pending[i].size();) {
+                int result = _write(pFile.file, pFile.pending[i].data() + done, (unsigned int)(pFile.pending[i].size() - done));
+                if (result < 0) {
+                    if (pFile.error.empty()) pFile.error = "Failed to write to the file '" + pFile.path + "': " + strerror(errno);
+                    i = pFile.pending.size();
+                    break;
+                }
+                done += (size_t)result;
+                pFile.offset += (unsigned long long)result;
+            }
+        }
+        #else
+        //Describe the buffers with as few vectored writes as possible
+        std::vector<iovec> vecs;
+        vecs.reserve(pFile.pending.size());
+        for (IOBuffer& buffer : pFile.pending) {
+            if (buffer.size()) vecs.push_back({ buffer.data(), buffer.size() });
+        }
+
+        //Write the buffers, resuming after partial writes
+        for (size_t first = 0; first < vecs.size();) {
+            ssize_t result = pwritev(pFile.file, vecs.data() + first, (int)std::min<size_t>(vecs.size() - first, IOV_MAX), (off_t)pFile.offset);
+
+            //Check for an error
+            if (result < 0) {
+                if (errno == EINTR) continue;
+                if (pFile.error.empty()) pFile.error = "Failed to write to the file '" + pFile.path + "': " + strerror(errno);
+                break;
+            }
+            pFile.offset += (unsigned long long)result;
+
+            //Skip the vectors that were completely written
+            size_t remaining = (size_t)result;
+            while (first < vecs.size() && remaining >= vecs[first].iov_len) remaining -= vecs[first++].iov_len;
+
+            //Adjust the vector that was partially written
+            if (remaining) {
+                vecs[first].iov_base = (char*)vecs[first].iov_base + remaining;
+                vecs[first].iov_len -= remaining;
+            }
+        }
+        #endif
+    }
+
+    //Release the buffers
+    size_t bytes = pFile.pendingBytes;
+    pFile.pending.clear();
+    pFile.pendingBytes = 0;
+
+    //Wake any writers waiting for buffer space
+    mBuffered -= bytes;
+    mSpaceLock.lock();
+    mSpaceLock.unlock();
+    mSpaceSignal.notify_all();
+}
+
+/*
+    WriteBehindService : syncFile - Write the pending buffers of a file and flush it to storage
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in/out] pFile - The file to sync
+    param[in/out] pSync - The sync request to complete
+*/
+void AsynchTasks::WriteBehindService::syncFile(File& pFile, Sync& pSync) {
+    //Write the pending buffers
+    if (pFile.pending.size()) flushFile(pFile);
+
+    //Flush the file to storage
+    #ifdef _WIN32
+    if (pFile.file >= 0 && _commit(pFile.file) < 0 && pFile.error.empty())
+    #else
+    if (pFile.file >= 0 && fsync(pFile.file) < 0 && pFile.error.empty())
+    #endif
+        pFile.error = "Failed to sync the file '" + pFile.path + "': " + strerror(errno);
+
+    //Report the errors since the last sync
+    pSync.error = std::move(pFile.error);
+    pFile.error.clear();
+
+    //Hand the Task to the Workers for the callback stage
+    std::shared_ptr<Asynch_Task_Base> task = std::move(pSync.task);
+    TaskManager::queueTask(task);
+}
+
+/*
+    WriteBehindService : closeFile - Close a file and remove its state
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pFile - The file to close
+*/
+void AsynchTasks::WriteBehindService::closeFile(File& pFile) {
+    //Close the descriptor
+    #ifdef _WIN32
+    if (pFile.file >= 0) _close(pFile.file);
+    #else
+    if (pFile.file >= 0) close(pFile.file);
+    #endif
+
+    //Remove the file state
+    std::string path = pFile.path;
+    mFiles.erase(path);
+}
+
+/*
+    WriteBehindService : create - Initialise the service and start the flushing thread
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pByteLimit - The number of bytes that can be buffered before writes wait (Default 64MB)
+
+    return bool - Returns true if the WriteBehindService was created successfully
+*/
+bool AsynchTasks::WriteBehindService::create(size_t pByteLimit) {
+    //Assert that the service doesn't already exist
+    assert(!mInstance);
+
+    //Assert that buffers can be accepted
+    assert(pByteLimit);
+
+    //Create the new service
+    mInstance = new WriteBehindService(pByteLimit);
+
+    //Test to ensure the instance were created
+    if (!mInstance) {
+        printf("Unable to create the WriteBehindService singleton instance.");
+        return false;
+    }
+
+    //Set the operating flag
+    mInstance->mRunning = true;
+
+    //Start the flushing thread
+    mInstance->mFlushThread = std::thread([&]() {
+        //Call the flushing function
+        mInstance->flushBuffers();
+    });
+
+    //Return creation was completed successfully
+    return true;
+}
+
+/*
+    WriteBehindService : destroy - Write the remaining buffers, close the files and delete the
+                                   WriteBehindService
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Files are closed without being synced. Write errors that have not been reported by a
+    sync are lost
+*/
+void AsynchTasks::WriteBehindService::destroy() {
+    //Test if the singleton instance was created
+    if (mInstance) {
+        //Clear the operating flag and wake the flushing thread
+        mInstance->mWakeLock.lock();
+        mInstance->mRunning = false;
+        mInstance->mWakeLock.unlock();
+        mInstance->mWakeSignal.notify_one();
+
+        //Join the flushing thread
+        if (mInstance->mFlushThread.get_id() != std::thread::id())
+            mInstance->mFlushThread.join();
+
+        //Close the open files
+        while (mInstance->mFiles.size())
+            mInstance->closeFile(mInstance->mFiles.begin()->second);
+
+        //Delete the singleton instance
+        delete mInstance;
+        mInstance = nullptr;
+    }
+}
+
+/*
+    WriteBehindService : write - Accept a buffer to be appended to a file in the background
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    A buffer larger than the byte limit is accepted once all other buffers have been written
+
+    param[in] pPath - The path of the file to append to. Created if it doesn't exist
+    param[in] pData - The data to append to the file
+    param[in] pWait - Flags if the call should wait for buffer space when the limit is
+                      reached, otherwise the buffer is rejected (Default true)
+
+    return bool - Returns true if the buffer was accepted
+*/
+bool AsynchTasks::WriteBehindService::write(const std::string& pPath, IOBuffer pData, bool pWait) {
+    //Ensure the service is running
+    if (!mInstance || !mInstance->mRunning) return false;
+
+    //Reserve space for the buffer
+    const size_t size = pData.size();
+    size_t buffered = mInstance->mBuffered.load();
+    while (true) {
+        //Check if there is space for the buffer
+        if (!buffered || buffered + size <= mInstance->mByteLimit) {
+            if (mInstance->mBuffered.compare_exchange_weak(buffered, buffered + size)) break;
+            continue;
+        }
+
+        //Check if the buffer should be rejected
+        if (!pWait) return false;
+
+        //Wait for the flushing thread to release space
+        std::unique_lock<std::mutex> guard(mInstance->mSpaceLock);
+        mInstance->mSpaceSignal.wait(guard, [&]() {
+            buffered = mInstance->mBuffered.load();
+            return !buffered || buffered + size <= mInstance->mByteLimit;
+        });
+    }
+
+    //Add the buffer to the queue
+    Node* node = new Node();
+    node->path = pPath;
+    node->data = std::move(pData);
+    mInstance->push(node);
+    return true;
+}
+
+/*
+    WriteBehindService : sync - Flush the buffers accepted for a file to storage
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    The Task finishes with an error if any write to the file failed since the previous sync
+
+    param[in/out] pTask - A Task<void> object to finish once the file is durable. Once added
+                          the property values will be uneditable
+    param[in] pPath - The path of the file to sync
+    param[in] pClose - Flags if the file should be closed once synced (Default false)
+
+    return bool - Returns a flag determining if the sync was submitted successfully
+*/
+bool AsynchTasks::WriteBehindService::sync(Task<void>& pTask, const std::string& pPath, bool pClose) {
+    //Ensure the service is running and the task can be used
+    if (!mInstance || !mInstance->mRunning || !pTask || !TaskManager::lockTask(*pTask)) return false;
+
+    //Create the sync request
+    std::shared_ptr<Sync> sync = std::make_shared<Sync>();
+    sync->task = pTask;
+    sync->close = pClose;
+
+    //Set the process to report the result of the sync
+    TaskManager::setProcess<void>(*pTask, [sync]() {
+        if (sync->error.size()) throw std::runtime_error(sync->error);
+    });
+
+    //Add the request to the queue
+    Node* node = new Node();
+    node->path = pPath;
+    node->sync = sync;
+    mInstance->push(node);
+    return true;
+}
+
+/*
+    WriteBehindService : buffered - Retrieve the number of bytes waiting to be written
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    return size_t - Returns the number of accepted bytes that have not been written
+*/
+size_t AsynchTasks::WriteBehindService::buffered() {
+    return (mInstance ? mInstance->mBuffered.load() : 0);
+}
+#pragma endregion
+#endif
@@ -0,0 +1,460 @@
+//Compile the AsynchTasks implementation into the load generator
+#include "../../AsyncTasks.cpp"
+
+#include <deque>
+#include <csignal>
+
+//! Flag when the load generator has been asked to stop
+static std::atomic_bool gStop(false);
+
+/*
+    onSignal - Request the load generator to stop when interrupted
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pSignal - The signal that was raised (unused)
+*/
+extern "C" void onSignal(int /*pSignal*/) {
+    gStop = true;
+}
+
+/*
+ *      Name: LoadSpec
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Store the workload described on the command line
+**/
+struct LoadSpec {
+    //! Store the number of Workers to create
+    unsigned int workers = 4;
+
+    //! Store the open loop arrival rate (Tasks per second), used when the concurrency is 0
+    double rate = 1000.0;
+
+    //! Store the number of Tasks kept in flight for a closed loop (0 for an open loop)
+    unsigned int concurrency = 0;
+
+    //! Store the limits of the run, the first reached stops submission (0 for no limit)
+    unsigned long long tasks = 10000;
+    double seconds = 0.0;
+
+    //! Store the distribution of the Task durations (in seconds)
+    AsynchTasks::Distribution duration = AsynchTasks::Distribution::exponential(0.002);
+
+    //! Store the priorities given to the Tasks and their relative weights
+    std::vector<std::pair<AsynchTasks::ETaskPriority, double>> priorities = { { AsynchTasks::Medium_Priority, 1.0 } };
+
+    //! Store the fraction of each Task spent using the processor, the rest is spent sleeping
+    double cpuRatio = 1.0;
+
+    //! Flag if callbacks are called by TaskManager::update on the main thread
+    bool callbackOnUpdate = false;
+
+    //! Store the probability (0 - 1) of a Task throwing
+    double errorRate = 0.0;
+
+    //! Store the time between reports (in seconds)
+    double interval = 1.0;
+
+    //! Store the seed of the random generator
+    unsigned long long seed = 1;
+};
+
+/*
+ *      Name: Slot
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Store a reusable Task and the times of its current run
+**/
+struct Slot {
+    //! Store the Task, reused once it has finished
+    AsynchTasks::Task<void> task;
+
+    //! Store the duration of the current run and if it should throw
+    double duration;
+    bool fail;
+
+    //! Store the times the Task was submitted, started and finished
+    std::chrono::steady_clock::time_point submitted;
+    std::chrono::steady_clock::time_point started;
+    std::chrono::steady_clock::time_point finished;
+};
+
+/*
+ *      Name: Window
+ *      Author: Mitchell Croft
+ *      Created: 18/10/2026
+ *      Modified: 18/10/2026
+ *
+ *      Purpose:
+ *      Collect the results of the Tasks finished within a report window
+**/
+struct Window {
+    unsigned long long submitted = 0;
+    unsigned long long completed = 0;
+    unsigned long long failed = 0;
+    std::vector<double> waits;
+    std::vector<double> latencies;
+};
+
+/*
+    parseDistribution - Read a distribution in the form "shape:value[,value...]"
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Supported shapes are fixed:v, uniform:min,max, exp:mean, bimodal:short,long,chance and
+    pareto:min,shape. Values are in seconds
+
+    param[in] pText - The text to read
+    param[out] pDistribution - The distribution that was read
+
+    return bool - Returns true if the text was valid
+*/
+bool parseDistribution(const std::string& pText, AsynchTasks::Distribution& pDistribution) {
+    //Split the shape from the values
+    size_t colon = pText.find(':');
+    if (colon == std::string::npos) return false;
+    const std::string shape = pText.substr(0, colon);
+    double values[3] = { 0.0, 0.0, 0.0 };
+    int count = sscanf(pText.c_str() + colon + 1, "%lf,%lf,%lf", &values[0], &values[1], &values[2]);
+
+    //Create the distribution
+    if (shape == "fixed" && count >= 1) pDistribution = AsynchTasks::Distribution::fixed(values[0]);
+    else if (shape == "uniform" && count >= 2) pDistribution = AsynchTasks::Distribution::uniform(values[0], values[1]);
+    else if (shape == "exp" && count >= 1) pDistribution = AsynchTasks::Distribution::exponential(values[0]);
+    else if (shape == "bimodal" && count >= 3) pDistribution = AsynchTasks::Distribution::bimodal(values[0], values[1], values[2]);
+    else if (shape == "pareto" && count >= 2) pDistribution = AsynchTasks::Distribution::pareto(values[0], values[1]);
+    else return false;
+    return true;
+}
+
+/*
+    parsePriorities - Read a priority mix in the form "priority:weight[,priority:weight...]"
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Priorities are high, medium, low or a number
+
+    param[in] pText - The text to read
+    param[out] pPriorities - The priorities and weights that were read
+
+    return bool - Returns true if the text was valid
+*/
+bool parsePriorities(const std::string& pText, std::vector<std::pair<AsynchTasks::ETaskPriority, double>>& pPriorities) {
+    //Read each entry
+    pPriorities.clear();
+    size_t start = 0;
+    while (start < pText.size()) {
+        //Find the end of the entry
+        size_t end = pText.find(',', start);
+        if (end == std::string::npos) end = pText.size();
+        const std::string entry = pText.substr(start, end - start);
+        start = end + 1;
+
+        //Split the priority from the weight
+        size_t colon = entry.find(':');
+        if (colon == std::string::npos) return false;
+        const std::string name = entry.substr(0, colon);
+        const double weight = atof(entry.c_str() + colon + 1);
+        if (weight <= 0.0) return false;
+
+        //Read the priority
+        AsynchTasks::ETaskPriority priority;
+        if (name == "high") priority = AsynchTasks::High_Priority;
+        else if (name == "medium") priority = AsynchTasks::Medium_Priority;
+        else if (name == "low") priority = AsynchTasks::Low_Priority;
+        else priority = (AsynchTasks::ETaskPriority)strtoul(name.c_str(), nullptr, 10);
+        pPriorities.push_back({ priority, weight });
+    }
+    return pPriorities.size() > 0;
+}
+
+/*
+    percentile - Retrieve a percentile of a sorted set of values
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pValues - The sorted values
+    param[in] pFraction - The fraction (0 - 1) of the values that are below the percentile
+
+    return double - Returns the value at the percentile, or 0 if there are no values
+*/
+double percentile(const std::vector<double>& pValues, double pFraction) {
+    if (pValues.empty()) return 0.0;
+    return pValues[std::min(pValues.size() - 1, (size_t)(pFraction * (double)pValues.size()))];
+}
+
+/*
+    report - Output the throughput and latencies of a window
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pLabel - The label of the report
+    param[in/out] pWindow - The window to report. The latencies are sorted
+    param[in] pSeconds - The length of the window in seconds
+*/
+void report(const char* pLabel, Window& pWindow, double pSeconds) {
+    //Sort the latencies for the percentiles
+    std::sort(pWindow.waits.begin(), pWindow.waits.end());
+    std::sort(pWindow.latencies.begin(), pWindow.latencies.end());
+
+    //Output the report in milliseconds
+    printf("%-8s submitted %8llu  completed %8llu  failed %6llu  %10.1f/s | wait p50 %8.3f p99 %8.3f | latency p50 %8.3f p90 %8.3f p99 %8.3f max %8.3f ms\n",
+           pLabel, pWindow.submitted, pWindow.completed, pWindow.failed, (double)(pWindow.completed + pWindow.failed) / pSeconds,
+           percentile(pWindow.waits, 0.5) * 1000.0, percentile(pWindow.waits, 0.99) * 1000.0,
+           percentile(pWindow.latencies, 0.5) * 1000.0, percentile(pWindow.latencies, 0.9) * 1000.0,
+           percentile(pWindow.latencies, 0.99) * 1000.0, percentile(pWindow.latencies, 1.0) * 1000.0);
+    fflush(stdout);
+}
+
+/*
+    usage - Output the command line options
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void usage() {
+    printf("Usage: LoadGenerator [options]\n"
+           "  --workers N         Number of Workers (Default 4)\n"
+           "  --rate R            Open loop arrival rate in Tasks per second (Default 1000)\n"
+           "  --concurrency C     Closed loop, keeping C Tasks in flight (overrides --rate)\n"
+           "  --tasks N           Number of Tasks to submit, 0 for no limit (Default 10000)\n"
+           "  --seconds S         Stop submitting after S seconds, 0 for no limit (Default 0)\n"
+           "  --duration D        Task duration: fixed:v, uniform:min,max, exp:mean, bimodal:short,long,chance\n"
+           "                      or pareto:min,shape in seconds (Default exp:0.002)\n"
+           "  --priorities P      Priority mix, e.g. high:1,medium:2,low:7 (Default medium:1)\n"
+           "  --cpu F             Fraction of each Task spent using the processor, the rest sleeps (Default 1)\n"
+           "  --callback M        Call callbacks on the 'worker' or on 'update' (Default worker)\n"
+           "  --errors P          Probability of a Task throwing (Default 0)\n"
+           "  --interval S        Seconds between reports (Default 1)\n"
+           "  --seed N            Seed of the random generator (Default 1)\n");
+}
+
+/*
+    parseArguments - Read the workload from the command line
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pArgc - The number of command line arguments
+    param[in] pArgv - The command line arguments
+    param[out] pSpec - The workload that was read
+
+    return bool - Returns true if the arguments were valid
+*/
+bool parseArguments(int pArgc, char** pArgv, LoadSpec& pSpec) {
+    //Read the options in pairs
+    for (int i = 1; i < pArgc; i += 2) {
+        const std::string option = pArgv[i];
+        if (i + 1 >= pArgc) return false;
+        const std::string value = pArgv[i + 1];
+
+        if (option == "--workers") pSpec.workers = (unsigned int)atoi(value.c_str());
+        else if (option == "--rate") pSpec.rate = atof(value.c_str());
+        else if (option == "--concurrency") pSpec.concurrency = (unsigned int)atoi(value.c_str());
+        else if (option == "--tasks") pSpec.tasks = strtoull(value.c_str(), nullptr, 10);
+        else if (option == "--seconds") pSpec.seconds = atof(value.c_str());
+        else if (option == "--duration") { if (!parseDistribution(value, pSpec.duration)) return false; }
+        else if (option == "--priorities") { if (!parsePriorities(value, pSpec.priorities)) return false; }
+        else if (option == "--cpu") pSpec.cpuRatio = std::max(0.0, std::min(atof(value.c_str()), 1.0));
+        else if (option == "--callback") pSpec.callbackOnUpdate = (value == "update");
+        else if (option == "--errors") pSpec.errorRate = atof(value.c_str());
+        else if (option == "--interval") pSpec.interval = atof(value.c_str());
+        else if (option == "--seed") pSpec.seed = strtoull(value.c_str(), nullptr, 10);
+        else return false;
+    }
+
+    //Check the workload can run
+    return pSpec.workers && (pSpec.concurrency || pSpec.rate > 0.0) && (pSpec.tasks || pSpec.seconds > 0.0) && pSpec.interval > 0.0;
+}
+
+/*
+    main - Drive the TaskManager with a synthetic workload and report its performance
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Built by LoadGenerator.vcxproj in the solution, or on POSIX with
+    "g++ -std=c++14 -O2 -pthread LoadGenerator.cpp -o LoadGenerator"
+
+    param[in] pArgc - The number of command line arguments
+    param[in] pArgv - The command line arguments
+
+    return int - Returns EXIT_SUCCESS once the workload has finished, or EXIT_FAILURE if the
+                 arguments were invalid
+*/
+int main(int pArgc, char** pArgv) {
+    //Read the workload
+    LoadSpec spec;
+    if (!parseArguments(pArgc, pArgv, spec)) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    //Stop submitting when interrupted
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(spec.workers)) return EXIT_FAILURE;
+    AsynchTasks::TaskManager::setMaxCallbacks(~0u);
+
+    //Create the random generators
+    std::mt19937_64 generator(spec.seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::exponential_distribution<double> gap(spec.rate);
+    std::vector<double> weights;
+    for (auto& priority : spec.priorities) weights.push_back(priority.second);
+    std::discrete_distribution<size_t> pickPriority(weights.begin(), weights.end());
+
+    //Store the Tasks, the ones in flight and the ones free to reuse
+    std::deque<Slot> slots;
+    std::vector<Slot*> inFlight, spare;
+
+    //Store the results of the current window and the whole run
+    Window window, total;
+
+    //Output the workload
+    printf("Workers %u, %s %g, duration mean %.3fms, cpu %.0f%%, callbacks on %s, error rate %g\n",
+           spec.workers, (spec.concurrency ? "concurrency" : "rate"), (spec.concurrency ? (double)spec.concurrency : spec.rate),
+           spec.duration.mean() * 1000.0, spec.cpuRatio * 100.0, (spec.callbackOnUpdate ? "update" : "worker"), spec.errorRate);
+
+    //Track the timing of the run
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point nextArrival = start, windowStart = start;
+    unsigned long long submitted = 0;
+
+    //Loop until every submitted Task has finished
+    bool submitting = true;
+    while (submitting || inFlight.size()) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        //Stop submitting once a limit is reached
+        if (gStop || (spec.tasks && submitted >= spec.tasks) ||
+            (spec.seconds > 0.0 && std::chrono::duration<double>(now - start).count() >= spec.seconds)) submitting = false;
+
+        //Submit the Tasks that are due
+        while (submitting && (spec.concurrency ? inFlight.size() < spec.concurrency : nextArrival <= now) &&
+               (!spec.tasks || submitted < spec.tasks)) {
+            //Get a free slot, creating a new Task when none are spare
+            Slot* slot;
+            if (spare.size()) {
+                slot = spare.back();
+                spare.pop_back();
+            } else {
+                slots.emplace_back();
+                slot = &slots.back();
+                slot->task = AsynchTasks::TaskManager::createTask<void>();
+                slot->task->process = [slot, &spec]() {
+                    //Use the processor for part of the duration
+                    slot->started = std::chrono::steady_clock::now();
+                    const std::chrono::duration<double> busy(slot->duration * spec.cpuRatio);
+                    while (std::chrono::steady_clock::now() - slot->started < busy);
+
+                    //Sleep for the remainder
+                    if (spec.cpuRatio < 1.0)
+                        std::this_thread::sleep_for(std::chrono::duration<double>(slot->duration * (1.0 - spec.cpuRatio)));
+
+                    //Fail if requested
+                    if (slot->fail) {
+                        slot->finished = std::chrono::steady_clock::now();
+                        throw std::runtime_error("Injected failure");
+                    }
+                };
+                slot->task->callback = [slot]() { slot->finished = std::chrono::steady_clock::now(); };
+            }
+
+            //Setup the run, setting the priority also resets a failed Task
+            slot->duration = spec.duration.sample(generator);
+            slot->fail = (spec.errorRate > 0.0 && unit(generator) < spec.errorRate);
+            slot->task->priority = spec.priorities[pickPriority(generator)].first;
+            slot->task->callbackOnUpdate = spec.callbackOnUpdate;
+
+            //Submit the Task, open loop arrivals are timed from their schedule rather than when they were noticed
+            slot->submitted = (spec.concurrency ? now : nextArrival);
+            if (!AsynchTasks::TaskManager::addTask(slot->task)) {
+                spare.push_back(slot);
+                gStop = true;
+                break;
+            }
+            inFlight.push_back(slot);
+            ++submitted;
+            ++window.submitted;
+            if (!spec.concurrency) nextArrival += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(gap(generator)));
+        }
+
+        //Call the callbacks of the Tasks waiting on the main thread
+        if (spec.callbackOnUpdate) AsynchTasks::TaskManager::update();
+
+        //Collect the Tasks that have finished
+        for (size_t i = 0; i < inFlight.size();) {
+            Slot* slot = inFlight[i];
+            const AsynchTasks::ETaskStatus status = slot->task->status;
+            if (status != AsynchTasks::ETaskStatus::Completed && status != AsynchTasks::ETaskStatus::Error) {
+                ++i;
+                continue;
+            }
+
+            //Record the result
+            if (status == AsynchTasks::ETaskStatus::Completed) ++window.completed;
+            else ++window.failed;
+            window.waits.push_back(std::chrono::duration<double>(slot->started - slot->submitted).count());
+            window.latencies.push_back(std::chrono::duration<double>(slot->finished - slot->submitted).count());
+
+            //Return the slot for reuse
+            spare.push_back(slot);
+            inFlight[i] = inFlight.back();
+            inFlight.pop_back();
+        }
+
+        //Report the window once it has elapsed
+        now = std::chrono::steady_clock::now();
+        const double windowLength = std::chrono::duration<double>(now - windowStart).count();
+        if (windowLength >= spec.interval) {
+            report("window", window, windowLength);
+            total.submitted += window.submitted;
+            total.completed += window.completed;
+            total.failed += window.failed;
+            total.waits.insert(total.waits.end(), window.waits.begin(), window.waits.end());
+            total.latencies.insert(total.latencies.end(), window.latencies.begin(), window.latencies.end());
+            window = Window();
+            windowStart = now;
+        }
+
+        //Wait for the next arrival or a short while for Tasks to finish
+        std::chrono::steady_clock::time_point wake = now + std::chrono::microseconds(200);
+        if (submitting && !spec.concurrency && nextArrival < wake) wake = nextArrival;
+        std::this_thread::sleep_until(wake);
+    }
+
+    //Report the whole run
+    total.submitted += window.submitted;
+    total.completed += window.completed;
+    total.failed += window.failed;
+    total.waits.insert(total.waits.end(), window.waits.begin(), window.waits.end());
+    total.latencies.insert(total.latencies.end(), window.latencies.begin(), window.latencies.end());
+    report("total", total, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    //Output the Task Manager's own counters
+    const AsynchTasks::TaskMetrics metrics = AsynchTasks::TaskManager::metrics();
+    printf("TaskManager: queued %llu, completed %llu, failed %llu, %zu Tasks allocated\n",
+           metrics.tasksQueued, metrics.tasksCompleted, metrics.tasksFailed, slots.size());
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+    return EXIT_SUCCESS;
+}
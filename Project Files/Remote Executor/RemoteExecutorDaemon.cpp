@@ -0,0 +1,76 @@
+//Compile the AsynchTasks implementation into the daemon
+#include "../../AsyncTasks.cpp"
+
+#include <csignal>
+
+//! Label the kinds of Task that the daemon processes
+enum : AsynchTasks::taskKind { Checksum_Kind = 1, Echo_Kind, Sum_Kind = 10 };
+
+//! Flag when the daemon has been asked to stop
+static std::atomic_bool gStop(false);
+
+/*
+    onSignal - Request the daemon to stop when interrupted
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pSignal - The signal that was raised (unused)
+*/
+extern "C" void onSignal(int /*pSignal*/) {
+    gStop = true;
+}
+
+/*
+    main - Serve Tasks to RemoteExecutors until interrupted
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Usage: RemoteExecutorDaemon [address] [worker count] [credits]
+    The address is in the form "tcp:host:port" or "unix:path" (Default tcp:127.0.0.1:7878)
+    Built by RemoteExecutorDaemon.vcxproj in the solution, or on POSIX with
+    "g++ -std=c++14 -O2 -pthread RemoteExecutorDaemon.cpp -o RemoteExecutorDaemon"
+
+    param[in] pArgc - The number of command line arguments
+    param[in] pArgv - The command line arguments
+
+    return int - Returns EXIT_SUCCESS once stopped, or EXIT_FAILURE if the node couldn't start
+*/
+int main(int pArgc, char** pArgv) {
+    //Read the settings
+    std::string address = (pArgc > 1 ? pArgv[1] : "tcp:127.0.0.1:7878");
+    unsigned int workers = (pArgc > 2 ? (unsigned int)atoi(pArgv[2]) : 4u);
+    unsigned int credits = (pArgc > 3 ? (unsigned int)atoi(pArgv[3]) : 256u);
+
+    //Register the kinds used by the testing application
+    AsynchTasks::TaskRegistry::registerKind(Checksum_Kind, "Checksum", [](const char* pData, size_t pSize) {
+        unsigned int checksum = 0;
+        for (size_t i = 0; i < pSize; i++) checksum = checksum * 31 + (unsigned char)pData[i];
+        return AsynchTasks::IOBuffer((const char*)&checksum, (const char*)&checksum + sizeof(checksum));
+    });
+    AsynchTasks::TaskRegistry::registerKind(Echo_Kind, "Echo", [](const char* pData, size_t pSize) {
+        return AsynchTasks::IOBuffer(pData, pData + pSize);
+    });
+    AsynchTasks::TaskRegistry::registerKind(Sum_Kind, "Sum", [](const char* pData, size_t pSize) {
+        unsigned long long sum = 0;
+        for (size_t i = 0; i < pSize; i++) sum += (unsigned char)pData[i];
+        return AsynchTasks::IOBuffer((const char*)&sum, (const char*)&sum + sizeof(sum));
+    });
+
+    //Stop cleanly when interrupted
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(workers ? workers : 1u)) return EXIT_FAILURE;
+
+    //Serve until stopped
+    printf("Serving Tasks on %s with %u workers and %u credits per connection\n", address.c_str(), workers, credits);
+    bool served = AsynchTasks::RemoteNode::serve(address, (credits ? credits : 1u), &gStop);
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+    return (served ? EXIT_SUCCESS : EXIT_FAILURE);
+}
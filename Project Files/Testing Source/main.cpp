@@ -1,4 +1,22 @@
 #include "../../AsyncTasks.h"
+#include "../../AsyncIO.h"
+#include "../../AsyncReactor.h"
+#include "../../AsyncStreaming.h"
+#include "../../AsyncMappedFile.h"
+#include "../../AsyncWriteBehind.h"
+#include "../../AsyncProcessPool.h"
+#include "../../AsyncRemote.h"
+#include "../../AsyncJournal.h"
+#include "../../AsyncSpill.h"
+#include "../../AsyncRateLimit.h"
+#include "../../AsyncIncremental.h"
+#include "../../AsyncIntrospection.h"
+#include "../../AsyncSimulation.h"
+#include "../../AsyncTrace.h"
+#include "../../AsyncPolicy.h"
+#include "../../AsyncClosed.h"
+#include "../../AsyncSource.h"
+#include "../../AsyncScope.h"
 
 #include "BasicInput.h"
 #include "Random.h"
@@ -316,13 +334,1798 @@ void errorReporting() {
     AsynchTasks::TaskManager::destroy();
 }
 
+/*
+    asynchronousFileReading - Benchmark reading thousands of small files with blocking Tasks
+                              and the IOManager backends
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void asynchronousFileReading() {
+    //Define the size of the files to read
+    const unsigned int FILE_SIZE = 4096;
+
+    //Store the number of files to create
+    unsigned int fileCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(fileCount, "Enter the number of files to read (100,000 maximum): ");
+    } while (!fileCount || fileCount > 100000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Create the files to read
+    printf("Creating %u files of %u bytes...\n\n", fileCount, FILE_SIZE);
+    std::vector<std::string> paths(fileCount);
+    std::vector<char> contents(FILE_SIZE, 'A');
+    for (unsigned int i = 0; i < fileCount; i++) {
+        //Set the name of the file
+        paths[i] = "io_benchmark_" + std::to_string(i) + ".tmp";
+
+        //Write the contents
+        FILE* file = fopen(paths[i].c_str(), "wb");
+        if (file) {
+            fwrite(contents.data(), 1, contents.size(), file);
+            fclose(file);
+        }
+    }
+
+    //Label the different methods of reading the files
+    const char* METHOD_NAMES[] = { "Blocking read in Task", "IOManager (blocking pool)", "IOManager (io_uring)" };
+
+    //Test each of the methods
+    for (unsigned int method = 0; method < 3; method++) {
+        //Create the Task Manager
+        if (!AsynchTasks::TaskManager::create(4)) {
+            printf("Failed to create the Asynchronous Task Manager\n");
+            break;
+        }
+
+        //Create the IO Manager for the asynchronous methods
+        if (method && !AsynchTasks::IOManager::create(2, 256, method == 2)) {
+            printf("Failed to create the Asynchronous IO Manager\n");
+            AsynchTasks::TaskManager::destroy();
+            break;
+        }
+
+        //Check that io_uring is available for the final method
+        if (method == 2 && !AsynchTasks::IOManager::usingIOUring()) {
+            printf("%-28s io_uring is not available on this system\n", METHOD_NAMES[method]);
+            AsynchTasks::IOManager::destroy();
+            AsynchTasks::TaskManager::destroy();
+            continue;
+        }
+
+        //Track the number of bytes read
+        std::atomic<unsigned long long> bytesRead(0);
+
+        //Store the Tasks that are reading the files
+        std::vector<AsynchTasks::Task<AsynchTasks::IOBuffer>> tasks(fileCount);
+
+        //Start timing the method
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Submit the reads
+        for (unsigned int i = 0; i < fileCount; i++) {
+            //Create the Task
+            tasks[i] = AsynchTasks::TaskManager::createTask<AsynchTasks::IOBuffer>();
+            tasks[i]->callback = [&](AsynchTasks::IOBuffer& pData) { bytesRead += pData.size(); };
+
+            //Check if the file should be read inside of the Task
+            if (!method) {
+                //Read the file on the Worker
+                const std::string& path = paths[i];
+                tasks[i]->process = [&path]() -> AsynchTasks::IOBuffer {
+                    //Open the file
+                    FILE* file = fopen(path.c_str(), "rb");
+                    if (!file) throw std::runtime_error("Failed to open the file " + path);
+
+                    //Read the contents
+                    AsynchTasks::IOBuffer data(FILE_SIZE);
+                    data.resize(fread(data.data(), 1, data.size(), file));
+                    fclose(file);
+                    return data;
+                };
+
+                //Add the Task to the Task Manager
+                AsynchTasks::TaskManager::addTask(tasks[i]);
+            }
+
+            //Otherwise submit the read to the IO Manager
+            else AsynchTasks::IOManager::readFile(tasks[i], paths[i]);
+        }
+
+        //Wait for all of the Tasks to finish
+        unsigned int finished = 0, failed = 0;
+        while (finished < fileCount) {
+            //Count the finished Tasks
+            finished = failed = 0;
+            for (unsigned int i = 0; i < fileCount; i++) {
+                if (tasks[i]->status == AsynchTasks::ETaskStatus::Completed) finished++;
+                else if (tasks[i]->status == AsynchTasks::ETaskStatus::Error) { finished++; failed++; }
+            }
+
+            //Give the Workers time to process
+            if (finished < fileCount) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Get the time taken
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        printf("%-28s %10.2f ms %12.0f files/s %12llu bytes (%u failed)\n", METHOD_NAMES[method], elapsed, fileCount / (elapsed / 1000.0), bytesRead.load(), failed);
+
+        //Destroy the managers
+        AsynchTasks::IOManager::destroy();
+        AsynchTasks::TaskManager::destroy();
+    }
+
+    //Remove the files
+    for (unsigned int i = 0; i < fileCount; i++)
+        remove(paths[i].c_str());
+}
+
+#ifdef __linux__
+/*
+    reactorEvents - Process the data written to a pipe as it arrives, with a watch that is
+                    disarmed when its Task fails
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void reactorEvents() {
+    //Create the managers
+    if (!AsynchTasks::TaskManager::create(4) || !AsynchTasks::Reactor::create()) {
+        printf("Failed to create the Asynchronous Reactor\n");
+        AsynchTasks::TaskManager::destroy();
+        return;
+    }
+
+    //Test each of the trigger modes
+    const AsynchTasks::ETriggerMode MODES[] = { AsynchTasks::ETriggerMode::Level, AsynchTasks::ETriggerMode::Edge };
+    const char* MODE_NAMES[] = { "Level", "Edge" };
+    for (int mode = 0; mode < 2; mode++) {
+        //Create a pipe that is read without blocking
+        int files[2];
+        if (pipe(files) < 0 || fcntl(files[0], F_SETFL, O_NONBLOCK) < 0) {
+            printf("Failed to create the pipe\n");
+            break;
+        }
+
+        //Create a Task that reads all of the available data, failing on an 'x'
+        std::atomic<int> received(0);
+        AsynchTasks::Task<void> task = AsynchTasks::TaskManager::createTask<void>();
+        task->process = [&received, files]() {
+            char buffer[64];
+            for (ssize_t count; (count = read(files[0], buffer, sizeof(buffer))) > 0;) {
+                for (ssize_t i = 0; i < count; i++) {
+                    if (buffer[i] == 'x') throw std::runtime_error("Received a failure message");
+                    ++received;
+                }
+            }
+        };
+
+        //Wait for a number of bytes to be received
+        auto waitFor = [&received](int pCount) {
+            for (int i = 0; i < 1000 && received < pCount; i++) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return received.load();
+        };
+
+        //Watch the read end of the pipe
+        AsynchTasks::Reactor::watch(task, files[0], AsynchTasks::EReadiness::Readable, MODES[mode]);
+
+        //Write messages over time
+        for (int i = 0; i < 10; i++) {
+            if (write(files[1], "hello", 5) < 0) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        printf("%s: received %d of 50 bytes\n", MODE_NAMES[mode], waitFor(50));
+
+        //Fail the Task, after which the watch is disarmed
+        if (write(files[1], "x", 1) < 0) break;
+        while (task->status != AsynchTasks::ETaskStatus::Error) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (write(files[1], "hello", 5) < 0) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        printf("%s: '%s', received %d bytes while disarmed\n", MODE_NAMES[mode], task->error.value().c_str(), received.load() - 50);
+
+        //Re-arm the watch to receive the waiting data
+        AsynchTasks::Reactor::rearm(files[0]);
+        printf("%s: received %d of 55 bytes after re-arming\n\n", MODE_NAMES[mode], waitFor(55));
+
+        //Stop watching the pipe
+        AsynchTasks::Reactor::unwatch(files[0]);
+        close(files[0]);
+        close(files[1]);
+    }
+
+    //Destroy the managers
+    AsynchTasks::Reactor::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+#endif
+
+/*
+    assetStreaming - Stream a large number of assets with changing priorities, a bandwidth
+                     limit and cancellation
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void assetStreaming() {
+    //Define the number and size of the assets to stream
+    const unsigned int ASSET_COUNT = 200;
+    const unsigned int ASSET_SIZE = 512 * 1024;
+
+    //Store the bandwidth limit
+    unsigned int bandwidth;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(bandwidth, "Enter the bandwidth limit in MB/s (0 for no limit, 1,000 maximum): ");
+    } while (bandwidth > 1000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Create the assets to stream
+    printf("Creating %u assets of %u bytes...\n\n", ASSET_COUNT, ASSET_SIZE);
+    std::vector<std::string> paths(ASSET_COUNT);
+    std::vector<char> contents(ASSET_SIZE, 'A');
+    for (unsigned int i = 0; i < ASSET_COUNT; i++) {
+        //Set the name of the file
+        paths[i] = "streaming_asset_" + std::to_string(i) + ".tmp";
+
+        //Write the contents
+        FILE* file = fopen(paths[i].c_str(), "wb");
+        if (file) {
+            fwrite(contents.data(), 1, contents.size(), file);
+            fclose(file);
+        }
+    }
+
+    //Create the managers
+    if (AsynchTasks::TaskManager::create(4) && AsynchTasks::IOManager::create() &&
+        AsynchTasks::StreamingService::create((unsigned long long)bandwidth * 1024 * 1024, 64 * 1024, 8)) {
+        //Define the priorities the assets are given
+        const AsynchTasks::ETaskPriority PRIORITIES[] = { AsynchTasks::Low_Priority, AsynchTasks::Medium_Priority, AsynchTasks::High_Priority };
+
+        //Track the number of bytes that have been decoded
+        std::atomic<unsigned long long> decoded(0);
+
+        //Request all of the assets
+        std::vector<AsynchTasks::Task<void>> tasks(ASSET_COUNT);
+        for (unsigned int i = 0; i < ASSET_COUNT; i++) {
+            //Create the Task
+            tasks[i] = AsynchTasks::TaskManager::createTask<void>();
+            tasks[i]->priority = PRIORITIES[randomRange(0U, 3U)];
+
+            //Stream the asset, "decoding" by summing the chunk
+            AsynchTasks::StreamingService::stream(tasks[i], paths[i], [&](const char* pData, size_t pSize, unsigned long long) {
+                unsigned int sum = 0;
+                for (size_t j = 0; j < pSize; j++) sum += pData[j];
+                decoded += pSize;
+            });
+        }
+
+        //Loop until all of the assets have finished
+        unsigned int finished = 0;
+        while (finished < ASSET_COUNT) {
+            //Simulate the camera moving by changing the priority of random assets
+            for (unsigned int i = 0; i < 5; i++)
+                AsynchTasks::StreamingService::reprioritise(tasks[randomRange(0U, ASSET_COUNT)]->id, PRIORITIES[randomRange(0U, 3U)]);
+
+            //Cancel an asset that is no longer needed
+            AsynchTasks::StreamingService::cancel(tasks[randomRange(0U, ASSET_COUNT)]->id);
+
+            //Count the finished assets
+            finished = 0;
+            for (unsigned int i = 0; i < ASSET_COUNT; i++) {
+                if (tasks[i]->status == AsynchTasks::ETaskStatus::Completed || tasks[i]->status == AsynchTasks::ETaskStatus::Error)
+                    finished++;
+            }
+
+            //Output the current progress
+            AsynchTasks::StreamingStats stats = AsynchTasks::StreamingService::stats();
+            printf("Finished %u/%u (%llu completed, %llu cancelled), %u pending, %.2f MB/s\n", finished, ASSET_COUNT,
+                   stats.completed, stats.cancelled, stats.pending, stats.bytesPerSecond / (1024.0 * 1024.0));
+
+            //Slow main down to viewable pace
+            Sleep(250);
+        }
+
+        //Output the final stats
+        AsynchTasks::StreamingStats stats = AsynchTasks::StreamingService::stats();
+        printf("\nRead %llu bytes (%llu decoded) at an average of %.2f MB/s\n\nQueue latency by priority:\n",
+               stats.bytesRead, decoded.load(), stats.bytesPerSecond / (1024.0 * 1024.0));
+        for (auto& pair : stats.latency)
+            printf("Priority 0x%08X: %6llu requests, %10.2f ms average, %10.2f ms maximum\n", pair.first, pair.second.count, pair.second.averageMs, pair.second.maxMs);
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Streaming Service\n");
+
+    //Destroy the managers
+    AsynchTasks::StreamingService::destroy();
+    AsynchTasks::IOManager::destroy();
+    AsynchTasks::TaskManager::destroy();
+
+    //Remove the files
+    for (unsigned int i = 0; i < ASSET_COUNT; i++)
+        remove(paths[i].c_str());
+}
+
+/*
+    memoryMappedProcessing - Count the error lines in a large log file with a single Task and
+                             with the MappedFileProcessor
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void memoryMappedProcessing() {
+    //Define the name of the log file to process
+    const char* LOG_PATH = "mapped_benchmark.log";
+
+    //Store the size of the log file to create
+    unsigned int fileSize;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(fileSize, "Enter the size of the log file in MB (2,048 maximum): ");
+    } while (!fileSize || fileSize > 2048);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Create the log file, with roughly one error line in every hundred
+    printf("Creating a %u MB log file...\n\n", fileSize);
+    unsigned int expected = 0;
+    FILE* file = fopen(LOG_PATH, "wb");
+    if (!file) {
+        printf("Failed to create the log file '%s'\n", LOG_PATH);
+        return;
+    }
+    char line[64];
+    for (unsigned long long written = 0, i = 0; written < fileSize * 1024ULL * 1024ULL; i++) {
+        bool error = !randomRange(0U, 100U);
+        if (error) expected++;
+        written += fwrite(line, 1, sprintf(line, "%llu %s message\n", i, (error ? "ERROR" : "INFO")), file);
+    }
+    fclose(file);
+
+    //Define the function used to count the error lines in a range of the file
+    auto countErrors = [](const char* pBegin, const char* pEnd) -> unsigned int {
+        unsigned int count = 0;
+        for (const char* current = pBegin; current < pEnd;) {
+            //Find the end of the line
+            const char* end = (const char*)memchr(current, '\n', pEnd - current);
+            if (!end) end = pEnd;
+
+            //Check for the error label
+            const char* label = (const char*)memchr(current, ' ', end - current);
+            if (label && end - label > 5 && !memcmp(label + 1, "ERROR", 5)) count++;
+            current = end + 1;
+        }
+        return count;
+    };
+
+    //Label the different methods of processing the file
+    const char* METHOD_NAMES[] = { "Single Task (fread)", "MappedFileProcessor" };
+
+    //Test each of the methods
+    for (unsigned int method = 0; method < 2; method++) {
+        //Create the Task Manager
+        if (!AsynchTasks::TaskManager::create()) {
+            printf("Failed to create the Asynchronous Task Manager\n");
+            break;
+        }
+
+        //Create the Task to receive the count
+        unsigned int errors = 0;
+        AsynchTasks::Task<unsigned int> task = AsynchTasks::TaskManager::createTask<unsigned int>();
+        task->callback = [&](unsigned int& pCount) { errors = pCount; };
+
+        //Start timing the method
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Check if the file should be read by a single Task
+        if (!method) {
+            task->process = [&]() -> unsigned int {
+                //Open the file
+                FILE* file = fopen(LOG_PATH, "rb");
+                if (!file) throw std::runtime_error("Failed to open the log file");
+
+                //Read the file in blocks, carrying partial lines over to the next block
+                std::vector<char> buffer(1024 * 1024);
+                size_t carry = 0;
+                unsigned int count = 0;
+                while (size_t read = fread(buffer.data() + carry, 1, buffer.size() - carry, file)) {
+                    //Find the end of the last full line
+                    size_t size = carry + read;
+                    size_t end = size;
+                    while (end && buffer[end - 1] != '\n') end--;
+                    if (!end) end = size;
+
+                    //Count the errors and move the remainder to the front
+                    count += countErrors(buffer.data(), buffer.data() + end);
+                    carry = size - end;
+                    memmove(buffer.data(), buffer.data() + end, carry);
+                }
+                count += countErrors(buffer.data(), buffer.data() + carry);
+                fclose(file);
+                return count;
+            };
+            AsynchTasks::TaskManager::addTask(task);
+        }
+
+        //Otherwise process the file in parallel chunks
+        else AsynchTasks::MappedFileProcessor::process<unsigned int, unsigned int>(task, LOG_PATH, countErrors,
+            [](unsigned int& pResult, unsigned int& pChunk) { pResult += pChunk; });
+
+        //Wait for the Task to finish
+        while (task->status != AsynchTasks::ETaskStatus::Completed && task->status != AsynchTasks::ETaskStatus::Error)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        //Get the time taken
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        if (task->status == AsynchTasks::ETaskStatus::Error)
+            printf("%-24s failed: %s\n", METHOD_NAMES[method], task->error.value().c_str());
+        else printf("%-24s %10.2f ms %10.2f MB/s %10u errors (%u expected)\n", METHOD_NAMES[method], elapsed,
+                    fileSize / (elapsed / 1000.0), errors, expected);
+
+        //Destroy the Task Manager
+        AsynchTasks::TaskManager::destroy();
+    }
+
+    //Remove the log file
+    remove(LOG_PATH);
+}
+
+/*
+    writeBehind - Benchmark Tasks that write small outputs to files with blocking writes and
+                  with the WriteBehindService
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void writeBehind() {
+    //Define the number of files the Tasks write to
+    const unsigned int FILE_COUNT = 16;
+
+    //Store the number of Tasks to run
+    unsigned int taskCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(taskCount, "Enter the number of Tasks to run (100,000 maximum): ");
+    } while (!taskCount || taskCount > 100000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Set the names of the output files
+    std::string paths[FILE_COUNT];
+    for (unsigned int i = 0; i < FILE_COUNT; i++)
+        paths[i] = "write_behind_" + std::to_string(i) + ".tmp";
+
+    //Label the different methods of writing the output
+    const char* METHOD_NAMES[] = { "Blocking write in Task", "WriteBehindService" };
+
+    //Test each of the methods
+    for (unsigned int method = 0; method < 2; method++) {
+        //Remove the output of the previous method
+        for (unsigned int i = 0; i < FILE_COUNT; i++)
+            remove(paths[i].c_str());
+
+        //Create the managers
+        if (!AsynchTasks::TaskManager::create(4) || (method && !AsynchTasks::WriteBehindService::create())) {
+            printf("Failed to create the Asynchronous Task Manager\n");
+            AsynchTasks::TaskManager::destroy();
+            break;
+        }
+
+        //Store the Tasks that are writing the output
+        std::vector<AsynchTasks::Task<void>> tasks(taskCount);
+
+        //Start timing the method
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Add the Tasks
+        for (unsigned int i = 0; i < taskCount; i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<void>();
+            const std::string& path = paths[i % FILE_COUNT];
+            tasks[i]->process = [&path, i, method]() {
+                //Create the output of the Task
+                char line[64];
+                int length = sprintf(line, "Task %u finished\n", i);
+
+                //Append the output to the file
+                if (!method) {
+                    FILE* file = fopen(path.c_str(), "ab");
+                    if (!file) throw std::runtime_error("Failed to open the file " + path);
+                    fwrite(line, 1, length, file);
+                    fclose(file);
+                }
+                else AsynchTasks::WriteBehindService::write(path, AsynchTasks::IOBuffer(line, line + length));
+            };
+            AsynchTasks::TaskManager::addTask(tasks[i]);
+        }
+
+        //Wait for all of the Tasks to finish
+        for (unsigned int i = 0; i < taskCount; i++) {
+            while (tasks[i]->status != AsynchTasks::ETaskStatus::Completed && tasks[i]->status != AsynchTasks::ETaskStatus::Error)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Sync the buffered output to storage
+        if (method) {
+            //Request a sync of each file
+            AsynchTasks::Task<void> syncs[FILE_COUNT];
+            for (unsigned int i = 0; i < FILE_COUNT; i++) {
+                syncs[i] = AsynchTasks::TaskManager::createTask<void>();
+                AsynchTasks::WriteBehindService::sync(syncs[i], paths[i], true);
+            }
+
+            //Wait for the syncs to finish
+            for (unsigned int i = 0; i < FILE_COUNT; i++) {
+                while (syncs[i]->status != AsynchTasks::ETaskStatus::Completed && syncs[i]->status != AsynchTasks::ETaskStatus::Error)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                if (syncs[i]->status == AsynchTasks::ETaskStatus::Error)
+                    printf("%s\n", syncs[i]->error.value().c_str());
+            }
+        }
+
+        //Get the time taken
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        printf("%-24s %10.2f ms %12.0f Tasks/s\n", METHOD_NAMES[method], elapsed, taskCount / (elapsed / 1000.0));
+
+        //Destroy the managers
+        AsynchTasks::WriteBehindService::destroy();
+        AsynchTasks::TaskManager::destroy();
+    }
+
+    //Remove the files
+    for (unsigned int i = 0; i < FILE_COUNT; i++)
+        remove(paths[i].c_str());
+}
+
+//! Label the kinds of Task that are executed by the process pool
+enum : AsynchTasks::taskKind { Checksum_Kind = 1, Crash_Kind };
+
+/*
+    registerProcessKinds - Register the kinds executed by the process pool
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    Note:
+    Called at the start of main, as the worker processes run this executable and need the same kinds
+*/
+void registerProcessKinds() {
+    AsynchTasks::TaskRegistry::registerKind(Checksum_Kind, "Checksum", [](const char* pData, size_t pSize) {
+        unsigned int checksum = 0;
+        for (size_t i = 0; i < pSize; i++) checksum = checksum * 31 + (unsigned char)pData[i];
+        return AsynchTasks::IOBuffer((const char*)&checksum, (const char*)&checksum + sizeof(checksum));
+    });
+    AsynchTasks::TaskRegistry::registerKind(Crash_Kind, "Crash", [](const char*, size_t) -> AsynchTasks::IOBuffer {
+        abort();
+    });
+}
+
+/*
+    processPool - Process serialisable Tasks on worker processes, some of which crash
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void processPool() {
+    //Store the number of Tasks to run
+    unsigned int taskCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(taskCount, "Enter the number of Tasks to run (100,000 maximum): ");
+    } while (!taskCount || taskCount > 100000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Create the managers (the kinds were registered at the start of main)
+    if (AsynchTasks::TaskManager::create(4) && AsynchTasks::ProcessPool::create(4)) {
+        //Store the Tasks that are being processed
+        std::vector<AsynchTasks::Task<AsynchTasks::IOBuffer>> tasks(taskCount);
+
+        //Start timing the Tasks
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Submit the Tasks, crashing roughly one in every thousand
+        AsynchTasks::IOBuffer payload(1024);
+        for (unsigned int i = 0; i < taskCount; i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<AsynchTasks::IOBuffer>();
+            for (char& value : payload) value = (char)randomRange(0, 256);
+            AsynchTasks::ProcessPool::submit(tasks[i], (randomRange(0U, 1000U) ? Checksum_Kind : Crash_Kind), payload);
+        }
+
+        //Wait for all of the Tasks to finish
+        unsigned int completed = 0, failed = 0;
+        while (completed + failed < taskCount) {
+            //Count the finished Tasks
+            completed = failed = 0;
+            for (unsigned int i = 0; i < taskCount; i++) {
+                if (tasks[i]->status == AsynchTasks::ETaskStatus::Completed) completed++;
+                else if (tasks[i]->status == AsynchTasks::ETaskStatus::Error) failed++;
+            }
+
+            //Give the worker processes time to process
+            if (completed + failed < taskCount) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Get the time taken
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        printf("Processed %u Tasks in %.2f ms (%u completed, %u failed, %u process restarts)\n\n", taskCount, elapsed,
+               completed, failed, AsynchTasks::ProcessPool::restarts());
+        for (unsigned int i = 0, shown = 0; i < taskCount && shown < 5; i++) {
+            if (tasks[i]->status == AsynchTasks::ETaskStatus::Error) {
+                printf("Task %u: %s\n", i, tasks[i]->error.value().c_str());
+                shown++;
+            }
+        }
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Process Pool\n");
+
+    //Destroy the managers
+    AsynchTasks::ProcessPool::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    remoteExecution - Process serialisable Tasks on a RemoteNode running on the loopback interface
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void remoteExecution() {
+    //Label the kinds of Task that are used
+    enum : AsynchTasks::taskKind { Sum_Kind = 10 };
+
+    //Store the address the node listens on
+    const char* const ADDRESS = "tcp:127.0.0.1:7878";
+
+    //Store the number of Tasks to run
+    unsigned int taskCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(taskCount, "Enter the number of Tasks to run (100,000 maximum): ");
+    } while (!taskCount || taskCount > 100000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Register the kind processed by the node
+    AsynchTasks::TaskRegistry::registerKind(Sum_Kind, "Sum", [](const char* pData, size_t pSize) {
+        unsigned long long sum = 0;
+        for (size_t i = 0; i < pSize; i++) sum += (unsigned char)pData[i];
+        return AsynchTasks::IOBuffer((const char*)&sum, (const char*)&sum + sizeof(sum));
+    });
+
+    //Create the Task Manager, shared by the node and the executor
+    if (AsynchTasks::TaskManager::create(4)) {
+        //Start the node on a separate thread
+        std::atomic_bool stop(false);
+        std::thread node([&]() { AsynchTasks::RemoteNode::serve(ADDRESS, 256, &stop); });
+
+        //Give the node time to start listening
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        //Connect to the node
+        if (AsynchTasks::RemoteExecutor::create(ADDRESS)) {
+            //Store the Tasks that are being processed
+            std::vector<AsynchTasks::Task<AsynchTasks::IOBuffer>> tasks(taskCount);
+
+            //Start timing the Tasks
+            auto start = std::chrono::high_resolution_clock::now();
+
+            //Submit the Tasks
+            AsynchTasks::IOBuffer payload(64);
+            for (unsigned int i = 0; i < taskCount; i++) {
+                tasks[i] = AsynchTasks::TaskManager::createTask<AsynchTasks::IOBuffer>();
+                for (char& value : payload) value = (char)randomRange(0, 256);
+                AsynchTasks::RemoteExecutor::submit(tasks[i], Sum_Kind, payload);
+            }
+
+            //Wait for all of the Tasks to finish
+            unsigned int completed = 0, failed = 0;
+            while (completed + failed < taskCount) {
+                //Count the finished Tasks
+                completed = failed = 0;
+                for (unsigned int i = 0; i < taskCount; i++) {
+                    if (tasks[i]->status == AsynchTasks::ETaskStatus::Completed) completed++;
+                    else if (tasks[i]->status == AsynchTasks::ETaskStatus::Error) failed++;
+                }
+
+                //Give the node time to process
+                if (completed + failed < taskCount) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            //Get the time taken
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+            //Output the results
+            AsynchTasks::RemoteStats stats = AsynchTasks::RemoteExecutor::stats();
+            printf("Processed %u Tasks in %.2f ms (%u completed, %u failed)\n", taskCount, elapsed, completed, failed);
+            printf("Sent %llu Tasks in %llu frames (%.2f Tasks per frame)\n", stats.tasksSent, stats.framesSent,
+                   (stats.framesSent ? (double)stats.tasksSent / stats.framesSent : 0.0));
+        }
+
+        //Display error message
+        else printf("Failed to connect to the Remote Node at %s\n", ADDRESS);
+
+        //Stop the node
+        AsynchTasks::RemoteExecutor::destroy();
+        stop = true;
+        node.join();
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Task Manager\n");
+
+    //Destroy the manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    taskJournal - Compare the cost of submitting Tasks with and without the journal, leaving
+                  some Tasks pending to be replayed the next time the test is run
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void taskJournal() {
+    //Label the kinds of Task that are used
+    enum : AsynchTasks::taskKind { Hash_Kind = 20 };
+
+    //Store the path of the journal
+    const char* const JOURNAL_PATH = "TaskJournal.log";
+
+    //Store the number of Tasks submitted in each batch and left pending
+    const unsigned int BATCH_SIZE = 64, PENDING_COUNT = 100;
+
+    //Store the number of Tasks to run
+    unsigned int taskCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(taskCount, "Enter the number of Tasks to run (1,000,000 maximum): ");
+    } while (!taskCount || taskCount > 1000000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Register the kind before the journal replays it
+    AsynchTasks::TaskRegistry::registerKind(Hash_Kind, "Hash", [](const char* pData, size_t pSize) {
+        unsigned int hash = 2166136261u;
+        for (size_t i = 0; i < pSize; i++) hash = (hash ^ (unsigned char)pData[i]) * 16777619u;
+        return AsynchTasks::IOBuffer((const char*)&hash, (const char*)&hash + sizeof(hash));
+    });
+
+    //Create the managers
+    std::atomic_uint replayed(0);
+    if (AsynchTasks::TaskManager::create(4) && AsynchTasks::TaskJournal::create(JOURNAL_PATH, [&](AsynchTasks::Task<AsynchTasks::IOBuffer>& pTask, AsynchTasks::taskKind) {
+        pTask->callback = [&](AsynchTasks::IOBuffer&) { ++replayed; };
+    })) {
+        //Wait for the replayed Tasks to finish
+        printf("Replaying %zu Tasks left pending by the previous run\n", AsynchTasks::TaskJournal::pending());
+        while (AsynchTasks::TaskJournal::pending()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        printf("Replayed %u Tasks\n\n", replayed.load());
+
+        //Store the time spent submitting the Tasks with each method
+        double elapsed[2] = { 0.0, 0.0 };
+
+        //Submit the Tasks in batches, alternating between the methods
+        AsynchTasks::IOBuffer payload(64);
+        for (unsigned int submitted = 0; submitted < taskCount; submitted += BATCH_SIZE) {
+            for (unsigned int method = 0; method < 2; method++) {
+                //Create the Tasks of the batch
+                std::vector<AsynchTasks::Task<AsynchTasks::IOBuffer>> tasks(std::min(BATCH_SIZE, taskCount - submitted));
+                for (auto& task : tasks) task = AsynchTasks::TaskManager::createTask<AsynchTasks::IOBuffer>();
+
+                //Time the submission of the batch
+                auto start = std::chrono::high_resolution_clock::now();
+                for (auto& task : tasks) {
+                    if (method) AsynchTasks::TaskJournal::submit(task, Hash_Kind, payload);
+                    else AsynchTasks::TaskRegistry::addTask(task, Hash_Kind, payload);
+                }
+                elapsed[method] += std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+
+                //Wait for the batch to finish so that both methods see the same queue
+                while (tasks.back()->status != AsynchTasks::ETaskStatus::Completed &&
+                       tasks.back()->status != AsynchTasks::ETaskStatus::Error)
+                    std::this_thread::yield();
+            }
+        }
+
+        //Time committing the journal to disk
+        auto start = std::chrono::high_resolution_clock::now();
+        AsynchTasks::TaskJournal::flush();
+        double flushTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        printf("Submitting without the journal: %.3f us per Task\n", elapsed[0] / taskCount);
+        printf("Submitting with the journal:    %.3f us per Task (%.3f us overhead)\n", elapsed[1] / taskCount, (elapsed[1] - elapsed[0]) / taskCount);
+        printf("Final commit took %.3f ms\n\n", flushTime);
+
+        //Leave Tasks pending by closing the journal while they are still queued
+        std::vector<AsynchTasks::Task<AsynchTasks::IOBuffer>> pending(PENDING_COUNT);
+        for (auto& task : pending) {
+            task = AsynchTasks::TaskManager::createTask<AsynchTasks::IOBuffer>();
+            AsynchTasks::TaskJournal::submit(task, Hash_Kind, payload);
+        }
+        printf("Closed the journal with %zu Tasks pending, run the test again to replay them\n", AsynchTasks::TaskJournal::pending());
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Task Journal\n");
+
+    //Destroy the managers
+    AsynchTasks::TaskJournal::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    spillQueue - Queue more Tasks than the memory budget allows, spilling the rest to disk
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void spillQueue() {
+    //Label the kinds of Task that are used
+    enum : AsynchTasks::taskKind { Sequence_Kind = 30 };
+
+    //Store the memory budget of the queue
+    const size_t MEMORY_BUDGET = 1024 * 1024;
+
+    //Store the number of Tasks to run
+    unsigned int taskCount;
+
+    //Loop until valid input
+    do {
+        //Clear the screen
+        system("CLS");
+
+        //Display prompt to the user
+        getInput(taskCount, "Enter the number of Tasks to run (1,000,000 maximum): ");
+    } while (!taskCount || taskCount > 1000000);
+
+    //Add some space on screen
+    printf("\n\n\n");
+
+    //Register a kind that returns the sequence number stored at the start of the payload
+    AsynchTasks::TaskRegistry::registerKind(Sequence_Kind, "Sequence", [](const char* pData, size_t) {
+        return AsynchTasks::IOBuffer(pData, pData + sizeof(unsigned int));
+    });
+
+    //Track the order the Tasks are completed in
+    std::mutex orderLock;
+    unsigned int completed = 0, outOfOrder = 0, lastSequence = 0;
+
+    //Create the managers
+    //A single Worker is used so that the completion order matches the dispatch order
+    if (AsynchTasks::TaskManager::create(1) && AsynchTasks::SpillQueue::create(".", MEMORY_BUDGET, [&](AsynchTasks::Task<AsynchTasks::IOBuffer>& pTask, AsynchTasks::taskKind) {
+        //Check the Tasks are dispatched in the order they were submitted
+        pTask->callback = [&](AsynchTasks::IOBuffer& pResult) {
+            unsigned int sequence;
+            memcpy(&sequence, pResult.data(), sizeof(sequence));
+            std::lock_guard<std::mutex> guard(orderLock);
+            if (completed++ && sequence < lastSequence) outOfOrder++;
+            lastSequence = std::max(lastSequence, sequence);
+        };
+    })) {
+        //Start timing the Tasks
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Submit the Tasks with 1KB payloads
+        size_t peakSpilled = 0;
+        AsynchTasks::IOBuffer payload(1024);
+        for (unsigned int i = 0; i < taskCount; i++) {
+            memcpy(payload.data(), &i, sizeof(i));
+            AsynchTasks::SpillQueue::submit(Sequence_Kind, payload);
+            peakSpilled = std::max(peakSpilled, AsynchTasks::SpillQueue::spilled());
+        }
+
+        //Wait for all of the Tasks to finish
+        while (AsynchTasks::SpillQueue::pending()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        //Get the time taken
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        //Output the results
+        std::lock_guard<std::mutex> guard(orderLock);
+        printf("Processed %u Tasks in %.2f ms with a %zu KB memory budget\n", taskCount, elapsed, MEMORY_BUDGET / 1024);
+        printf("Up to %zu Tasks (%.2f MB) were spilled to disk\n", peakSpilled, peakSpilled * (payload.size() + 8) / (1024.0 * 1024.0));
+        printf("%u of %u Tasks were dispatched out of submission order\n", outOfOrder, completed);
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Spill Queue\n");
+
+    //Destroy the managers
+    AsynchTasks::SpillQueue::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    rateLimiting - Dispatch Tasks of two classes under different rate limits
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void rateLimiting() {
+    //Label the classes of Task that are used
+    enum : AsynchTasks::taskClass { Slow_Class, Fast_Class, CLASS_COUNT };
+
+    //Store the limits of the classes (Tasks per second)
+    const double RATES[CLASS_COUNT] = { 50.0, 200.0 };
+
+    //Store the number of Tasks of each class
+    const unsigned int TASK_COUNT = 200;
+
+    //Create the managers
+    if (AsynchTasks::TaskManager::create(4) && AsynchTasks::RateLimiter::create()) {
+        //Set the limits, allowing a burst of 10 Tasks
+        for (unsigned int i = 0; i < CLASS_COUNT; i++)
+            AsynchTasks::RateLimiter::setLimit(i, RATES[i], 10.0);
+
+        //Store the Tasks and the time they started
+        std::vector<AsynchTasks::Task<void>> tasks(TASK_COUNT * CLASS_COUNT);
+        std::vector<double> started(tasks.size());
+
+        //Start timing the Tasks
+        auto start = std::chrono::high_resolution_clock::now();
+
+        //Add the Tasks of both classes
+        for (unsigned int i = 0; i < tasks.size(); i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<void>();
+            tasks[i]->process = [&, i]() { started[i] = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count(); };
+            AsynchTasks::RateLimiter::addTask(tasks[i], i % CLASS_COUNT);
+        }
+
+        //Show the Tasks held by the limiter
+        printf("Held Tasks: Slow %zu, Fast %zu\n\n", AsynchTasks::RateLimiter::held(Slow_Class), AsynchTasks::RateLimiter::held(Fast_Class));
+
+        //Wait for all of the Tasks to finish
+        for (auto& task : tasks) {
+            while (task->status != AsynchTasks::ETaskStatus::Completed)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Output the rate achieved by each class
+        for (unsigned int i = 0; i < CLASS_COUNT; i++) {
+            double last = 0.0;
+            for (unsigned int j = i; j < tasks.size(); j += CLASS_COUNT) last = std::max(last, started[j]);
+            printf("%s class: %u Tasks started over %.3f seconds (%.1f per second, limit %.1f plus a burst of 10)\n",
+                   (i == Slow_Class ? "Slow" : "Fast"), TASK_COUNT, last, (TASK_COUNT - 10) / last, RATES[i]);
+        }
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Rate Limiter\n");
+
+    //Destroy the managers
+    AsynchTasks::RateLimiter::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    automaticRetry - Retry Tasks that fail intermittently with an exponential backoff
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void automaticRetry() {
+    //Store the number of Tasks to run
+    const unsigned int TASK_COUNT = 100;
+
+    //Create the Task Manager
+    if (AsynchTasks::TaskManager::create(4)) {
+        //Setup a policy that retries runtime errors up to five times
+        AsynchTasks::RetryPolicy policy;
+        policy.maxAttempts = 5;
+        policy.baseDelay = std::chrono::milliseconds(5);
+        policy.maxDelay = std::chrono::milliseconds(100);
+        policy.retryable = AsynchTasks::RetryPolicy::only<std::runtime_error>();
+
+        //Create the Tasks, each failing half of the time
+        std::vector<AsynchTasks::Task<unsigned int>> tasks(TASK_COUNT);
+        for (unsigned int i = 0; i < TASK_COUNT; i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<unsigned int>();
+            tasks[i]->process = [i]() {
+                if (randomRange(0U, 2U)) throw std::runtime_error("The connection was reset");
+                return i;
+            };
+            tasks[i]->retryPolicy = policy;
+            AsynchTasks::TaskManager::addTask(tasks[i]);
+        }
+
+        //Wait for all of the Tasks to finish
+        for (auto& task : tasks) {
+            while (task->status != AsynchTasks::ETaskStatus::Completed && task->status != AsynchTasks::ETaskStatus::Error)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Count the Tasks that finished on each attempt
+        unsigned int attempts[6] = { 0 };
+        unsigned int failed = 0;
+        for (auto& task : tasks) {
+            if (task->status == AsynchTasks::ETaskStatus::Error) ++failed;
+            else ++attempts[task->retries + 1];
+        }
+
+        //Output the results
+        for (unsigned int i = 1; i <= policy.maxAttempts; i++)
+            printf("Completed on attempt %u: %u\n", i, attempts[i]);
+        AsynchTasks::TaskMetrics metrics = AsynchTasks::TaskManager::metrics();
+        printf("\nFailed after %u attempts: %u\nRetries: %llu (%llu Tasks exhausted their attempts)\n", 
+               policy.maxAttempts, failed, metrics.retries, metrics.retriesExhausted);
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Task Manager\n");
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    incrementalComputation - Recompute only the derived values whose inputs changed
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void incrementalComputation() {
+    //Store the number of regions with sales figures
+    const unsigned int REGION_COUNT = 8;
+
+    //Count the number of times the derived values are computed
+    std::atomic<unsigned int> computed(0);
+
+    //Create the managers
+    if (AsynchTasks::TaskManager::create(4) && AsynchTasks::IncrementalGraph::create()) {
+        //Create the tax rate shared by the regions
+        AsynchTasks::Cell<float> taxRate = AsynchTasks::IncrementalGraph::createInput(0.1f);
+
+        //Create the sales of each region and the total after tax
+        std::vector<AsynchTasks::Cell<std::vector<float>>> sales;
+        std::vector<AsynchTasks::Cell<float>> totals;
+        for (unsigned int i = 0; i < REGION_COUNT; i++) {
+            sales.push_back(AsynchTasks::IncrementalGraph::createInput(std::vector<float>(100000, (float)(i + 1))));
+            totals.push_back(AsynchTasks::IncrementalGraph::createDerived<float>([&](const std::vector<float>& pSales, const float& pRate) {
+                ++computed;
+                float total = 0.f;
+                for (float sale : pSales) total += sale;
+                return total * (1.f - pRate);
+            }, sales.back(), taxRate));
+        }
+
+        //Create the total of the first and second half of the regions
+        AsynchTasks::Cell<float> halves[2];
+        for (unsigned int h = 0; h < 2; h++) {
+            unsigned int first = h * REGION_COUNT / 2;
+            halves[h] = AsynchTasks::IncrementalGraph::createDerived<float>([&](const float& pA, const float& pB, const float& pC, const float& pD) {
+                ++computed;
+                return pA + pB + pC + pD;
+            }, totals[first], totals[first + 1], totals[first + 2], totals[first + 3]);
+        }
+
+        //Create the overall total
+        AsynchTasks::Cell<float> overall = AsynchTasks::IncrementalGraph::createDerived<float>([&](const float& pFirst, const float& pSecond) {
+            ++computed;
+            return pFirst + pSecond;
+        }, halves[0], halves[1]);
+
+        //Output the overall total after each change
+        auto report = [&](const char* pChange) {
+            AsynchTasks::IncrementalGraph::wait();
+            printf("%-40s Overall total %.0f (version %llu), %u cells computed\n", pChange, *AsynchTasks::IncrementalGraph::value(overall), AsynchTasks::IncrementalGraph::version(overall), computed.exchange(0));
+        };
+        report("Initial computation:");
+
+        //Change the sales of a single region
+        AsynchTasks::IncrementalGraph::setInput(sales[5], std::vector<float>(100000, 2.f));
+        report("Changed the sales of region 6:");
+
+        //Set the sales of a region to the same value
+        AsynchTasks::IncrementalGraph::setInput(sales[2], std::vector<float>(100000, 3.f));
+        report("Set region 3 to the same sales:");
+
+        //Change the tax rate used by all regions
+        AsynchTasks::IncrementalGraph::setInput(taxRate, 0.2f);
+        report("Changed the tax rate:");
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Incremental Graph\n");
+
+    //Destroy the managers
+    AsynchTasks::IncrementalGraph::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    schedulerIntrospection - Display snapshots of the Task Manager while it is busy
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void schedulerIntrospection() {
+    //Store the number of Tasks to run
+    const unsigned int TASK_COUNT = 40;
+
+    //Create the Task Manager
+    if (AsynchTasks::TaskManager::create(4)) {
+        //Store the priorities to give the Tasks
+        const AsynchTasks::ETaskPriority PRIORITIES[] = { AsynchTasks::Low_Priority, AsynchTasks::Medium_Priority, AsynchTasks::High_Priority };
+
+        //Add Tasks that take different lengths of time
+        std::vector<AsynchTasks::Task<void>> tasks(TASK_COUNT);
+        for (unsigned int i = 0; i < TASK_COUNT; i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<void>();
+            tasks[i]->priority = PRIORITIES[i % 3];
+            tasks[i]->callbackOnUpdate = (i % 4 == 0);
+            tasks[i]->process = []() { std::this_thread::sleep_for(std::chrono::milliseconds(randomRange(20U, 100U))); };
+            AsynchTasks::TaskManager::addTask(tasks[i]);
+        }
+
+        //Display a snapshot while the Tasks are processed
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        printf("%s\n", AsynchTasks::Introspection::toText(AsynchTasks::Introspection::capture(), 3).c_str());
+
+        //Wait for the Tasks to be processed
+        for (auto& task : tasks) {
+            while (task->status == AsynchTasks::ETaskStatus::Pending || task->status == AsynchTasks::ETaskStatus::In_Progress)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        //Display the metrics in the Prometheus format
+        printf("%s\n", AsynchTasks::Introspection::toPrometheus(AsynchTasks::Introspection::capture()).c_str());
+
+        //Complete the callbacks waiting for update
+        while (AsynchTasks::Introspection::capture().callbacks.size()) AsynchTasks::TaskManager::update();
+    }
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Task Manager\n");
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    schedulerSimulation - Predict the latency of a workload and validate it against a real run
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void schedulerSimulation() {
+    //Describe the workload, a fifth of the Tasks being high priority
+    AsynchTasks::SimulatedWorkload workload;
+    workload.taskCount = 1000;
+    workload.arrivalRate = 300.0;
+    workload.serviceTime = AsynchTasks::Distribution::exponential(0.005);
+    workload.priorityMix = { { AsynchTasks::High_Priority, 0.2 }, { AsynchTasks::Low_Priority, 0.8 } };
+
+    //Predict the latency for different numbers of Workers
+    for (unsigned int workers = 1; workers <= 4; workers *= 2) {
+        workload.workers = workers;
+        printf("Predicted: %s\n", AsynchTasks::SchedulerSimulator::toText(AsynchTasks::SchedulerSimulator::simulate(workload)).c_str());
+    }
+
+    //Run the same workload on the Task Manager to validate the prediction
+    if (AsynchTasks::TaskManager::create(workload.workers))
+        printf("Measured: %s\n", AsynchTasks::SchedulerSimulator::toText(AsynchTasks::SchedulerSimulator::measure(workload)).c_str());
+
+    //Display error message
+    else printf("Failed to create the Asynchronous Task Manager\n");
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    traceReplay - Record the Tasks of a live Task Manager and replay the trace at different speeds
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void traceReplay() {
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Start recording the processed Tasks
+    if (!AsynchTasks::TraceRecorder::create("trace.atrc")) {
+        printf("Failed to create the Trace Recorder\n");
+        AsynchTasks::TaskManager::destroy();
+        return;
+    }
+
+    //Submit a mix of short and long Tasks, some with callbacks on update and some failing
+    std::vector<AsynchTasks::Task<void>> tasks(400);
+    for (size_t i = 0; i < tasks.size(); i++) {
+        tasks[i] = AsynchTasks::TaskManager::createTask<void>();
+        if (randomRange(0, 5)) tasks[i]->process = []() { std::this_thread::sleep_for(std::chrono::microseconds(500)); };
+        else {
+            tasks[i]->priority = AsynchTasks::High_Priority;
+            tasks[i]->process = [i]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(4));
+                if (i % 50 == 0) throw std::runtime_error("Failed to process");
+            };
+        }
+        tasks[i]->callbackOnUpdate = (i % 3 == 0);
+        AsynchTasks::TaskManager::addTask(tasks[i]);
+        AsynchTasks::TaskManager::update();
+        std::this_thread::sleep_for(std::chrono::microseconds(randomRange(0, 4000)));
+    }
+
+    //Wait for the Tasks to finish
+    for (auto& task : tasks) {
+        while (task->status != AsynchTasks::ETaskStatus::Completed && task->status != AsynchTasks::ETaskStatus::Error) {
+            AsynchTasks::TaskManager::update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    //Stop recording
+    AsynchTasks::TraceRecorder::destroy();
+
+    //Load the trace
+    AsynchTasks::TaskTrace trace;
+    if (AsynchTasks::TraceReplayer::load("trace.atrc", trace)) {
+        //Output the kinds recorded
+        printf("Recorded %zu Tasks of %zu kinds\n", trace.events.size(), trace.kinds.size());
+        for (size_t i = 0; i < trace.kinds.size(); i++) {
+            unsigned int count = 0;
+            double runTime = 0.0;
+            for (auto& event : trace.events) if (event.kind == i) ++count, runTime += event.runTime;
+            printf("  %-60s %4u Tasks, mean run time %.3fms\n", trace.kinds[i].c_str(), count, runTime / count * 1000.0);
+        }
+
+        //Replay the trace as recorded and with the arrivals twice as fast
+        printf("Replayed: %s\n", AsynchTasks::SchedulerSimulator::toText(AsynchTasks::TraceReplayer::replay(trace)).c_str());
+        printf("Replayed at double speed: %s\n", AsynchTasks::SchedulerSimulator::toText(AsynchTasks::TraceReplayer::replay(trace, 2.0)).c_str());
+    }
+
+    //Display error message
+    else printf("Failed to load the trace\n");
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    policyWorkerPool - Compare the throughput of the Task Manager with policy based worker pools
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+template<class Manager>
+double policyThroughput(unsigned int pCount) {
+    //Create the Tasks ahead of time so that creation isn't measured
+    std::vector<typename Manager::template Task<int>> tasks(pCount);
+    std::atomic<unsigned int> total(0);
+    for (unsigned int i = 0; i < pCount; i++) {
+        tasks[i] = Manager::template createTask<int>();
+        tasks[i]->process = [i]() { return (int)(i % 7); };
+        tasks[i]->callback = [&total](int& pValue) { total += pValue; };
+    }
+
+    //Add the Tasks and wait for them to finish
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (auto& task : tasks) Manager::addTask(task);
+    for (auto& task : tasks) {
+        while (task->status() != AsynchTasks::ETaskStatus::Completed && task->status() != AsynchTasks::ETaskStatus::Error)
+            std::this_thread::yield();
+    }
+    return (double)pCount / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void policyWorkerPool() {
+    //Define a lean pool without priorities, update callbacks, metrics or error messages
+    typedef AsynchTasks::PolicyWorkerPool<AsynchTasks::Policies::FifoQueue, AsynchTasks::Policies::SleepWhenInactive<>,
+        AsynchTasks::Policies::WorkerCallbacks, AsynchTasks::Policies::Uninstrumented, AsynchTasks::Policies::CatchErrors> LeanPool;
+    typedef AsynchTasks::PolicyWorkerPool<> DefaultPool;
+    const unsigned int count = 20000;
+
+    //Measure the Task Manager
+    if (AsynchTasks::TaskManager::create(4)) {
+        std::vector<AsynchTasks::Task<int>> tasks(count);
+        for (unsigned int i = 0; i < count; i++) {
+            tasks[i] = AsynchTasks::TaskManager::createTask<int>();
+            tasks[i]->process = [i]() { return (int)(i % 7); };
+        }
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (auto& task : tasks) AsynchTasks::TaskManager::addTask(task);
+        for (auto& task : tasks) {
+            while (task->status != AsynchTasks::ETaskStatus::Completed && task->status != AsynchTasks::ETaskStatus::Error)
+                std::this_thread::yield();
+        }
+        printf("TaskManager:                %10.0f Tasks per second\n", (double)count / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        AsynchTasks::TaskManager::destroy();
+    }
+
+    //Measure the default policies, which keep the Task features of the Task Manager
+    if (DefaultPool::create(4)) {
+        printf("PolicyWorkerPool<>:         %10.0f Tasks per second\n", policyThroughput<DefaultPool>(count));
+        printf("  Metrics: %llu queued, %llu completed\n", DefaultPool::metrics().tasksQueued, DefaultPool::metrics().tasksCompleted);
+        DefaultPool::destroy();
+    }
+
+    //Measure the lean policies
+    if (LeanPool::create(4)) {
+        printf("Lean PolicyWorkerPool:      %10.0f Tasks per second\n", policyThroughput<LeanPool>(count));
+        printf("  Task size %zu bytes, default Task size %zu bytes\n", sizeof(*LeanPool::createTask<int>()), sizeof(*DefaultPool::createTask<int>()));
+        LeanPool::destroy();
+    }
+}
+
+/*
+    closedTaskTypes - Compare switch dispatched Tasks of a closed set of types with virtual dispatch
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+std::atomic<unsigned long long> gClosedTotal(0);
+struct SumTask { unsigned int value; void operator()() { gClosedTotal.fetch_add(value % 7, std::memory_order_relaxed); } };
+struct ScaleTask { unsigned int value; unsigned int scale; void operator()() { gClosedTotal.fetch_add((value * scale) % 5, std::memory_order_relaxed); } };
+
+void closedTaskTypes() {
+    //Define the closed Task Manager and a worker pool with the same queue and idle policies
+    typedef AsynchTasks::ClosedTaskManager<AsynchTasks::TaskTypes<SumTask, ScaleTask>, AsynchTasks::Policies::FifoQueue> ClosedManager;
+    typedef AsynchTasks::PolicyWorkerPool<AsynchTasks::Policies::FifoQueue, AsynchTasks::Policies::BlockingIdle,
+        AsynchTasks::Policies::WorkerCallbacks, AsynchTasks::Policies::Uninstrumented, AsynchTasks::Policies::CatchErrors> VirtualManager;
+    const unsigned int count = 200000;
+
+    //Measure the Tasks through virtual functions and std::function
+    if (VirtualManager::create(4)) {
+        gClosedTotal = 0;
+        std::vector<VirtualManager::Task<void>> tasks(count);
+        for (unsigned int i = 0; i < count; i++) {
+            tasks[i] = VirtualManager::createTask<void>();
+            if (i % 2) tasks[i]->process = SumTask{ i };
+            else tasks[i]->process = ScaleTask{ i, 3 };
+        }
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (auto& task : tasks) VirtualManager::addTask(task);
+        for (auto& task : tasks) while (task->status() != AsynchTasks::ETaskStatus::Completed) std::this_thread::yield();
+        printf("Virtual dispatch: %10.0f Tasks per second (total %llu)\n", (double)count / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), gClosedTotal.load());
+        VirtualManager::destroy();
+    }
+
+    //Measure the closed set of Task types, created as they are added
+    if (ClosedManager::create(4)) {
+        gClosedTotal = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < count; i++) {
+            if (i % 2) ClosedManager::addTask(SumTask{ i });
+            else ClosedManager::addTask(ScaleTask{ i, 3 });
+        }
+        ClosedManager::wait();
+        printf("Switch dispatch:  %10.0f Tasks per second (total %llu)\n", (double)count / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), gClosedTotal.load());
+        printf("  Each Task is %zu bytes in the queue\n", sizeof(ClosedManager::Task));
+        ClosedManager::destroy();
+    }
+}
+
+/*
+    boundArguments - Create Tasks that call one function with different arguments stored in the Tasks
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+unsigned long long countCharacter(std::string pText, char pCharacter, unsigned int pRepeat) {
+    unsigned long long count = 0;
+    for (unsigned int i = 0; i < pRepeat; i++) count += std::count(pText.begin(), pText.end(), pCharacter);
+    return count;
+}
+
+void boundArguments() {
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Create a Task for each line, the text is moved into the Task and then into the function
+    const char* lines[] = { "the quick brown fox", "jumps over the lazy dog", "pack my box with five dozen liquor jugs" };
+    std::vector<AsynchTasks::Task<unsigned long long>> tasks;
+    std::atomic<unsigned long long> total(0);
+    for (unsigned int i = 0; i < 1000; i++) {
+        tasks.push_back(AsynchTasks::TaskManager::createTask(countCharacter, std::string(lines[i % 3]), 'o', 100u));
+        tasks.back()->callback = [&total](unsigned long long& pCount) { total += pCount; };
+        AsynchTasks::TaskManager::addTask(tasks.back());
+    }
+
+    //Wait for the Tasks to finish
+    for (auto& task : tasks) {
+        while (task->status != AsynchTasks::ETaskStatus::Completed && task->status != AsynchTasks::ETaskStatus::Error)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    //Output the result
+    printf("Counted %llu 'o' characters over %zu Tasks\n", total.load(), tasks.size());
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    fireAndForget - Compare the cost of submitting jobs with run against full Task objects
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void fireAndForget() {
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Count the finished jobs
+    const unsigned int count = 5000;
+    std::atomic<unsigned int> finished(0);
+
+    //Measure the time to submit the jobs and for them to finish
+    auto measure = [&](const char* pLabel, const std::function<void()>& pSubmit) {
+        finished = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        pSubmit();
+        const double submitted = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        while (finished < count) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("%-28s submit %8.1fns per job, finished in %.3fs\n", pLabel, submitted / count * 1e9, total);
+    };
+
+    //Submit full Task objects
+    std::vector<AsynchTasks::Task<void>> tasks;
+    measure("createTask and addTask:", [&]() {
+        for (unsigned int i = 0; i < count; i++) {
+            tasks.push_back(AsynchTasks::TaskManager::createTask<void>());
+            tasks.back()->process = [&finished]() { ++finished; };
+            AsynchTasks::TaskManager::addTask(tasks.back());
+        }
+    });
+
+    //Submit fire and forget jobs, the second time reusing the pooled job records
+    measure("run:", [&]() { for (unsigned int i = 0; i < count; i++) AsynchTasks::TaskManager::run([&finished]() { ++finished; }); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    measure("run (pooled jobs):", [&]() { for (unsigned int i = 0; i < count; i++) AsynchTasks::TaskManager::run([&finished]() { ++finished; }); });
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    lazySources - Process a range of indices and a generated sequence through Task sources
+                  that keep a fixed number of jobs in flight
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void lazySources() {
+    //Create the Task Manager and source
+    if (!AsynchTasks::TaskManager::create(4) || !AsynchTasks::TaskSource::create()) {
+        printf("Failed to create the Asynchronous Task Manager and Task Source\n");
+        AsynchTasks::TaskManager::destroy();
+        return;
+    }
+
+    //Sum the squares of a range of indices without creating a Task for each index
+    const unsigned long long count = 10000;
+    std::atomic<unsigned long long> total(0);
+    AsynchTasks::sourceID squares = AsynchTasks::TaskSource::range(count, [&total](unsigned long long pIndex) { total += pIndex * pIndex; });
+
+    //Generate the Collatz sequence of a number, failing the odd steps
+    unsigned long long value = 27;
+    AsynchTasks::sourceID collatz = AsynchTasks::TaskSource::add([&value](std::function<void()>& pProcess) {
+        if (value == 1) return false;
+        const bool odd = (value % 2 == 1);
+        value = (odd ? value * 3 + 1 : value / 2);
+        pProcess = [odd]() { if (odd) throw std::runtime_error("Odd step"); };
+        return true;
+    }, 2, AsynchTasks::High_Priority);
+
+    //Output the progress of the range while it is processed
+    AsynchTasks::SourceProgress progress;
+    while (!(progress = AsynchTasks::TaskSource::progress(squares)).finished) {
+        printf("Generated %llu of %llu, %u in flight\n", progress.produced, count, progress.inFlight);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    //Output the results
+    progress = AsynchTasks::TaskSource::wait(squares);
+    printf("Sum of squares below %llu is %llu (expected %llu) over %llu jobs\n", count, total.load(), (count - 1) * count * (2 * count - 1) / 6, progress.produced);
+    progress = AsynchTasks::TaskSource::wait(collatz);
+    printf("Collatz sequence of 27 took %llu steps with %llu odd steps\n", progress.produced, progress.failed);
+
+    //Destroy the source and Task Manager
+    AsynchTasks::TaskSource::destroy();
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    batchedTasks - Compare processing Tasks one at a time against processing Tasks of the
+                   same kind in batches
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void batchedTasks() {
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Convert temperatures from celsius to fahrenheit
+    const int count = 5000;
+    std::atomic<int> batches(0);
+    AsynchTasks::BatchKind<float, float> convert = AsynchTasks::TaskManager::createBatchKind<float, float>([&batches](const float* pInputs, float* pOutputs, size_t pCount) {
+        ++batches;
+        for (size_t i = 0; i < pCount; i++) pOutputs[i] = pInputs[i] * 1.8f + 32.f;
+    }, 64);
+
+    //Measure the time for the Tasks to complete
+    auto measure = [&](const char* pLabel, std::vector<AsynchTasks::Task<float>>& pTasks) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (auto& task : pTasks) AsynchTasks::TaskManager::addTask(task);
+        for (auto& task : pTasks) while (task->status != AsynchTasks::ETaskStatus::Completed) std::this_thread::yield();
+        printf("%-12s %d Tasks finished in %.3fs\n", pLabel, count, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    //Create the Tasks processed individually and in batches
+    std::vector<AsynchTasks::Task<float>> single, batched;
+    for (int i = 0; i < count; i++) {
+        const float celsius = (float)(i % 100);
+        single.push_back(AsynchTasks::TaskManager::createTask<float>());
+        single.back()->process = [celsius]() { return celsius * 1.8f + 32.f; };
+        batched.push_back(AsynchTasks::TaskManager::createBatchTask(convert, celsius));
+    }
+
+    //Process the Tasks
+    measure("Individual:", single);
+    measure("Batched:", batched);
+    printf("The batched Tasks were processed with %d calls to the batch function\n", batches.load());
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    batchedCallbacks - Compare the time spent in update delivering results to the callbacks of
+                       individual Tasks against a single callback for their batch kind
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void batchedCallbacks() {
+    //Create the Task Manager, allowing a frame worth of callbacks per update
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+    AsynchTasks::TaskManager::setMaxCallbacks(10000);
+
+    //Define basic Point struct
+    struct Point { float x, y; };
+
+    //Total the distances of points from the origin on the main thread
+    const int count = 10000;
+    double total = 0.0;
+    std::function<void(const Point*, float*, size_t)> measure = [](const Point* pPoints, float* pDistances, size_t pCount) {
+        for (size_t i = 0; i < pCount; i++) pDistances[i] = std::sqrt(pPoints[i].x * pPoints[i].x + pPoints[i].y * pPoints[i].y);
+    };
+    AsynchTasks::BatchKind<Point, float> individual = AsynchTasks::TaskManager::createBatchKind<Point, float>(measure, 64);
+    AsynchTasks::BatchKind<Point, float> batched = AsynchTasks::TaskManager::createBatchKind<Point, float>(measure, 64, [&total](float* pDistances, size_t pCount) {
+        for (size_t i = 0; i < pCount; i++) total += pDistances[i];
+    });
+
+    //Measure the time spent in update until the Tasks of a kind have finished
+    auto deliver = [&](const char* pLabel, const AsynchTasks::BatchKind<Point, float>& pKind) {
+        //Create the Tasks
+        std::vector<AsynchTasks::Task<float>> tasks;
+        for (int i = 0; i < count; i++) {
+            tasks.push_back(AsynchTasks::TaskManager::createBatchTask(pKind, Point{ (float)(i % 100), (float)(i / 100) }));
+            tasks.back()->callbackOnUpdate = true;
+            tasks.back()->callback = [&total](float& pDistance) { total += pDistance; };
+            AsynchTasks::TaskManager::addTask(tasks.back());
+        }
+
+        //Wait for the Tasks to be processed
+        for (auto& task : tasks) while (task->status != AsynchTasks::ETaskStatus::Callback_On_Update) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        //Deliver the results in a single update
+        total = 0.0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        AsynchTasks::TaskManager::update();
+        printf("%-24s total distance %.1f, %.3fms spent in update\n", pLabel, total, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    };
+    deliver("Individual callbacks:", individual);
+    deliver("Kind callback:", batched);
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+/*
+    scopedSum - Total a range of values by splitting it across the Tasks of nested scopes
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+
+    param[in] pValues - The values to total
+    param[in] pCount - The number of values
+
+    return long long - Returns the total of the values
+*/
+long long scopedSum(const int* pValues, size_t pCount) {
+    //Total small ranges directly
+    if (pCount <= 4096) {
+        long long total = 0;
+        for (size_t i = 0; i < pCount; i++) total += pValues[i];
+        return total;
+    }
+
+    //Total the first half in a Task placed on the stack, and the second half on this thread
+    AsynchTasks::InlineTaskScope<1024> scope;
+    long long first = 0;
+    const size_t half = pCount / 2;
+    scope.spawn([&first, pValues, half]() { first = scopedSum(pValues, half); });
+    const long long second = scopedSum(pValues + half, pCount - half);
+    scope.wait();
+    return first + second;
+}
+
+/*
+    taskScopes - Fan out work into scopes that wait for their Tasks and pass on their errors
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void taskScopes() {
+    //Create the Task Manager
+    if (!AsynchTasks::TaskManager::create(4)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Total a large range of values with nested scopes
+    std::vector<int> values(1 << 20);
+    long long expected = 0;
+    for (size_t i = 0; i < values.size(); i++) expected += values[i] = (int)(i % 1000);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const long long total = scopedSum(values.data(), values.size());
+    printf("Summed %lld (expected %lld) in %.3fms\n", total, expected, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+    //Spawn Tasks where some fail, receiving the first error from wait
+    std::atomic<int> processed(0);
+    AsynchTasks::InlineTaskScope<32 * 1024> scope;
+    for (int i = 0; i < 32; i++) {
+        scope.spawn([&processed, i]() {
+            ++processed;
+            if (i % 10 == 9) throw std::runtime_error("Task " + std::to_string(i) + " failed");
+        });
+    }
+    try {
+        scope.wait();
+        printf("No error was received from the scope\n");
+    } catch (const std::exception& pError) {
+        printf("%d Tasks were processed before the scope passed on the error: %s\n", processed.load(), pError.what());
+    }
+
+    //Destroy the Task Manager
+    AsynchTasks::TaskManager::destroy();
+}
+
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+/*
+    memoryResources - Allocate Tasks and their results from a caller owned arena that is
+                      released at once
+    Author: Mitchell Croft
+    Created: 18/10/2026
+    Modified: 18/10/2026
+*/
+void memoryResources() {
+    //Create the Task Manager, allocating its lists from a pool
+    std::pmr::synchronized_pool_resource pool;
+    if (!AsynchTasks::TaskManager::create(4, &pool)) {
+        printf("Failed to create the Asynchronous Task Manager\n");
+        return;
+    }
+
+    //Create an arena that the Workers can share
+    std::pmr::monotonic_buffer_resource arena(1 << 20);
+    AsynchTasks::LockedResource arenaAccess(&arena);
+
+    //Create Tasks in the arena, each returning a list of numbers that is also allocated in the arena
+    const int count = 100;
+    std::atomic<long long> total(0);
+    std::atomic<int> inArena(0);
+    std::vector<AsynchTasks::Task<std::pmr::vector<int>>> tasks;
+    for (int i = 0; i < count; i++) {
+        tasks.push_back(AsynchTasks::TaskManager::createTask<std::pmr::vector<int>>(&arenaAccess));
+        tasks.back()->process = [i]() { std::pmr::vector<int> numbers(1000); for (int j = 0; j < 1000; j++) numbers[j] = i + j; return numbers; };
+        tasks.back()->callback = [&](std::pmr::vector<int>& pNumbers) {
+            if (pNumbers.get_allocator().resource() == &arenaAccess) ++inArena;
+            for (int number : pNumbers) total += number;
+        };
+        AsynchTasks::TaskManager::addTask(tasks.back());
+    }
+
+    //Wait for the Tasks to finish
+    for (auto& task : tasks) while (task->status != AsynchTasks::ETaskStatus::Completed) AsynchTasks::TaskManager::update();
+    printf("Summed %lld (expected %lld), %d of %d results were allocated in the arena\n", total.load(), (long long)count * 999 * 1000 / 2 + (long long)1000 * (count - 1) * count / 2, inArena.load(), count);
+
+    //Destroy the Task Manager, as the Workers can still reference the last Tasks
+    AsynchTasks::TaskManager::destroy();
+
+    //Release the Tasks and the arena at once
+    tasks.clear();
+    arena.release();
+}
+#endif
+
 /*
     main - Test the current implementation of the AsynchTasks namespace
     Author: Mitchell Croft
     Created: 18/08/2016
-    Modified: 12/01/2017
+    Modified: 18/10/2026
 */
-int main() {
+int main(int pArgc, char** pArgv) {
+    //Register the kinds of the process pool and run as a worker process if started by one
+    registerProcessKinds();
+    AsynchTasks::ProcessPool::runWorker(pArgc, pArgv);
+
     //Create a simple struct to describe possible tests
     struct ExecutableTest { const char* label; void(*const functionPtr)(); };
 
@@ -330,14 +2133,42 @@ int main() {
     const ExecutableTest POSSIBLE_TESTS[] = {
         {"Normalising Vectors", normalisingVectors},
         {"Reusable Task", reusableTask},
-        {"Error Reporting", errorReporting}
+        {"Error Reporting", errorReporting},
+        {"Asynchronous File Reading", asynchronousFileReading},
+#ifdef __linux__
+        {"Reactor Events", reactorEvents},
+#endif
+        {"Asset Streaming", assetStreaming},
+        {"Memory Mapped Processing", memoryMappedProcessing},
+        {"Write Behind", writeBehind},
+        {"Process Pool", processPool},
+        {"Remote Execution", remoteExecution},
+        {"Task Journal", taskJournal},
+        {"Spill Queue", spillQueue},
+        {"Rate Limiting", rateLimiting},
+        {"Automatic Retry", automaticRetry},
+        {"Incremental Computation", incrementalComputation},
+        {"Scheduler Introspection", schedulerIntrospection},
+        {"Scheduler Simulation", schedulerSimulation},
+        {"Trace Replay", traceReplay},
+        {"Policy Worker Pool", policyWorkerPool},
+        {"Closed Task Types", closedTaskTypes},
+        {"Bound Arguments", boundArguments},
+        {"Fire and Forget", fireAndForget},
+        {"Lazy Task Sources", lazySources},
+#ifdef _ASYNCHRONOUS_TASKS_PMR_
+        {"Memory Resources", memoryResources},
+#endif
+        {"Batched Tasks", batchedTasks},
+        {"Batched Callbacks", batchedCallbacks},
+        {"Task Scopes", taskScopes}
     };
 
     //Store the number of possible tests to select from
     const unsigned int TEST_COUNT = sizeof(POSSIBLE_TESTS) / sizeof(ExecutableTest);
 
     //Store the user input
-    char usrChoice;
+    int usrChoice;
 
     //Loop so the user can choose the different tests
     do {
@@ -350,13 +2181,13 @@ int main() {
             printf("%i. %s\n", i + 1, POSSIBLE_TESTS[i].label);
 
         //Receive input selection from the user
-        getInput(usrChoice, "\nEnter the desired test (Invalid character to quit): ");  
+        getInput(usrChoice, "\nEnter the desired test (Invalid number to quit): ");  
 
-        //Adjust for character/digit offset
-        usrChoice -= '1';
+        //Adjust for the one based numbering (invalid input is read as zero)
+        usrChoice -= 1;
 
         //Check the selection is within range
-        if (usrChoice >= 0 && usrChoice < TEST_COUNT) {
+        if (usrChoice >= 0 && usrChoice < (int)TEST_COUNT) {
             //Call the function
             POSSIBLE_TESTS[usrChoice].functionPtr();
 